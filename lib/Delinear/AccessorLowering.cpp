@@ -0,0 +1,263 @@
+#include <map>
+#include <tuple>
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/Local.h"
+#include "llvm/Transforms/Utils/PromoteMemToReg.h"
+
+#include "CUDArraysSymbols.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-lower-accessors"
+
+STATISTIC(NumInlined,       "Number of cudarrays helper calls inlined");
+STATISTIC(NumMetadataLoads, "Number of dynarray metadata loads moved to the entry block");
+STATISTIC(NumSharedLoads,   "Number of dynarray metadata loads removed");
+STATISTIC(NumDisplacements, "Number of element addresses rewritten as constant displacements");
+
+static cl::opt<unsigned>
+MaxInlineRounds("cudarrays-inline-rounds",
+                cl::desc("Maximum nesting of the cudarrays helpers inlined"),
+                cl::init(16));
+
+namespace platonic {
+
+// Lowers the dynarray accessors of the kernels to plain address arithmetic.
+// The accessors (dynarray::operator(), array_storage::access_pos and the
+// linearizer and permute_index helpers) are inlined, the reads of the
+// dynarray metadata are moved to the kernel entry and shared, and the
+// element addresses that only differ in a constant from another one in
+// the same block (e.g. the +-1 neighbours of a stencil) are rebased on it.
+//
+// delin needs the accessor calls, so it must run before this pass.
+class AccessorLowering : public ModulePass {
+  // Dynarray alloca, byte offset and type of a metadata field
+  using FieldKey = std::tuple<const AllocaInst *, int64_t, Type *>;
+
+ public:
+  static char ID;
+  AccessorLowering() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+    const DataLayout &DL = getAnalysis<DataLayoutPass>().getDataLayout();
+
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+
+      if (!inlineHelpers(fun)) continue;
+      result = true;
+
+      promoteAllocas(fun);
+      shareMetadataLoads(fun, DL);
+      rebaseNeighbours(fun);
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<DominatorTreeWrapperPass>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  static bool isHelper(const Function *fun) {
+    if (!fun || fun->isDeclaration() || fun->doesNotReturn()) return false;
+    StringRef name = fun->getName();
+    return name.startswith("_ZN9cudarrays") ||
+           name.startswith("_ZNK9cudarrays");
+  }
+
+  // The helpers are templates resolved with 'if (false)' branches, some of
+  // them recursive, so dead code is removed after every round
+  bool inlineHelpers(Function &fun) {
+    bool result = false;
+    for (unsigned round = 0; round < MaxInlineRounds; ++round) {
+      for (BasicBlock &bb : fun)
+        ConstantFoldTerminator(&bb);
+      removeUnreachableBlocks(fun);
+
+      SmallVector<CallInst *, 32> calls;
+      for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+        CallInst *call = dyn_cast<CallInst>(&*it);
+        if (call && isHelper(call->getCalledFunction()))
+          calls.push_back(call);
+      }
+      if (calls.empty()) break;
+
+      for (CallInst *call : calls) {
+        InlineFunctionInfo IFI;
+        if (InlineFunction(call, IFI)) {
+          ++NumInlined;
+          result = true;
+        }
+      }
+    }
+    return result;
+  }
+
+  // The index arguments of the helpers are passed through allocas
+  void promoteAllocas(Function &fun) {
+    DominatorTree &DT = getAnalysis<DominatorTreeWrapperPass>(fun).getDomTree();
+
+    std::vector<AllocaInst *> allocas;
+    for (Instruction &inst : fun.getEntryBlock()) {
+      AllocaInst *alloca = dyn_cast<AllocaInst>(&inst);
+      if (alloca && isAllocaPromotable(alloca))
+        allocas.push_back(alloca);
+    }
+    if (!allocas.empty())
+      PromoteMemToReg(allocas, DT);
+  }
+
+  // Whether every use of ptr only reads from it, apart from 'store'. The
+  // copies are also read through llvm.nvvm.ptr.gen.to.* conversions.
+  static bool isReadOnly(const Value *ptr, const StoreInst *store) {
+    for (const User *user : ptr->users()) {
+      if (user == store || isa<LoadInst>(user)) continue;
+      if (isa<GetElementPtrInst>(user) || isa<BitCastInst>(user) ||
+          isa<AddrSpaceCastInst>(user) ||
+          (isa<CallInst>(user) && findAllocaSource(user))) {
+        if (!isReadOnly(user, store)) return false;
+        continue;
+      }
+      return false;
+    }
+    return true;
+  }
+
+  // Kernels copy their dynarray arguments to allocas that are never written
+  // again, so the metadata loads can all read right after the copy
+  void shareMetadataLoads(Function &fun, const DataLayout &DL) {
+    DenseMap<const AllocaInst *, StoreInst *> copies;
+    for (Instruction &inst : fun.getEntryBlock()) {
+      StoreInst *store = dyn_cast<StoreInst>(&inst);
+      if (!store || !isa<Argument>(store->getValueOperand())) continue;
+
+      AllocaInst *alloca = dyn_cast<AllocaInst>(store->getPointerOperand());
+      if (alloca && isReadOnly(alloca, store))
+        copies[alloca] = store;
+    }
+    if (copies.empty()) return;
+
+    std::vector<LoadInst *> loads;
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      if (LoadInst *load = dyn_cast<LoadInst>(&*it))
+        loads.push_back(load);
+    }
+
+    std::map<FieldKey, LoadInst *> fields;
+    for (LoadInst *load : loads) {
+      if (load->isVolatile()) continue;
+
+      APInt offset(DL.getPointerSizeInBits(), 0);
+      const Value *base = load->getPointerOperand()->
+        stripAndAccumulateInBoundsConstantOffsets(DL, offset);
+      const AllocaInst *alloca = findAllocaSource(base);
+      if (!alloca || !copies.count(alloca)) continue;
+
+      FieldKey key(alloca, offset.getSExtValue(), load->getType());
+      auto field = fields.find(key);
+      if (field != fields.end()) {
+        load->replaceAllUsesWith(field->second);
+        RecursivelyDeleteTriviallyDeadInstructions(load);
+        ++NumSharedLoads;
+        continue;
+      }
+
+      // Read the field right after the argument copy
+      StoreInst *copy = copies[alloca];
+      IRBuilder<> B(copy->getParent(), std::next(BasicBlock::iterator(copy)));
+      Value *ptr = B.CreateBitCast(const_cast<AllocaInst *>(alloca),
+                                   B.getInt8PtrTy());
+      ptr = B.CreateConstInBoundsGEP1_64(ptr, offset.getZExtValue());
+      // Loads through an address space conversion read the alloca directly
+      ptr = B.CreateBitCast(ptr, load->getType()->getPointerTo(
+        alloca->getType()->getPointerAddressSpace()));
+      LoadInst *field_load = B.CreateLoad(ptr, load->getName());
+      field_load->setAlignment(load->getAlignment());
+      field_load->setMetadata(LLVMContext::MD_invariant_load,
+                              MDNode::get(fun.getContext(), None));
+
+      load->replaceAllUsesWith(field_load);
+      RecursivelyDeleteTriviallyDeadInstructions(load);
+      fields[key] = field_load;
+      ++NumMetadataLoads;
+    }
+  }
+
+  // gep base, (i + c) is rewritten as gep (gep base, i), c
+  void rebaseNeighbours(Function &fun) {
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+
+    for (BasicBlock &bb : fun) {
+      // Element addresses in the block, by base pointer
+      DenseMap<Value *, SmallVector<GetElementPtrInst *, 8> > leaders;
+
+      for (auto it = bb.begin(); it != bb.end(); ) {
+        GetElementPtrInst *gep = dyn_cast<GetElementPtrInst>(&*it++);
+        if (!gep || gep->getNumIndices() != 1) continue;
+
+        Value *idx = gep->getOperand(1);
+        if (isa<Constant>(idx) || !SE.isSCEVable(idx->getType())) continue;
+        const SCEV *scev = SE.getSCEV(idx);
+
+        bool rebased = false;
+        for (GetElementPtrInst *leader : leaders[gep->getPointerOperand()]) {
+          Value *leaderIdx = leader->getOperand(1);
+          if (leaderIdx->getType() != idx->getType()) continue;
+
+          const SCEVConstant *diff = dyn_cast<SCEVConstant>(
+            SE.getMinusSCEV(scev, SE.getSCEV(leaderIdx)));
+          if (!diff) continue;
+
+          GetElementPtrInst *rebase = GetElementPtrInst::Create(
+            leader, diff->getValue(), gep->getName(), gep);
+          rebase->setIsInBounds(gep->isInBounds() && leader->isInBounds());
+          rebase->setDebugLoc(gep->getDebugLoc());
+          gep->replaceAllUsesWith(rebase);
+          RecursivelyDeleteTriviallyDeadInstructions(gep);
+          ++NumDisplacements;
+          rebased = true;
+          break;
+        }
+
+        if (!rebased)
+          leaders[gep->getPointerOperand()].push_back(gep);
+      }
+    }
+  }
+};
+
+char AccessorLowering::ID;
+
+static RegisterPass<AccessorLowering>
+X("cudarrays-lower-accessors",
+  "Inline the dynarray accessors and strength-reduce their addresses",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
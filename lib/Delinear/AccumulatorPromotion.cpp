@@ -0,0 +1,259 @@
+#include <algorithm>
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/SSAUpdater.h"
+
+#include "CUDArraysSymbols.h"
+#include "IRHelpers.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-promote-accumulators"
+
+STATISTIC(NumAccumulators, "Number of array elements kept in a register across a loop");
+STATISTIC(NumAccessesRemoved, "Number of loads and stores removed from loops");
+
+namespace platonic {
+
+// Keeps the array elements that a loop reads and writes at a fixed index
+// in a register, e.g. C(i, j) in
+//
+//   for (k = 0; k < n; ++k)
+//     C(i, j) += A(i, k) * B(k, j);
+//
+// The element is loaded once in the preheader and stored once in the exit
+// blocks. The element address must be loop invariant and every other
+// memory access of the loop must be proven not to touch it, either by the
+// alias analysis (the scopes of the -cudarrays-noalias clones) or because
+// its index is at a constant distance from the element one.
+//
+// The accessors must have been lowered (-cudarrays-lower-accessors) so that
+// the loads and stores are visible in the loop.
+class AccumulatorPromotion : public ModulePass {
+ public:
+  static char ID;
+  AccumulatorPromotion() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+    DL_ = &getAnalysis<DataLayoutPass>().getDataLayout();
+    AA_ = &getAnalysis<AliasAnalysis>();
+
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+
+      LoopInfo &LI = getAnalysis<LoopInfo>(fun);
+      SE_ = &getAnalysis<ScalarEvolution>(fun);
+      DT_ = &getAnalysis<DominatorTreeWrapperPass>(fun).getDomTree();
+
+      // Inner loops first, so their accumulators can move further out
+      SmallVector<Loop *, 8> loops;
+      collectLoops(LI, loops, true);
+      for (Loop *L : loops)
+        result |= promoteLoop(L);
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<AliasAnalysis>();
+    AU.addRequired<DominatorTreeWrapperPass>();
+    AU.addRequired<LoopInfo>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  const DataLayout *DL_;
+  AliasAnalysis *AA_;
+  ScalarEvolution *SE_;
+  DominatorTree *DT_;
+
+  static Value *getPointer(Instruction *inst) {
+    if (LoadInst *load = dyn_cast<LoadInst>(inst)) return load->getPointerOperand();
+    if (StoreInst *store = dyn_cast<StoreInst>(inst)) return store->getPointerOperand();
+    return NULL;
+  }
+
+  static Type *getAccessType(Instruction *inst) {
+    if (StoreInst *store = dyn_cast<StoreInst>(inst))
+      return store->getValueOperand()->getType();
+    return inst->getType();
+  }
+
+  static bool isSimple(Instruction *inst) {
+    if (LoadInst *load = dyn_cast<LoadInst>(inst)) return load->isSimple();
+    return cast<StoreInst>(inst)->isSimple();
+  }
+
+  // Whether the accesses of size bytes at a and b are disjoint because
+  // their addresses are a constant distance apart
+  bool isDisjoint(const SCEV *a, const SCEV *b, uint64_t size) const {
+    if (a->getType() != b->getType()) return false;
+    const SCEVConstant *diff = dyn_cast<SCEVConstant>(SE_->getMinusSCEV(a, b));
+    if (!diff) return false;
+    const APInt &dist = diff->getValue()->getValue();
+    return dist.abs().uge(size);
+  }
+
+  // Whether inst may read or write the element at loc
+  bool mayAccess(Instruction *inst, const SCEV *ptr, uint64_t size,
+                 const AliasAnalysis::Location &loc) const {
+    if (!inst->mayReadOrWriteMemory()) return false;
+
+    if (Value *other = getPointer(inst)) {
+      uint64_t otherSize = DL_->getTypeStoreSize(getAccessType(inst));
+      if (SE_->isSCEVable(other->getType()) &&
+          isDisjoint(ptr, SE_->getSCEV(other), std::max(size, otherSize)))
+        return false;
+    }
+    return AA_->getModRefInfo(inst, loc) != AliasAnalysis::NoModRef;
+  }
+
+  // A store that runs in every iteration that leaves the loop, so the
+  // element is valid to load and store around it
+  bool isGuaranteed(Loop *L, const SmallVectorImpl<Instruction *> &accesses) {
+    SmallVector<BasicBlock *, 4> exiting;
+    L->getExitingBlocks(exiting);
+    for (Instruction *inst : accesses) {
+      if (!isa<StoreInst>(inst)) continue;
+
+      bool dominates = true;
+      for (BasicBlock *bb : exiting)
+        dominates = dominates && DT_->dominates(inst->getParent(), bb);
+      if (dominates) return true;
+    }
+    return false;
+  }
+
+  bool promoteLoop(Loop *L) {
+    BasicBlock *preheader = L->getLoopPreheader();
+    if (!preheader || !L->hasDedicatedExits()) return false;
+
+    // Loads and stores of the loop by element address
+    MapVector<const SCEV *, SmallVector<Instruction *, 4> > elements;
+    std::vector<Instruction *> others;
+    for (BasicBlock *bb : L->blocks()) {
+      for (Instruction &inst : *bb) {
+        if (!inst.mayReadOrWriteMemory()) continue;
+
+        Value *ptr = getPointer(&inst);
+        if (ptr && isSimple(&inst) && SE_->isSCEVable(ptr->getType())) {
+          const SCEV *scev = SE_->getSCEV(ptr);
+          if (SE_->isLoopInvariant(scev, L)) {
+            elements[scev].push_back(&inst);
+            continue;
+          }
+        }
+        others.push_back(&inst);
+      }
+    }
+
+    bool result = false;
+    for (auto &element : elements) {
+      const SCEV *scev = element.first;
+      SmallVector<Instruction *, 4> &accesses = element.second;
+
+      Type *type = getAccessType(accesses.front());
+      bool consistent = true;
+      for (Instruction *inst : accesses)
+        consistent = consistent && getAccessType(inst) == type;
+      if (!consistent || !isGuaranteed(L, accesses)) continue;
+
+      StoreInst *store = NULL;
+      for (Instruction *inst : accesses)
+        if (!store) store = dyn_cast<StoreInst>(inst);
+
+      uint64_t size = DL_->getTypeStoreSize(type);
+      AliasAnalysis::Location loc = AA_->getLocation(store);
+
+      // Every other access of the loop must leave the element alone,
+      // including the other invariant elements
+      bool unaliased = true;
+      for (Instruction *inst : others)
+        unaliased = unaliased && !mayAccess(inst, scev, size, loc);
+      for (auto &other : elements) {
+        if (other.first == scev) continue;
+        for (Instruction *inst : other.second)
+          unaliased = unaliased && !mayAccess(inst, scev, size, loc);
+      }
+      if (!unaliased) continue;
+
+      bool changed = false;
+      Value *ptr = store->getPointerOperand();
+      if (!L->makeLoopInvariant(ptr, changed)) continue;
+
+      DEBUG(errs() << "Accumulator " << *ptr << " in loop "
+                   << L->getHeader()->getName() << "\n");
+
+      unsigned alignment = store->getAlignment();
+      for (Instruction *inst : accesses) {
+        unsigned align = isa<LoadInst>(inst) ?
+          cast<LoadInst>(inst)->getAlignment() :
+          cast<StoreInst>(inst)->getAlignment();
+        alignment = std::min(alignment, align);
+      }
+      AAMDNodes AAInfo;
+      store->getAAMetadata(AAInfo);
+
+      SmallVector<Instruction *, 4> insts(accesses.begin(), accesses.end());
+      SmallVector<PHINode *, 16> phis;
+      SSAUpdater SSA(&phis);
+      LoadAndStorePromoter promoter(insts, SSA, ptr->getName() + ".acc");
+
+      LoadInst *init = new LoadInst(ptr, ptr->getName() + ".acc.init",
+                                    preheader->getTerminator());
+      init->setAlignment(alignment);
+      init->setAAMetadata(AAInfo);
+      SSA.AddAvailableValue(preheader, init);
+
+      promoter.run(insts);
+
+      // The value left by the last iteration is stored once on the way out
+      SmallVector<BasicBlock *, 4> exits;
+      L->getUniqueExitBlocks(exits);
+      for (BasicBlock *exit : exits) {
+        StoreInst *out = new StoreInst(SSA.GetValueInMiddleOfBlock(exit), ptr,
+                                       exit->getFirstInsertionPt());
+        out->setAlignment(alignment);
+        out->setAAMetadata(AAInfo);
+      }
+
+      // The accesses are gone and no longer conflict with other elements
+      NumAccessesRemoved += accesses.size();
+      accesses.clear();
+      ++NumAccumulators;
+      result = true;
+    }
+
+    if (result) SE_->forgetLoop(L);
+    return result;
+  }
+};
+
+char AccumulatorPromotion::ID;
+
+static RegisterPass<AccumulatorPromotion>
+X("cudarrays-promote-accumulators",
+  "Keep loop-invariant dynarray elements in registers across loops",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
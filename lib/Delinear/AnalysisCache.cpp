@@ -0,0 +1,383 @@
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include "AnalysisCache.h"
+#include "DbgLinePrinter.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InlineAsm.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Operator.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+static cl::opt<std::string>
+CacheDir("cudarrays-cache-dir",
+         cl::desc("Directory used to cache the kernel access summaries"),
+         cl::init(""));
+
+static const char *CacheMagic = "cudarrays-summary";
+// Bump whenever the analysis or the entry format changes
+static const unsigned CacheVersion = 3;
+
+namespace platonic {
+
+namespace {
+
+// Structural hash of the IR. Values are identified by their position in
+// the function and metadata is ignored, so changes in other kernels (e.g.
+// the debug info numbering) do not invalidate the entries. The summaries
+// also hold the array names and the source locations of the accesses, so
+// the names of the arguments and instructions and the file and line of
+// the calls are hashed too.
+class IRHasher {
+  MD5 &hash_;
+  DenseMap<const Value *, unsigned> ids_;
+
+  void update(StringRef str) {
+    hash_.update(str);
+    hash_.update(StringRef("\0", 1));
+  }
+
+  void updateInt(uint64_t val) {
+    update(utostr(val));
+  }
+
+  void updateType(Type *type) {
+    std::string str;
+    raw_string_ostream os(str);
+    type->print(os);
+    update(os.str());
+  }
+
+  void updateFlags(const User *user) {
+    if (auto *op = dyn_cast<OverflowingBinaryOperator>(user)) {
+      updateInt(op->hasNoSignedWrap());
+      updateInt(op->hasNoUnsignedWrap());
+    }
+    if (auto *op = dyn_cast<PossiblyExactOperator>(user)) {
+      updateInt(op->isExact());
+    }
+    if (auto *op = dyn_cast<GEPOperator>(user)) {
+      updateInt(op->isInBounds());
+    }
+  }
+
+  void updateConstant(const Constant *C) {
+    updateType(C->getType());
+
+    if (auto *global = dyn_cast<GlobalValue>(C)) {
+      update("@");
+      update(global->getName());
+    } else if (auto *cint = dyn_cast<ConstantInt>(C)) {
+      update(cint->getValue().toString(16, false));
+    } else if (auto *cfp = dyn_cast<ConstantFP>(C)) {
+      update(cfp->getValueAPF().bitcastToAPInt().toString(16, false));
+    } else if (auto *data = dyn_cast<ConstantDataSequential>(C)) {
+      update(data->getRawDataValues());
+    } else if (auto *expr = dyn_cast<ConstantExpr>(C)) {
+      update(expr->getOpcodeName());
+      updateFlags(expr);
+      if (expr->isCompare())
+        updateInt(expr->getPredicate());
+      if (expr->hasIndices())
+        for (unsigned idx : expr->getIndices())
+          updateInt(idx);
+      for (const Use &op : expr->operands())
+        updateConstant(cast<Constant>(op));
+    } else {
+      // Null, undef, zeroinitializer and aggregates
+      updateInt(C->getValueID());
+      for (const Use &op : C->operands())
+        updateConstant(cast<Constant>(op));
+    }
+  }
+
+  void updateOperand(const Value *V) {
+    if (!V) {
+      update("null");
+      return;
+    }
+
+    auto it = ids_.find(V);
+    if (it != ids_.end()) {
+      update("%");
+      updateInt(it->second);
+    } else if (auto *C = dyn_cast<Constant>(V)) {
+      updateConstant(C);
+    } else if (auto *inlineAsm = dyn_cast<InlineAsm>(V)) {
+      update(inlineAsm->getAsmString());
+      update(inlineAsm->getConstraintString());
+    } else {
+      // Metadata operands
+      update("?");
+    }
+  }
+
+  void updateAttributes(AttributeSet attrs) {
+    for (unsigned i = 0; i < attrs.getNumSlots(); ++i) {
+      unsigned index = attrs.getSlotIndex(i);
+      updateInt(index);
+      update(attrs.getAsString(index));
+    }
+  }
+
+  void updateInstruction(const Instruction &I) {
+    update(I.getOpcodeName());
+    update(I.getName());
+    updateType(I.getType());
+    updateFlags(&I);
+
+    if (auto *cmp = dyn_cast<CmpInst>(&I)) {
+      updateInt(cmp->getPredicate());
+    } else if (auto *load = dyn_cast<LoadInst>(&I)) {
+      updateInt(load->getAlignment());
+      updateInt(load->isVolatile());
+    } else if (auto *store = dyn_cast<StoreInst>(&I)) {
+      updateInt(store->getAlignment());
+      updateInt(store->isVolatile());
+    } else if (auto *alloca = dyn_cast<AllocaInst>(&I)) {
+      updateType(alloca->getAllocatedType());
+      updateInt(alloca->getAlignment());
+    } else if (auto *extract = dyn_cast<ExtractValueInst>(&I)) {
+      for (unsigned idx : extract->getIndices())
+        updateInt(idx);
+    } else if (auto *insert = dyn_cast<InsertValueInst>(&I)) {
+      for (unsigned idx : insert->getIndices())
+        updateInt(idx);
+    } else if (auto *phi = dyn_cast<PHINode>(&I)) {
+      for (unsigned i = 0; i < phi->getNumIncomingValues(); ++i)
+        updateOperand(phi->getIncomingBlock(i));
+    } else if (auto *call = dyn_cast<CallInst>(&I)) {
+      updateInt(call->getCallingConv());
+      updateAttributes(call->getAttributes());
+
+      std::string file;
+      unsigned line;
+      if (getSourceLocation(call, file, line)) {
+        update(file);
+        updateInt(line);
+      }
+    }
+
+    for (const Use &op : I.operands())
+      updateOperand(op);
+  }
+
+ public:
+  explicit IRHasher(MD5 &hash) : hash_(hash) {}
+
+  void updateFunction(const Function &F) {
+    update(F.getName());
+    updateType(F.getFunctionType());
+    updateInt(F.getCallingConv());
+    updateAttributes(F.getAttributes());
+    if (F.isDeclaration()) return;
+
+    unsigned id = 0;
+    for (auto arg = F.arg_begin(), E = F.arg_end(); arg != E; ++arg) {
+      update(arg->getName());
+      ids_[&*arg] = id++;
+    }
+    for (const BasicBlock &bb : F) {
+      ids_[&bb] = id++;
+      for (const Instruction &inst : bb)
+        ids_[&inst] = id++;
+    }
+
+    for (const BasicBlock &bb : F) {
+      update("bb");
+      for (const Instruction &inst : bb) {
+        if (isa<DbgInfoIntrinsic>(&inst)) continue;
+        updateInstruction(inst);
+      }
+    }
+
+    ids_.clear();
+  }
+};
+
+}
+
+AnalysisCache::AnalysisCache() :
+  dir_(CacheDir.getValue())
+{
+}
+
+std::string AnalysisCache::getKernelHash(const Function &kernel) {
+  // Collect the kernel and every function it transitively references
+  SmallPtrSet<const Function *, 16> visited;
+  std::vector<const Function *> workList(1, &kernel);
+  std::vector<const Function *> funs;
+  while (!workList.empty()) {
+    const Function *fun = workList.back();
+    workList.pop_back();
+
+    if (visited.count(fun)) continue;
+    visited.insert(fun);
+    funs.push_back(fun);
+
+    for (const_inst_iterator inst = inst_begin(fun),
+          E = inst_end(fun); inst != E; ++inst) {
+      // Callees may be behind casts, e.g. when called with another type
+      for (const Use &op : inst->operands()) {
+        if (const Function *callee = dyn_cast<Function>(op->stripPointerCasts()))
+          workList.push_back(callee);
+      }
+    }
+  }
+
+  // The module order of the callees must not change the hash
+  std::sort(funs.begin() + 1, funs.end(),
+            [](const Function *a, const Function *b) {
+              return a->getName() < b->getName();
+            });
+
+  MD5 hash;
+  hash.update(StringRef(CacheMagic));
+  hash.update(utostr(CacheVersion));
+
+  IRHasher hasher(hash);
+  for (const Function *fun : funs)
+    hasher.updateFunction(*fun);
+
+  MD5::MD5Result result;
+  hash.final(result);
+
+  SmallString<32> str;
+  MD5::stringifyResult(result, str);
+  return str.str();
+}
+
+std::string AnalysisCache::getPath(const std::string &hash) const {
+  SmallString<128> path(dir_);
+  sys::path::append(path, hash + ".summary");
+  return path.str();
+}
+
+bool AnalysisCache::lookup(const std::string &hash,
+                           KernelSummary &summary) const {
+  if (!isEnabled()) return false;
+
+  std::ifstream file(getPath(hash).c_str());
+  if (!file.is_open()) return false;
+
+  // Every dimension takes at least one character of the file, so larger
+  // counts come from a corrupt entry
+  file.seekg(0, std::ios::end);
+  std::streamoff size = file.tellg();
+  file.seekg(0, std::ios::beg);
+
+  std::string magic;
+  unsigned version;
+  size_t narrays;
+  if (!(file >> magic >> version >> narrays)) return false;
+  if (magic != CacheMagic || version != CacheVersion) return false;
+  if (narrays > summary.fun->arg_size()) return false;
+
+  std::vector<ArraySummary> arrays(narrays);
+  for (ArraySummary &array : arrays) {
+    unsigned isRead, isWritten, status;
+    if (!(file >> array.argNo >> array.dims >> isRead >> isWritten >>
+          status >> array.line))
+      return false;
+    if (array.argNo >= summary.fun->arg_size()) return false;
+    if (array.dims > size) return false;
+    if (status > ArrayFailed) return false;
+
+    array.isRead = isRead;
+    array.isWritten = isWritten;
+    array.status = ArrayStatus(status);
+
+    array.dimMasks.resize(array.dims);
+    for (unsigned &mask : array.dimMasks)
+      if (!(file >> mask)) return false;
+
+    // Strings may contain spaces, one per line
+    file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    if (!std::getline(file, array.name)) return false;
+    if (!std::getline(file, array.file)) return false;
+    if (!std::getline(file, array.reason)) return false;
+
+    // One line per dimension with the number of indices and the indices
+    array.dimIndices.resize(array.dims);
+    for (std::vector<SymExpr> &indices : array.dimIndices) {
+      std::string line;
+      if (!std::getline(file, line)) return false;
+
+      StringRef str(line);
+      unsigned nindices;
+      size_t len = str.find(' ');
+      if (str.substr(0, len).getAsInteger(10, nindices)) return false;
+      str = str.substr(std::min(len, str.size()));
+      if (nindices > str.size()) return false;
+
+      indices.resize(nindices);
+      for (SymExpr &index : indices)
+        if (!SymExpr::parse(str, index)) return false;
+    }
+  }
+
+  summary.arrays.swap(arrays);
+  return true;
+}
+
+void AnalysisCache::store(const std::string &hash,
+                          const KernelSummary &summary) const {
+  if (!isEnabled()) return;
+
+  if (std::error_code EC = sys::fs::create_directories(dir_)) {
+    errs() << "Cannot create cache directory " << dir_ << ": "
+           << EC.message() << "\n";
+    return;
+  }
+
+  // Write a temporary file and rename it, so that builds sharing the
+  // directory never read a partial entry
+  int fd;
+  SmallString<128> tmpPath;
+  if (sys::fs::createUniqueFile(getPath(hash) + "-%%%%%%.tmp", fd, tmpPath))
+    return;
+
+  {
+    raw_fd_ostream file(fd, true);
+    file << CacheMagic << " " << CacheVersion << " "
+         << summary.arrays.size() << "\n";
+    for (const ArraySummary &array : summary.arrays) {
+      file << array.argNo << " " << array.dims << " "
+           << unsigned(array.isRead) << " " << unsigned(array.isWritten) << " "
+           << unsigned(array.status) << " " << array.line;
+      for (unsigned mask : array.dimMasks)
+        file << " " << mask;
+      file << "\n" << array.name << "\n" << array.file << "\n"
+           << array.reason << "\n";
+      for (const std::vector<SymExpr> &indices : array.dimIndices) {
+        file << indices.size();
+        for (const SymExpr &index : indices) {
+          file << " ";
+          index.print(file);
+        }
+        file << "\n";
+      }
+    }
+  }
+
+  if (sys::fs::rename(tmpPath.str(), getPath(hash)))
+    sys::fs::remove(tmpPath.str());
+}
+
+}
+
+// vim: set ts=2 sw=2:
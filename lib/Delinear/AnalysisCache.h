@@ -0,0 +1,38 @@
+#ifndef ANALYSIS_CACHE_H
+#define ANALYSIS_CACHE_H
+
+#include <string>
+
+#include "KernelSummary.h"
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+// On-disk cache of kernel access summaries (-cudarrays-cache-dir). Entries
+// are keyed by a hash of the kernel IR and of every function it
+// transitively calls, so a kernel is only analysed again when something it
+// depends on changes.
+class AnalysisCache {
+ public:
+  AnalysisCache();
+
+  bool isEnabled() const { return !dir_.empty(); }
+
+  static std::string getKernelHash(const llvm::Function &kernel);
+
+  // summary.fun must be set by the caller
+  bool lookup(const std::string &hash, KernelSummary &summary) const;
+  void store(const std::string &hash, const KernelSummary &summary) const;
+
+ private:
+  std::string dir_;
+
+  std::string getPath(const std::string &hash) const;
+};
+
+}
+
+#endif // ANALYSIS_CACHE_H
@@ -0,0 +1,339 @@
+#include <vector>
+
+#include "ArrayLayout.h"
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Operator.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "CUDArraysSymbols.h"
+#include "IRHelpers.h"
+#include "KernelSummary.h"
+#include "ThreadStride.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-shared-soa"
+
+STATISTIC(NumTransposedArrays, "Number of shared memory arrays of records turned into arrays of fields");
+
+namespace platonic {
+
+// Records with more fields are not considered arrays of records
+static const int64_t MaxFields = 64;
+
+static bool isThreadIdxX(const SymExpr &expr) {
+  if (expr.kind == SymExpr::SymThreadIdx) return expr.index == 0;
+  for (const SymExpr &op : expr.ops)
+    if (isThreadIdxX(op)) return true;
+  return false;
+}
+
+int getFieldDim(const ArraySummary &array) {
+  if (array.dimIndices.size() != array.dims) return -1;
+
+  bool threadDim = false;
+  for (unsigned dim = 0; dim < array.dims; ++dim) {
+    const std::vector<SymExpr> &indices = array.dimIndices[dim];
+    if (indices.empty()) return -1;
+
+    bool isField = true;
+    for (const SymExpr &index : indices)
+      isField = isField && index.kind == SymExpr::SymConst &&
+                index.value >= 0 && index.value < MaxFields;
+    if (isField && threadDim) return dim;
+
+    for (const SymExpr &index : indices)
+      threadDim = threadDim || isThreadIdxX(index);
+  }
+  return -1;
+}
+
+// Turns the shared memory arrays of records of the kernels into arrays of
+// fields. For
+//
+//   __shared__ float cells[BLOCK][FIELDS];
+//   ... = cells[threadIdx.x][F];
+//
+// the threads of a warp access words FIELDS apart, which conflict in the
+// shared memory banks; with cells[FIELDS][BLOCK] they access consecutive
+// words. The last dimension must only be indexed by constants and another
+// one by threadIdx.x.
+//
+// Unlike the dynarrays, whose layout is fixed by their storage_reorder_conf
+// (see getFieldDim for the hints registered for them), the layout of the
+// shared arrays belongs to the kernel, so their accesses are rewritten.
+class SharedArrayTranspose : public ModulePass {
+  // An element address of the array and the indices of every dimension,
+  // as the terms that add up to them
+  using DimTerm = std::pair<unsigned, Value *>;
+
+  struct Element {
+    Value *ptr;
+    std::vector<SmallVector<Value *, 2> > indices;
+  };
+
+ public:
+  static char ID;
+  SharedArrayTranspose() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+
+    std::vector<GlobalVariable *> arrays;
+    for (GlobalVariable &global : M.globals()) {
+      if (global.getType()->getAddressSpace() == 3 && global.hasLocalLinkage())
+        arrays.push_back(&global);
+    }
+
+    for (GlobalVariable *array : arrays) {
+      std::vector<unsigned> extents;
+      Type *type = array->getType()->getElementType();
+      while (ArrayType *arrayTy = dyn_cast<ArrayType>(type)) {
+        extents.push_back(arrayTy->getNumElements());
+        type = arrayTy->getElementType();
+      }
+      if (extents.size() < 2 || !type->isSingleValueType()) continue;
+      if (array->hasInitializer() &&
+          !isa<UndefValue>(array->getInitializer()) &&
+          !array->getInitializer()->isNullValue())
+        continue;
+
+      array->removeDeadConstantUsers();
+      std::vector<Element> elements;
+      if (!collectElements(array, 0, extents.size(), std::vector<DimTerm>(),
+                           elements))
+        continue;
+      if (!isArrayOfRecords(elements, extents.back(), symbols)) continue;
+
+      transpose(array, extents, type, elements);
+      ++NumTransposedArrays;
+      result = true;
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  // Whether ptr is only loaded from and stored to, possibly after
+  // converting it to a generic pointer
+  static bool isAccessedDirectly(Value *ptr) {
+    for (User *user : ptr->users()) {
+      if (isa<LoadInst>(user)) continue;
+      if (StoreInst *store = dyn_cast<StoreInst>(user)) {
+        if (store->getValueOperand() == ptr) return false;
+        continue;
+      }
+      if (isa<GEPOperator>(user) &&
+          cast<GEPOperator>(user)->getPointerOperand() == ptr)
+        continue;
+      if (getSharedToGeneric(user)) {
+        for (User *generic : user->users()) {
+          if (!isa<LoadInst>(generic) && !isa<StoreInst>(generic)) return false;
+          if (isa<StoreInst>(generic) &&
+              cast<StoreInst>(generic)->getValueOperand() == user)
+            return false;
+        }
+        continue;
+      }
+      return false;
+    }
+    return true;
+  }
+
+  // Follows the GEPs from val, which points into the array after fixing
+  // depth indices, down to the element addresses. terms are the values
+  // added to the index of each dimension so far.
+  static bool collectElements(Value *val, unsigned depth, unsigned dims,
+                              const std::vector<DimTerm> &terms,
+                              std::vector<Element> &elements) {
+    if (depth == dims) {
+      if (!isAccessedDirectly(val)) return false;
+      Element element;
+      element.ptr = val;
+      element.indices.resize(dims);
+      for (const DimTerm &term : terms)
+        element.indices[term.first].push_back(term.second);
+      elements.push_back(element);
+    }
+
+    // Element addresses can still be offset along the last dimension
+    for (User *user : val->users()) {
+      GEPOperator *gep = dyn_cast<GEPOperator>(user);
+      if (!gep || gep->getPointerOperand() != val) {
+        if (depth == dims) continue;
+        return false;
+      }
+
+      std::vector<DimTerm> next(terms);
+      auto idx = gep->idx_begin();
+      if (depth == 0) {
+        ConstantInt *zero = dyn_cast<ConstantInt>(*idx);
+        if (!zero || !zero->isZero()) return false;
+      } else {
+        next.push_back(DimTerm(depth - 1, *idx));
+      }
+
+      unsigned dim = depth;
+      for (++idx; idx != gep->idx_end(); ++idx, ++dim)
+        next.push_back(DimTerm(dim, *idx));
+      if (!collectElements(gep, dim, dims, next, elements)) return false;
+    }
+    return true;
+  }
+
+  static bool isConstantField(const SmallVectorImpl<Value *> &terms,
+                              unsigned fields) {
+    int64_t field = 0;
+    for (Value *term : terms) {
+      ConstantInt *value = dyn_cast<ConstantInt>(term);
+      if (!value) return false;
+      field += value->getSExtValue();
+    }
+    return field >= 0 && field < int64_t(fields);
+  }
+
+  bool isArrayOfRecords(const std::vector<Element> &elements, unsigned fields,
+                        const SymbolIndex &symbols) {
+    if (fields > MaxFields) return false;
+
+    bool threadDriven = false;
+    for (const Element &element : elements) {
+      if (!isConstantField(element.indices.back(), fields)) return false;
+
+      Instruction *inst = dyn_cast<Instruction>(element.ptr);
+      if (!inst || threadDriven) continue;
+      ScalarEvolution &SE =
+        getAnalysis<ScalarEvolution>(*inst->getParent()->getParent());
+      for (unsigned dim = 0; dim + 1 < element.indices.size(); ++dim) {
+        for (Value *term : element.indices[dim]) {
+          int64_t coef;
+          if (SE.isSCEVable(term->getType()) &&
+              getThreadCoefficient(SE.getSCEV(term), 0, SE, symbols, coef) &&
+              coef)
+            threadDriven = true;
+        }
+      }
+    }
+    return threadDriven;
+  }
+
+  // Sum of the terms of an index, at insertPt
+  static Value *getIndex(const SmallVectorImpl<Value *> &terms,
+                         Instruction *insertPt) {
+    LLVMContext &ctx = insertPt ? insertPt->getContext()
+                                : terms.front()->getContext();
+    Type *int64Ty = Type::getInt64Ty(ctx);
+    Value *index = ConstantInt::get(int64Ty, 0);
+    for (Value *term : terms) {
+      if (Constant *constant = dyn_cast<Constant>(term)) {
+        Constant *ext = ConstantExpr::getSExtOrBitCast(constant, int64Ty);
+        if (isa<Constant>(index))
+          index = ConstantExpr::getAdd(cast<Constant>(index), ext);
+        else
+          index = BinaryOperator::CreateAdd(index, ext, "soa.idx", insertPt);
+      } else {
+        Value *ext = CastInst::CreateSExtOrBitCast(term, int64Ty, "soa.ext",
+                                                   insertPt);
+        index = BinaryOperator::CreateAdd(index, ext, "soa.idx", insertPt);
+      }
+    }
+    return index;
+  }
+
+  void transpose(GlobalVariable *array, const std::vector<unsigned> &extents,
+                 Type *elemTy, std::vector<Element> &elements) {
+    DEBUG(errs() << "Transposing fields of " << array->getName() << "\n");
+
+    // [fields x [n0 x ... [nk x T]]]
+    Type *type = elemTy;
+    for (unsigned dim = extents.size() - 1; dim-- > 0;)
+      type = ArrayType::get(type, extents[dim]);
+    type = ArrayType::get(type, extents.back());
+
+    Constant *init = NULL;
+    if (array->hasInitializer())
+      init = isa<UndefValue>(array->getInitializer()) ?
+        UndefValue::get(type) : Constant::getNullValue(type);
+    GlobalVariable *soa =
+      new GlobalVariable(*array->getParent(), type, false,
+                         array->getLinkage(), init,
+                         array->getName() + ".soa", array,
+                         array->getThreadLocalMode(), 3);
+    soa->setAlignment(array->getAlignment());
+
+    Type *int64Ty = Type::getInt64Ty(array->getContext());
+    std::vector<Instruction *> dead;
+    for (Element &element : elements) {
+      Instruction *insertPt = dyn_cast<Instruction>(element.ptr);
+
+      std::vector<Value *> idx;
+      idx.push_back(ConstantInt::get(int64Ty, 0));
+      idx.push_back(getIndex(element.indices.back(), insertPt));
+      for (unsigned dim = 0; dim + 1 < extents.size(); ++dim)
+        idx.push_back(getIndex(element.indices[dim], insertPt));
+
+      Value *ptr;
+      if (insertPt) {
+        ptr = GetElementPtrInst::CreateInBounds(soa, idx, "soa.ptr", insertPt);
+      } else {
+        std::vector<Constant *> constIdx;
+        for (Value *val : idx)
+          constIdx.push_back(cast<Constant>(val));
+        ptr = ConstantExpr::getInBoundsGetElementPtr(soa, constIdx);
+      }
+
+      // The GEPs over the old element address are elements themselves
+      SmallVector<Use *, 8> uses;
+      for (Use &use : element.ptr->uses())
+        if (!isa<GEPOperator>(use.getUser())) uses.push_back(&use);
+      for (Use *use : uses)
+        use->set(ptr);
+    }
+
+    // The old address computations are dead, outermost last
+    for (Element &element : elements)
+      if (Instruction *inst = dyn_cast<Instruction>(element.ptr))
+        dead.push_back(inst);
+    for (Instruction *inst : dead)
+      RecursivelyDeleteDeadGEPs(inst);
+
+    array->removeDeadConstantUsers();
+    soa->takeName(array);
+    if (array->use_empty())
+      array->eraseFromParent();
+  }
+
+  static void RecursivelyDeleteDeadGEPs(Instruction *inst) {
+    if (!inst->use_empty()) return;
+    Instruction *base = dyn_cast<Instruction>(inst->getOperand(0));
+    inst->eraseFromParent();
+    if (base && isa<GetElementPtrInst>(base))
+      RecursivelyDeleteDeadGEPs(base);
+  }
+};
+
+char SharedArrayTranspose::ID;
+
+static RegisterPass<SharedArrayTranspose>
+X("cudarrays-shared-soa",
+  "Turn the shared memory arrays of records into arrays of fields",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
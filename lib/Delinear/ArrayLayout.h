@@ -0,0 +1,17 @@
+#ifndef ARRAY_LAYOUT_H
+#define ARRAY_LAYOUT_H
+
+namespace platonic {
+
+struct ArraySummary;
+
+// Returns the dimension of an array of records that is better moved to be
+// the outermost one (array of structures to structure of arrays), or -1.
+// That is a dimension indexed only by small constants (the fields of the
+// records) inside a dimension indexed by threadIdx.x: neighbouring threads
+// then access elements a whole record apart instead of contiguous ones.
+int getFieldDim(const ArraySummary &array);
+
+}
+
+#endif // ARRAY_LAYOUT_H
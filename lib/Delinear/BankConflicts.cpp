@@ -0,0 +1,482 @@
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/GetElementPtrTypeIterator.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Operator.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "CUDArraysSymbols.h"
+#include "DbgLinePrinter.h"
+#include "IRHelpers.h"
+#include "LaunchBounds.h"
+#include "ThreadStride.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-bank-conflicts"
+
+STATISTIC(NumConflictingAccesses, "Number of shared memory accesses with bank conflicts");
+STATISTIC(NumPaddedArrays,        "Number of shared memory arrays padded");
+
+static cl::opt<bool>
+BankReport("cudarrays-bank-report",
+           cl::desc("Print the bank conflict degree of every shared memory access"),
+           cl::init(false));
+
+static cl::opt<bool>
+BankPadding("cudarrays-bank-padding",
+            cl::desc("Pad the rows of the shared memory arrays with bank conflicts"),
+            cl::init(true));
+
+namespace platonic {
+
+// Shared memory serves a warp from 32 banks of 4-byte words
+static const unsigned NumBanks  = 32;
+static const unsigned BankWidth = 4;
+static const unsigned WarpSize  = 32;
+
+// Finds the bank conflicts of the shared memory accesses of the kernels and
+// pads the rows of the arrays where they occur. For
+//
+//   __shared__ float tile[32][32];
+//   ... = tile[threadIdx.x][j];
+//
+// the threads of a warp are 128 bytes apart and hit the same bank; with
+// tile[32][33] they hit 32 different banks.
+//
+// The stride between consecutive threads comes from the coefficients of
+// threadIdx in the indices of the address computation, which must be a
+// chain of GEPs (possibly through llvm.nvvm.ptr.shared.to.gen) from the
+// shared array. Threads are assumed to fill a warp along x first, so the
+// threadIdx.y coefficient matters when blocks are narrower than a warp.
+class BankConflicts : public ModulePass {
+  // Byte stride of an access between consecutive threads along a grid
+  // dimension. The strides of the indices that step over rows of the
+  // array are kept apart, as they change with the padding.
+  struct Stride {
+    // Indices stepping over whole rows: (rows per step, coefficient)
+    std::vector<std::pair<uint64_t, int64_t> > rows;
+    int64_t bytes;
+    Stride() : bytes(0) {}
+  };
+
+  struct SharedAccess {
+    Instruction *inst;
+    GlobalVariable *array;
+    uint64_t size;
+    Stride stride[2];
+  };
+
+ public:
+  static char ID;
+  BankConflicts() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    SymbolIndex symbols(M);
+    DL_ = &getAnalysis<DataLayoutPass>().getDataLayout();
+    symbols_ = &symbols;
+
+    // Accesses of every array, over all the kernels
+    std::map<GlobalVariable *, std::vector<SharedAccess> > arrays;
+    std::map<GlobalVariable *, unsigned> blockWidths;
+
+    // The ranges of the thread ids bound the row indices of the accesses,
+    // and must be there before ScalarEvolution looks at the functions
+    bool result = false;
+    for (Function &fun : M)
+      if (!fun.isDeclaration())
+        result |= annotateRegisterRanges(fun, symbols);
+
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+      ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+      unsigned blockWidth = getLaunchBounds(fun).maxBlockDim[0];
+
+      for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+        Value *ptr = NULL;
+        Type *type = NULL;
+        if (LoadInst *load = dyn_cast<LoadInst>(&*it)) {
+          ptr = load->getPointerOperand();
+          type = load->getType();
+        } else if (StoreInst *store = dyn_cast<StoreInst>(&*it)) {
+          ptr = store->getPointerOperand();
+          type = store->getValueOperand()->getType();
+        }
+        if (!ptr) continue;
+
+        SharedAccess access;
+        access.inst = &*it;
+        access.size = DL_->getTypeStoreSize(type);
+        access.array = getStride(ptr, 0, SE, access.stride[0]);
+        if (!access.array) {
+          if (getSharedArray(ptr))
+            report(access.inst, getSharedArray(ptr), "not affine in threadIdx");
+          continue;
+        }
+
+        // Narrow blocks put several rows of threads in a warp
+        if (blockWidth < WarpSize &&
+            !getStride(ptr, 1, SE, access.stride[1])) {
+          report(access.inst, access.array, "not affine in threadIdx.y");
+          continue;
+        }
+
+        unsigned degree = getDegree(access, blockWidth, 0);
+        if (degree > 1) ++NumConflictingAccesses;
+        if (BankReport) {
+          std::string msg;
+          raw_string_ostream os(msg);
+          os << "stride " << evaluate(access.stride[0], access.array, 0)
+             << " bytes, " << degree << "-way";
+          report(access.inst, access.array, os.str());
+        }
+
+        arrays[access.array].push_back(access);
+        unsigned &width = blockWidths[access.array];
+        width = width ? std::min(width, blockWidth) : blockWidth;
+      }
+    }
+
+    if (!BankPadding) return result;
+
+    for (auto &array : arrays) {
+      GlobalVariable *global = array.first;
+      unsigned pad = choosePadding(global, array.second, blockWidths[global]);
+      if (pad) {
+        padArray(global, pad);
+        ++NumPaddedArrays;
+        result = true;
+      }
+    }
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  const DataLayout *DL_;
+  const SymbolIndex *symbols_;
+
+  // The shared array ptr points into, if any
+  static GlobalVariable *getSharedArray(Value *ptr) {
+    while (true) {
+      ptr = ptr->stripPointerCasts();
+      if (GEPOperator *gep = dyn_cast<GEPOperator>(ptr)) {
+        ptr = gep->getPointerOperand();
+      } else if (const CallInst *call = getSharedToGeneric(ptr)) {
+        ptr = call->getArgOperand(0);
+      } else {
+        GlobalVariable *global = dyn_cast<GlobalVariable>(ptr);
+        return global && global->getType()->getAddressSpace() == 3 ?
+          global : NULL;
+      }
+    }
+  }
+
+  // Innermost array of the array type, whose rows can be padded, or NULL
+  // for one-dimensional arrays
+  static ArrayType *getRowType(GlobalVariable *global) {
+    ArrayType *type = dyn_cast<ArrayType>(global->getType()->getElementType());
+    if (!type || !isa<ArrayType>(type->getElementType())) return NULL;
+
+    while (ArrayType *inner = dyn_cast<ArrayType>(type->getElementType()))
+      type = inner;
+    return type->getElementType()->isSingleValueType() ? type : NULL;
+  }
+
+  // Rows of row in type, or 0 if type does not contain rows
+  static uint64_t getRows(Type *type, ArrayType *row) {
+    if (!row) return 0;
+    if (type == row) return 1;
+    ArrayType *array = dyn_cast<ArrayType>(type);
+    return array ? array->getNumElements() * getRows(array->getElementType(), row)
+                 : 0;
+  }
+
+  // Byte stride of the access at ptr between consecutive threads along dim.
+  // Returns the shared array of the access, or NULL if the stride is not
+  // known. Indices of GEPs over casts of the array (e.g. to i8*, as in
+  // reductions over extern __shared__ buffers) step over the cast type, so
+  // they count as bytes rather than rows.
+  GlobalVariable *getStride(Value *ptr, unsigned dim, ScalarEvolution &SE,
+                            Stride &stride) const {
+    // (stepped type, coefficient) of every index
+    SmallVector<std::pair<Type *, int64_t>, 8> steps;
+
+    while (true) {
+      ptr = ptr->stripPointerCasts();
+      if (GEPOperator *gep = dyn_cast<GEPOperator>(ptr)) {
+        gep_type_iterator type = gep_type_begin(gep);
+        for (auto idx = gep->idx_begin(), E = gep->idx_end(); idx != E;
+             ++idx, ++type) {
+          SequentialType *seq = dyn_cast<SequentialType>(*type);
+          if (!seq) continue;
+
+          int64_t coef;
+          if (!getThreadCoefficient(SE.getSCEV(*idx), dim, SE, *symbols_, coef))
+            return NULL;
+          if (coef) steps.push_back(std::make_pair(seq->getElementType(), coef));
+        }
+        ptr = gep->getPointerOperand();
+      } else if (const CallInst *call = getSharedToGeneric(ptr)) {
+        ptr = call->getArgOperand(0);
+      } else {
+        break;
+      }
+    }
+
+    GlobalVariable *global = dyn_cast<GlobalVariable>(ptr);
+    if (!global || global->getType()->getAddressSpace() != 3) return NULL;
+
+    ArrayType *row = getRowType(global);
+    for (auto &step : steps) {
+      if (uint64_t rows = getRows(step.first, row))
+        stride.rows.push_back(std::make_pair(rows, step.second));
+      else
+        stride.bytes += step.second * int64_t(DL_->getTypeAllocSize(step.first));
+    }
+    return global;
+  }
+
+  // Byte stride with pad elements added to every row of array
+  int64_t evaluate(const Stride &stride, GlobalVariable *array,
+                   unsigned pad) const {
+    int64_t bytes = stride.bytes;
+    if (ArrayType *row = getRowType(array)) {
+      int64_t rowBytes = (row->getNumElements() + pad) *
+        DL_->getTypeAllocSize(row->getElementType());
+      for (auto &rows : stride.rows)
+        bytes += int64_t(rows.first) * rows.second * rowBytes;
+    }
+    return bytes;
+  }
+
+  static int64_t floorDiv(int64_t a, int64_t b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+  }
+
+  // Ways in which the requests of a warp to the access are serialized:
+  // the distinct words the busiest bank serves, over the words any bank
+  // serves when the warp reads consecutive words
+  unsigned getDegree(const SharedAccess &access, unsigned blockWidth,
+                     unsigned pad) const {
+    int64_t strideX = evaluate(access.stride[0], access.array, pad);
+    int64_t strideY = blockWidth < WarpSize ?
+      evaluate(access.stride[1], access.array, pad) : 0;
+    unsigned width = std::max(1u, std::min(blockWidth, WarpSize));
+
+    std::vector<std::set<int64_t> > banks(NumBanks);
+    for (unsigned lane = 0; lane < WarpSize; ++lane) {
+      int64_t addr = (lane % width) * strideX + (lane / width) * strideY;
+      int64_t first = floorDiv(addr, BankWidth);
+      int64_t last = floorDiv(addr + int64_t(access.size) - 1, BankWidth);
+      for (int64_t word = first; word <= last; ++word)
+        banks[(word % NumBanks + NumBanks) % NumBanks].insert(word);
+    }
+
+    unsigned busiest = 0;
+    for (auto &bank : banks)
+      busiest = std::max(busiest, unsigned(bank.size()));
+
+    unsigned ideal = (access.size * WarpSize + NumBanks * BankWidth - 1) /
+                     (NumBanks * BankWidth);
+    return std::max(1u, (busiest + ideal - 1) / ideal);
+  }
+
+  void report(Instruction *inst, GlobalVariable *array, StringRef msg) const {
+    if (!BankReport) return;
+
+    std::string file;
+    unsigned line;
+    errs() << inst->getParent()->getParent()->getName() << ": ";
+    if (getSourceLocation(inst, file, line))
+      errs() << file << ":" << line << ": ";
+    errs() << (isa<LoadInst>(inst) ? "load" : "store") << " of "
+           << array->getName() << ": " << msg << "\n";
+  }
+
+  // Elements to add to the rows of array to minimize the conflicts of its
+  // accesses, 0 when padding does not help
+  unsigned choosePadding(GlobalVariable *array,
+                         const std::vector<SharedAccess> &accesses,
+                         unsigned blockWidth) {
+    ArrayType *row = getRowType(array);
+    if (!row || !canPad(array)) return 0;
+
+    uint64_t elemSize = DL_->getTypeAllocSize(row->getElementType());
+    unsigned maxPad = std::max<uint64_t>(1, NumBanks * BankWidth / elemSize);
+
+    unsigned best = 0, bestDegree = 0;
+    for (unsigned pad = 0; pad < maxPad; ++pad) {
+      unsigned degree = 0;
+      for (const SharedAccess &access : accesses)
+        degree += getDegree(access, blockWidth, pad);
+      if (pad == 0 || degree < bestDegree) {
+        best = pad;
+        bestDegree = degree;
+      }
+    }
+    return best;
+  }
+
+  // Whether the element pointer val is only loaded from or stored to,
+  // possibly through casts. Any arithmetic on it (e.g. &tile[0][0] + y * W)
+  // would keep the width of the unpadded rows.
+  static bool isElementAccess(Value *val) {
+    for (User *user : val->users()) {
+      if (isa<LoadInst>(user)) continue;
+      if (StoreInst *store = dyn_cast<StoreInst>(user)) {
+        if (store->getValueOperand() == val) return false;
+      } else if (isa<BitCastOperator>(user) ||
+                 isa<AddrSpaceCastInst>(user) ||
+                 getSharedToGeneric(user)) {
+        if (!isElementAccess(user)) return false;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether idx, an index into a row of the given length, stays inside the
+  // row. Flattened indices (tile[0][0][y * W + x], as InstCombine leaves
+  // them) reach the following rows, whose elements move with the padding.
+  bool isInRow(Value *idx, uint64_t length, GEPOperator *gep) {
+    if (ConstantInt *constant = dyn_cast<ConstantInt>(idx))
+      return constant->getValue().ult(length);
+
+    Instruction *inst = dyn_cast<Instruction>(gep);
+    if (!inst) return false;
+    ScalarEvolution &SE =
+      getAnalysis<ScalarEvolution>(*inst->getParent()->getParent());
+    return SE.getUnsignedRange(SE.getSCEV(idx)).getUnsignedMax().ult(length);
+  }
+
+  // Whether every use of the rows of val goes through GEPs that index
+  // them, so the rows can grow without changing the element addresses
+  bool canRetarget(Value *val, ArrayType *row) {
+    for (User *user : val->users()) {
+      GEPOperator *gep = dyn_cast<GEPOperator>(user);
+      if (!gep || gep->getPointerOperand() != val) return false;
+
+      gep_type_iterator type = gep_type_begin(gep);
+      for (auto idx = gep->idx_begin(), E = gep->idx_end(); idx != E;
+           ++idx, ++type) {
+        if (*type == row && !isInRow(*idx, row->getNumElements(), gep))
+          return false;
+      }
+
+      Type *elem = gep->getType()->getPointerElementType();
+      if (getRows(elem, row) ? !canRetarget(gep, row) : !isElementAccess(gep))
+        return false;
+    }
+    return true;
+  }
+
+  bool canPad(GlobalVariable *array) {
+    if (!array->hasLocalLinkage()) return false;
+    if (array->hasInitializer() && !isa<UndefValue>(array->getInitializer()) &&
+        !array->getInitializer()->isNullValue())
+      return false;
+
+    array->removeDeadConstantUsers();
+    return canRetarget(array, getRowType(array));
+  }
+
+  static Type *padType(Type *type, ArrayType *row, ArrayType *padded) {
+    if (type == row) return padded;
+    ArrayType *array = cast<ArrayType>(type);
+    return ArrayType::get(padType(array->getElementType(), row, padded),
+                          array->getNumElements());
+  }
+
+  // Rebuilds the GEPs over old on top of ptr, whose rows are padded
+  static void retarget(Value *old, Value *ptr) {
+    SmallVector<User *, 8> users(old->user_begin(), old->user_end());
+    for (User *user : users) {
+      GEPOperator *gep = cast<GEPOperator>(user);
+      SmallVector<Value *, 4> idx(gep->idx_begin(), gep->idx_end());
+
+      Value *copy;
+      if (GetElementPtrInst *inst = dyn_cast<GetElementPtrInst>(gep)) {
+        GetElementPtrInst *copyInst =
+          GetElementPtrInst::Create(ptr, idx, inst->getName() + ".pad", inst);
+        copyInst->setIsInBounds(inst->isInBounds());
+        copyInst->setDebugLoc(inst->getDebugLoc());
+        copy = copyInst;
+      } else {
+        SmallVector<Constant *, 4> constIdx;
+        for (Value *val : idx)
+          constIdx.push_back(cast<Constant>(val));
+        copy = ConstantExpr::getGetElementPtr(cast<Constant>(ptr), constIdx,
+                                              gep->isInBounds());
+      }
+
+      if (copy->getType() == gep->getType())
+        gep->replaceAllUsesWith(copy);
+      else
+        retarget(gep, copy);
+
+      if (Instruction *inst = dyn_cast<Instruction>(gep))
+        inst->eraseFromParent();
+    }
+  }
+
+  void padArray(GlobalVariable *array, unsigned pad) {
+    ArrayType *row = getRowType(array);
+    ArrayType *padded = ArrayType::get(row->getElementType(),
+                                       row->getNumElements() + pad);
+    Type *type = padType(array->getType()->getElementType(), row, padded);
+
+    DEBUG(errs() << "Padding rows of " << array->getName() << " with "
+                 << pad << " elements\n");
+
+    Constant *init = NULL;
+    if (array->hasInitializer())
+      init = isa<UndefValue>(array->getInitializer()) ?
+        UndefValue::get(type) : Constant::getNullValue(type);
+
+    GlobalVariable *copy =
+      new GlobalVariable(*array->getParent(), type, array->isConstant(),
+                         array->getLinkage(), init,
+                         array->getName() + ".pad", array,
+                         array->getThreadLocalMode(), 3);
+    copy->setAlignment(array->getAlignment());
+
+    retarget(array, copy);
+    array->removeDeadConstantUsers();
+    copy->takeName(array);
+    array->eraseFromParent();
+  }
+};
+
+char BankConflicts::ID;
+
+static RegisterPass<BankConflicts>
+X("cudarrays-bank-conflicts",
+  "Pad shared memory arrays whose accesses have bank conflicts",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
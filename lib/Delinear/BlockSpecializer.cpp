@@ -0,0 +1,163 @@
+#include <set>
+#include <string>
+
+#include "BlockSpecializer.h"
+
+#include "CUDArraysSymbols.h"
+#include "KernelClones.h"
+
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/Local.h"
+#include "llvm/Transforms/Utils/ValueMapper.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "delinear"
+
+STATISTIC(NumBoundaryGuards, "Number of boundary guards folded in the interior clones");
+STATISTIC(NumInteriorClones, "Number of interior kernel clones");
+
+namespace platonic {
+
+static bool contains(const SymExpr &expr, SymExpr::Kind kind) {
+  if (expr.kind == kind) return true;
+  for (const SymExpr &op : expr.ops)
+    if (contains(op, kind)) return true;
+  return false;
+}
+
+// Same value in every thread of the launch
+static bool isLaunchInvariant(const SymExpr &expr) {
+  return !contains(expr, SymExpr::SymThreadIdx) &&
+         !contains(expr, SymExpr::SymBlockIdx) &&
+         !contains(expr, SymExpr::SymAddRec);
+}
+
+// Only comparisons that steer control flow are guards
+static bool isGuard(const ICmpInst *cmp) {
+  for (const User *user : cmp->users()) {
+    if (isa<BranchInst>(user) || isa<PHINode>(user)) continue;
+
+    const BinaryOperator *op = dyn_cast<BinaryOperator>(user);
+    if (op && (op->getOpcode() == Instruction::And ||
+               op->getOpcode() == Instruction::Or)) continue;
+
+    return false;
+  }
+  return !cmp->use_empty();
+}
+
+BlockSpecializer::BlockSpecializer(ScalarEvolution &SE,
+                                   const SymbolIndex &symbols,
+                                   const AllocaToArgMap &argMap) :
+  SE_(SE), builder_(SE, symbols, argMap), fun_(NULL) {}
+
+bool BlockSpecializer::analyzeGuard(ICmpInst *cmp) {
+  if (cmp->isEquality() || !cmp->getOperand(0)->getType()->isIntegerTy())
+    return false;
+  if (!isGuard(cmp)) return false;
+
+  SymExpr lhs, rhs;
+  if (!builder_.lower(SE_.getSCEV(cmp->getOperand(0)), lhs) ||
+      !builder_.lower(SE_.getSCEV(cmp->getOperand(1)), rhs))
+    return false;
+
+  // Orient as index pred bound
+  CmpInst::Predicate pred = cmp->getPredicate();
+  if (isLaunchInvariant(lhs)) {
+    std::swap(lhs, rhs);
+    pred = CmpInst::getSwappedPredicate(pred);
+  }
+  // Loop conditions are left alone
+  if (!contains(lhs, SymExpr::SymBlockIdx) ||
+      contains(lhs, SymExpr::SymAddRec) || !isLaunchInvariant(rhs))
+    return false;
+
+  // Constant bounds are lower bounds (e.g. x >= 1) and the others upper
+  // bounds (e.g. x < n). The guard is true in the interior blocks when it
+  // checks that the index is in range and false otherwise.
+  bool isLower = rhs.kind == SymExpr::SymConst;
+  bool isLess = pred == CmpInst::ICMP_SLT || pred == CmpInst::ICMP_SLE ||
+                pred == CmpInst::ICMP_ULT || pred == CmpInst::ICMP_ULE;
+  bool fold = isLower != isLess;
+  if (!fold) pred = CmpInst::getInversePredicate(pred);
+
+  // Normalize the condition that must hold to lhs < rhs or lhs <= rhs
+  BlockGuard guard;
+  guard.isSigned = CmpInst::isSigned(pred);
+  if (isLower) {
+    // bound < index or bound <= index
+    guard.isStrict = pred == CmpInst::ICMP_SGT || pred == CmpInst::ICMP_UGT;
+    guard.lhs = rhs;
+    guard.rhs = lhs;
+  } else {
+    guard.isStrict = pred == CmpInst::ICMP_SLT || pred == CmpInst::ICMP_ULT;
+    guard.lhs = lhs;
+    guard.rhs = rhs;
+  }
+
+  DEBUG(errs() << "Boundary guard" << *cmp << " folds to " << fold << "\n");
+
+  folds_.push_back(std::make_pair(cmp, fold));
+  guards_.push_back(guard);
+  return true;
+}
+
+bool BlockSpecializer::analyze(Function &fun) {
+  fun_ = &fun;
+  folds_.clear();
+  guards_.clear();
+
+  for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    if (ICmpInst *cmp = dyn_cast<ICmpInst>(&*it))
+      analyzeGuard(cmp);
+  }
+
+  // Guards repeated in several places are evaluated once
+  std::vector<BlockGuard> guards;
+  std::set<std::string> seen;
+  for (const BlockGuard &guard : guards_) {
+    std::string key;
+    raw_string_ostream out(key);
+    out << guard.isStrict << guard.isSigned << " ";
+    guard.lhs.print(out);
+    out << " ";
+    guard.rhs.print(out);
+    if (seen.insert(out.str()).second)
+      guards.push_back(guard);
+  }
+  guards_.swap(guards);
+
+  return !folds_.empty();
+}
+
+Function *BlockSpecializer::createInteriorClone() const {
+  ValueToValueMapTy VMap;
+  Function *clone = cloneKernel(*fun_, "_interior", VMap);
+
+  for (auto &fold : folds_) {
+    ICmpInst *cmp = cast<ICmpInst>(VMap[fold.first]);
+    cmp->replaceAllUsesWith(ConstantInt::get(cmp->getType(), fold.second));
+    cmp->eraseFromParent();
+    ++NumBoundaryGuards;
+  }
+
+  for (BasicBlock &bb : *clone)
+    ConstantFoldTerminator(&bb);
+  removeUnreachableBlocks(*clone);
+
+  ++NumInteriorClones;
+  return clone;
+}
+
+}
+
+// vim: set ts=2 sw=2:
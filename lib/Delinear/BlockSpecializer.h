@@ -0,0 +1,62 @@
+#ifndef BLOCK_SPECIALIZER_H
+#define BLOCK_SPECIALIZER_H
+
+#include <vector>
+
+#include "SymExpr.h"
+
+namespace llvm {
+class Function;
+class ICmpInst;
+class ScalarEvolution;
+}
+
+namespace platonic {
+
+class SymbolIndex;
+
+// Condition under which a boundary guard is constant: lhs < rhs (or
+// lhs <= rhs) for every thread of the blocks in the launch. Unsigned
+// guards also need both sides to be non-negative.
+struct BlockGuard {
+  bool isStrict;
+  bool isSigned;
+  SymExpr lhs;
+  SymExpr rhs;
+
+  BlockGuard() : isStrict(true), isSigned(true) {}
+};
+
+// Splits a kernel into an interior and a boundary version. Boundary guards
+// compare an index that depends on the block index against a bound that
+// is fixed for the launch (e.g. if (x < A.get_dim(1))). In the interior
+// blocks they take the same value in every thread, so the interior clone
+// has them folded. The original kernel is the boundary version.
+class BlockSpecializer {
+ public:
+  BlockSpecializer(llvm::ScalarEvolution &SE, const SymbolIndex &symbols,
+                   const AllocaToArgMap &argMap);
+
+  // Returns whether fun has any boundary guard
+  bool analyze(llvm::Function &fun);
+
+  const std::vector<BlockGuard> &getGuards() const { return guards_; }
+
+  // Clones the kernel into <name>_interior with the guards folded
+  llvm::Function *createInteriorClone() const;
+
+ private:
+  llvm::ScalarEvolution &SE_;
+  SymExprBuilder builder_;
+
+  llvm::Function *fun_;
+  // Guard comparisons and the value they take in the interior blocks
+  std::vector<std::pair<llvm::ICmpInst *, bool> > folds_;
+  std::vector<BlockGuard> guards_;
+
+  bool analyzeGuard(llvm::ICmpInst *cmp);
+};
+
+}
+
+#endif // BLOCK_SPECIALIZER_H
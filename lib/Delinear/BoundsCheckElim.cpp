@@ -0,0 +1,252 @@
+#include "llvm/Pass.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/IR/CFG.h"
+#include "llvm/IR/Dominators.h"
+#include "llvm/IR/InstrTypes.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/BasicBlockUtils.h"
+#include "llvm/Transforms/Utils/Local.h"
+
+#include "CUDArraysSymbols.h"
+#include "LaunchBounds.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-bce"
+
+STATISTIC(NumChecks,        "Number of bounds checks found");
+STATISTIC(NumChecksRemoved, "Number of bounds checks removed");
+
+namespace platonic {
+
+// Removes the bounds checks (branches to a block that calls a noreturn
+// function, such as abort, and ends in unreachable) that can be proven to
+// never fail. The proofs use the ScalarEvolution ranges, the launch bounds
+// of the thread and block indices and the conditions of the dominating
+// branches (e.g. if (i < n)).
+class BoundsCheckElim : public ModulePass {
+  // A comparison known to hold
+  struct Fact {
+    CmpInst::Predicate pred;
+    Value *lhs;
+    Value *rhs;
+  };
+
+ public:
+  static char ID;
+  BoundsCheckElim() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+
+    for (Function &fun : M) {
+      if (fun.isDeclaration()) continue;
+
+      // Must happen before ScalarEvolution looks at the function
+      result |= annotateRegisterRanges(fun, symbols);
+      result |= runOnFunction(fun);
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DominatorTreeWrapperPass>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  static bool isTrapBlock(const BasicBlock *bb) {
+    if (!isa<UnreachableInst>(bb->getTerminator())) return false;
+    for (const Instruction &inst : *bb) {
+      if (const CallInst *call = dyn_cast<CallInst>(&inst))
+        if (call->doesNotReturn()) return true;
+    }
+    return false;
+  }
+
+  // Checks often branch to a block that jumps to a shared trap block
+  static bool leadsToTrap(const BasicBlock *bb) {
+    if (isTrapBlock(bb)) return true;
+
+    const BranchInst *br = dyn_cast<BranchInst>(bb->getTerminator());
+    return br && br->isUnconditional() && bb->size() == 1 &&
+           isTrapBlock(br->getSuccessor(0));
+  }
+
+  // Comparisons that hold when cond evaluates to 'holds'. Returns false
+  // when cond is not fully described by the collected facts.
+  static bool collectFacts(Value *cond, bool holds,
+                           SmallVectorImpl<Fact> &facts) {
+    if (ICmpInst *cmp = dyn_cast<ICmpInst>(cond)) {
+      Fact fact = { holds ? cmp->getPredicate() : cmp->getInversePredicate(),
+                    cmp->getOperand(0), cmp->getOperand(1) };
+      facts.push_back(fact);
+      return true;
+    }
+
+    BinaryOperator *op = dyn_cast<BinaryOperator>(cond);
+    if (!op) return false;
+
+    // a && b holds: both hold. a || b fails: both fail.
+    if ((op->getOpcode() == Instruction::And && holds) ||
+        (op->getOpcode() == Instruction::Or && !holds)) {
+      bool lhs = collectFacts(op->getOperand(0), holds, facts);
+      bool rhs = collectFacts(op->getOperand(1), holds, facts);
+      return lhs && rhs;
+    }
+    return false;
+  }
+
+  // Rewrites a > b and a >= b as b < a and b <= a
+  static Fact normalize(Fact fact) {
+    if ((fact.pred == ICmpInst::ICMP_SGT || fact.pred == ICmpInst::ICMP_SGE ||
+         fact.pred == ICmpInst::ICMP_UGT || fact.pred == ICmpInst::ICMP_UGE)) {
+      std::swap(fact.lhs, fact.rhs);
+      fact.pred = ICmpInst::getSwappedPredicate(fact.pred);
+    }
+    return fact;
+  }
+
+  static bool isStrict(CmpInst::Predicate pred) {
+    return pred == ICmpInst::ICMP_SLT || pred == ICmpInst::ICMP_ULT;
+  }
+
+  // Whether guard implies check. Both are normalized to < or <=.
+  static bool implies(ScalarEvolution &SE, Fact guard, Fact check) {
+    guard = normalize(guard);
+    check = normalize(check);
+    if (!ICmpInst::isRelational(guard.pred) ||
+        !ICmpInst::isRelational(check.pred))
+      return false;
+
+    const SCEV *GA = SE.getSCEV(guard.lhs), *GB = SE.getSCEV(guard.rhs);
+    const SCEV *CA = SE.getSCEV(check.lhs), *CB = SE.getSCEV(check.rhs);
+    if (GA->getType() != CA->getType()) return false;
+
+    bool guardSigned = ICmpInst::isSigned(guard.pred);
+    bool checkSigned = ICmpInst::isSigned(check.pred);
+    if (guardSigned != checkSigned) {
+      // 0 <= a <s b implies a <u b, and a <u b with b >=s 0 implies a <s b
+      if (GA != CA || GB != CB) return false;
+      if (guardSigned && !SE.isKnownNonNegative(CA)) return false;
+      if (!guardSigned && !SE.isKnownNonNegative(CB)) return false;
+      return isStrict(guard.pred) || !isStrict(check.pred);
+    }
+
+    ICmpInst::Predicate LE = checkSigned ? ICmpInst::ICMP_SLE
+                                         : ICmpInst::ICMP_ULE;
+    ICmpInst::Predicate LT = checkSigned ? ICmpInst::ICMP_SLT
+                                         : ICmpInst::ICMP_ULT;
+    auto le = [&](const SCEV *a, const SCEV *b) {
+      return a == b || SE.isKnownPredicate(LE, a, b);
+    };
+    auto lt = [&](const SCEV *a, const SCEV *b) {
+      return SE.isKnownPredicate(LT, a, b);
+    };
+
+    // CA <= GA < GB <= CB
+    if (isStrict(guard.pred) || !isStrict(check.pred))
+      return le(CA, GA) && le(GB, CB);
+    // CA <= GA <= GB <= CB with one of the steps strict
+    return (lt(CA, GA) && le(GB, CB)) || (le(CA, GA) && lt(GB, CB));
+  }
+
+  static bool isKnown(ScalarEvolution &SE, DominatorTree &DT,
+                      BasicBlock *bb, const Fact &check) {
+    if (!check.lhs->getType()->isIntegerTy()) return false;
+
+    if (SE.isKnownPredicate(check.pred, SE.getSCEV(check.lhs),
+                            SE.getSCEV(check.rhs)))
+      return true;
+
+    // Conditions of the branches whose taken edge dominates the check
+    for (DomTreeNode *node = DT.getNode(bb)->getIDom(); node;
+         node = node->getIDom()) {
+      BasicBlock *dom = node->getBlock();
+      BranchInst *br = dyn_cast<BranchInst>(dom->getTerminator());
+      if (!br || !br->isConditional()) continue;
+
+      for (unsigned succ = 0; succ < 2; ++succ) {
+        if (br->getSuccessor(0) == br->getSuccessor(1)) break;
+        if (!DT.dominates(BasicBlockEdge(dom, br->getSuccessor(succ)), bb))
+          continue;
+
+        SmallVector<Fact, 4> facts;
+        collectFacts(br->getCondition(), succ == 0, facts);
+        for (const Fact &fact : facts)
+          if (implies(SE, fact, check)) return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool runOnFunction(Function &fun) {
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    DominatorTree &DT = getAnalysis<DominatorTreeWrapperPass>(fun).getDomTree();
+
+    // Prove every check before changing the CFG
+    SmallVector<std::pair<BranchInst *, unsigned>, 16> removable;
+    for (BasicBlock &bb : fun) {
+      BranchInst *br = dyn_cast<BranchInst>(bb.getTerminator());
+      if (!br || !br->isConditional()) continue;
+
+      bool trap0 = leadsToTrap(br->getSuccessor(0));
+      bool trap1 = leadsToTrap(br->getSuccessor(1));
+      if (trap0 == trap1) continue;
+      ++NumChecks;
+
+      // The condition must always take the edge that does not trap
+      // Only a conjunction of comparisons can be proven piecewise
+      SmallVector<Fact, 4> checks;
+      if (!collectFacts(br->getCondition(), trap1, checks)) continue;
+
+      bool proven = true;
+      for (const Fact &check : checks)
+        proven = proven && isKnown(SE, DT, &bb, check);
+
+      DEBUG(errs() << (proven ? "Proven: " : "Kept: ")
+                   << *br->getCondition() << "\n");
+      if (proven)
+        removable.push_back(std::make_pair(br, unsigned(trap0 ? 0 : 1)));
+    }
+
+    for (auto &check : removable) {
+      BranchInst *br = check.first;
+      BasicBlock *bb = br->getParent();
+      BasicBlock *trap = br->getSuccessor(check.second);
+      BasicBlock *safe = br->getSuccessor(1 - check.second);
+
+      Value *cond = br->getCondition();
+      trap->removePredecessor(bb);
+      BranchInst::Create(safe, br);
+      br->eraseFromParent();
+      RecursivelyDeleteTriviallyDeadInstructions(cond);
+
+      if (pred_begin(trap) == pred_end(trap))
+        DeleteDeadBlock(trap);
+
+      ++NumChecksRemoved;
+    }
+
+    return !removable.empty();
+  }
+};
+
+char BoundsCheckElim::ID;
+
+static RegisterPass<BoundsCheckElim>
+X("cudarrays-bce", "Remove the provably redundant dynarray bounds checks",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
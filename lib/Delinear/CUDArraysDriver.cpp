@@ -1,6 +1,7 @@
 #include "CUDArraysDriver.h"
 
 #include "llvm/ADT/Triple.h"
+#include "llvm/IR/Constants.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
@@ -16,12 +17,157 @@ File("cudarrayFile",
 
 namespace platonic {
 
+namespace {
+
+// Range [lo, hi] of the values of an index expression
+struct Bounds {
+  Value *lo;
+  Value *hi;
+};
+
+// Emits the interval arithmetic of the footprint evaluators. All the
+// values are computed as signed 64-bit integers.
+class BoundsEmitter {
+  IRBuilder<> &B;
+  Value *args_;
+  Value *dims_;
+  Value *launch_;
+  Type *int64Ty_;
+
+  Value *getLaunch(unsigned field) {
+    Value *ptr = B.CreateConstGEP1_32(launch_, field);
+    return B.CreateSExt(B.CreateLoad(ptr), int64Ty_);
+  }
+
+  Value *getConst(int64_t value) {
+    return ConstantInt::get(int64Ty_, value, true);
+  }
+
+  Bounds add(const Bounds &a, const Bounds &b) {
+    Bounds ret = { B.CreateAdd(a.lo, b.lo), B.CreateAdd(a.hi, b.hi) };
+    return ret;
+  }
+
+  // The unsigned max is one of its operands. It matches the signed one
+  // when both are non-negative; otherwise a negative operand wins and
+  // only the hull of the operands is known.
+  Bounds umax(const Bounds &a, const Bounds &b) {
+    Value *zero = getConst(0);
+    Value *positive = B.CreateAnd(B.CreateICmpSGE(a.lo, zero),
+                                  B.CreateICmpSGE(b.lo, zero));
+    Bounds ret = { B.CreateSelect(positive, max(a.lo, b.lo), min(a.lo, b.lo)),
+                   max(a.hi, b.hi) };
+    return ret;
+  }
+
+  Bounds mul(const Bounds &a, const Bounds &b) {
+    Value *p0 = B.CreateMul(a.lo, b.lo);
+    Value *p1 = B.CreateMul(a.lo, b.hi);
+    Value *p2 = B.CreateMul(a.hi, b.lo);
+    Value *p3 = B.CreateMul(a.hi, b.hi);
+    Bounds ret = { min(min(p0, p1), min(p2, p3)),
+                   max(max(p0, p1), max(p2, p3)) };
+    return ret;
+  }
+
+ public:
+  BoundsEmitter(IRBuilder<> &B, Value *args, Value *dims, Value *launch) :
+    B(B), args_(args), dims_(dims), launch_(launch),
+    int64Ty_(B.getInt64Ty()) {}
+
+  Value *min(Value *a, Value *b) {
+    return B.CreateSelect(B.CreateICmpSLT(a, b), a, b);
+  }
+
+  Value *max(Value *a, Value *b) {
+    return B.CreateSelect(B.CreateICmpSGT(a, b), a, b);
+  }
+
+  Bounds emit(const SymExpr &expr) {
+    Bounds ret = { NULL, NULL };
+    switch (expr.kind) {
+    case SymExpr::SymConst:
+      ret.lo = ret.hi = getConst(expr.value);
+      break;
+    case SymExpr::SymParam: {
+      Value *ptr = B.CreateLoad(B.CreateConstGEP1_32(args_, expr.arg));
+      Type *type = B.getIntNTy(expr.index);
+      ptr = B.CreateBitCast(ptr, type->getPointerTo());
+      ret.lo = ret.hi = B.CreateSExtOrTrunc(B.CreateLoad(ptr), int64Ty_);
+      break;
+    }
+    case SymExpr::SymDim: {
+      Value *dims = B.CreateLoad(B.CreateConstGEP1_32(dims_, expr.arg));
+      ret.lo = ret.hi = B.CreateLoad(B.CreateConstGEP1_32(dims, expr.index));
+      break;
+    }
+    case SymExpr::SymThreadIdx:
+      ret.lo = getConst(0);
+      ret.hi = B.CreateSub(getLaunch(LaunchBlockDim + expr.index),
+                           getConst(1));
+      break;
+    case SymExpr::SymBlockIdx:
+      ret.lo = getLaunch(LaunchBlockBegin + expr.index);
+      ret.hi = B.CreateSub(getLaunch(LaunchBlockEnd + expr.index),
+                           getConst(1));
+      break;
+    case SymExpr::SymBlockSize:
+      ret.lo = ret.hi = getLaunch(LaunchBlockDim + expr.index);
+      break;
+    case SymExpr::SymBlockOffset:
+      ret.lo = ret.hi = getLaunch(LaunchBlockOffset + expr.index);
+      break;
+    case SymExpr::SymAdd:
+    case SymExpr::SymMul:
+    case SymExpr::SymSMax:
+    case SymExpr::SymUMax:
+      ret = emit(expr.ops[0]);
+      for (unsigned i = 1; i < expr.ops.size(); ++i) {
+        Bounds op = emit(expr.ops[i]);
+        if (expr.kind == SymExpr::SymAdd) {
+          ret = add(ret, op);
+        } else if (expr.kind == SymExpr::SymMul) {
+          ret = mul(ret, op);
+        } else if (expr.kind == SymExpr::SymSMax) {
+          ret.lo = max(ret.lo, op.lo);
+          ret.hi = max(ret.hi, op.hi);
+        } else {
+          ret = umax(ret, op);
+        }
+      }
+      break;
+    case SymExpr::SymUDiv: {
+      // Indices are non-negative, avoid dividing by zero
+      Bounds lhs = emit(expr.ops[0]);
+      Bounds rhs = emit(expr.ops[1]);
+      ret.lo = B.CreateSDiv(lhs.lo, max(rhs.hi, getConst(1)));
+      ret.hi = B.CreateSDiv(lhs.hi, max(rhs.lo, getConst(1)));
+      break;
+    }
+    case SymExpr::SymAddRec: {
+      // start + step * [0, count]
+      Bounds start = emit(expr.ops[0]);
+      Bounds step = emit(expr.ops[1]);
+      Bounds count = emit(expr.ops[2]);
+      Bounds iters = { getConst(0), max(count.hi, getConst(0)) };
+      ret = add(start, mul(step, iters));
+      break;
+    }
+    }
+    return ret;
+  }
+};
+
+}
+
 CUDArraysDriver::CUDArraysDriver() :
   C(new llvm::LLVMContext()),
   M(new llvm::Module("", *C)),
   voidTy(Type::getVoidTy(*C)),
   int1Ty(Type::getInt1Ty(*C)),
+  int8Ty(Type::getInt8Ty(*C)),
   int32Ty(Type::getInt32Ty(*C)),
+  int64Ty(Type::getInt64Ty(*C)),
   int8PtrTy(Type::getInt8PtrTy(*C)),
   builder(*C) {
 
@@ -49,6 +195,113 @@ CUDArraysDriver::CUDArraysDriver() :
       M->getOrInsertFunction("cudarrays_compiler_set_array_dim_info", funTy);
   }
 
+  {
+    // int64_t (*)(void **args, int64_t **dims, const int32_t *launch,
+    //             uint8_t upper)
+    Type *typeList[] = { int8PtrTy->getPointerTo(),
+                         int64Ty->getPointerTo()->getPointerTo(),
+                         int32Ty->getPointerTo(), int8Ty };
+    boundsTy = FunctionType::get(int64Ty, ArrayRef<Type *>(typeList), false);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int32Ty,
+                         boundsTy->getPointerTo() };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setArrayDimBounds =
+      M->getOrInsertFunction("cudarrays_compiler_set_array_dim_bounds", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setArrayLayoutHint =
+      M->getOrInsertFunction("cudarrays_compiler_set_array_layout_hint", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setArrayDecomposition =
+      M->getOrInsertFunction("cudarrays_compiler_set_array_decomposition", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int32Ty, int64Ty, int64Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setArrayDimHalo =
+      M->getOrInsertFunction("cudarrays_compiler_set_array_dim_halo", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int8PtrTy };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setArrayConstant =
+      M->getOrInsertFunction("cudarrays_compiler_set_array_constant", funTy);
+  }
+
+  {
+    // uint8_t (*)(void **args, int64_t **dims, const int32_t *launch)
+    Type *typeList[] = { int8PtrTy->getPointerTo(),
+                         int64Ty->getPointerTo()->getPointerTo(),
+                         int32Ty->getPointerTo() };
+    interiorTy = FunctionType::get(int8Ty, ArrayRef<Type *>(typeList), false);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int8PtrTy, interiorTy->getPointerTo() };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelInterior =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_interior", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int8PtrTy, int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelClone =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_clone", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int8PtrTy, int32Ty, int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelCoarsening =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_coarsening", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int8PtrTy, int8PtrTy,
+                         int32Ty->getPointerTo(), int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelFusion =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_fusion", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int64Ty, int64Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelIntensity =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_intensity", funTy);
+  }
+
+  {
+    Type *typeList[] = { int8PtrTy, int32Ty, int32Ty, int32Ty };
+    FunctionType *funTy =
+      FunctionType::get(voidTy, ArrayRef<Type *>(typeList), false);
+    setKernelTimeSteps =
+      M->getOrInsertFunction("cudarrays_compiler_set_kernel_time_steps", funTy);
+  }
+
   {
     FunctionType *funTy = FunctionType::get(voidTy, false);
     Value *regInfo =
@@ -83,6 +336,11 @@ Value *CUDArraysDriver::getFunctionPointer(Function *f) {
   return builder.CreateBitCast(fun, int8PtrTy);
 }
 
+bool CUDArraysDriver::isRegistered(const Function *f) const {
+  // Kernel declarations are only added to the module when registered
+  return M->getFunction(f->getName()) != NULL;
+}
+
 void CUDArraysDriver::insertResetInfo(Function *f) {
   FunctionType *funTy = f->getFunctionType();
   M->getOrInsertFunction(f->getName(), funTy);
@@ -119,6 +377,184 @@ void CUDArraysDriver::insertSetArrayDimInfo(Argument *array,
                       ConstantInt::get(int32Ty, gridDim));
 }
 
+// The evaluator returns the lowest (upper == 0) or highest index used to
+// access the dimension when the kernel runs the blocks in launch
+void CUDArraysDriver::insertSetArrayDimBounds(Argument *array, unsigned dim,
+                                              const std::vector<SymExpr> &indices) {
+  Function *f = array->getParent();
+
+  std::string name = (f->getName() + ".bounds." + Twine(array->getArgNo()) +
+                      "." + Twine(dim)).str();
+  Function *eval =
+    Function::Create(boundsTy, GlobalValue::InternalLinkage, name, M);
+
+  Function::arg_iterator arg = eval->arg_begin();
+  Value *args = &*arg++;
+  Value *dims = &*arg++;
+  Value *launch = &*arg++;
+  Value *upper = &*arg++;
+  args->setName("args");
+  dims->setName("dims");
+  launch->setName("launch");
+  upper->setName("upper");
+
+  IRBuilder<> B(BasicBlock::Create(*C, "", eval));
+  BoundsEmitter emitter(B, args, dims, launch);
+
+  Bounds bounds = emitter.emit(indices[0]);
+  for (unsigned i = 1; i < indices.size(); ++i) {
+    Bounds index = emitter.emit(indices[i]);
+    bounds.lo = emitter.min(bounds.lo, index.lo);
+    bounds.hi = emitter.max(bounds.hi, index.hi);
+  }
+
+  Value *isUpper = B.CreateICmpNE(upper, ConstantInt::get(int8Ty, 0));
+  B.CreateRet(B.CreateSelect(isUpper, bounds.hi, bounds.lo));
+
+  builder.CreateCall4(setArrayDimBounds,
+                      getFunctionPointer(f),
+                      ConstantInt::get(int32Ty, array->getArgNo()),
+                      ConstantInt::get(int32Ty, dim),
+                      eval);
+}
+
+void CUDArraysDriver::insertSetArrayLayoutHint(Argument *array, unsigned dim) {
+  Function *f = array->getParent();
+  builder.CreateCall3(setArrayLayoutHint,
+                      getFunctionPointer(f),
+                      ConstantInt::get(int32Ty, array->getArgNo()),
+                      ConstantInt::get(int32Ty, dim));
+}
+
+void CUDArraysDriver::insertSetArrayDecomposition(Argument *array,
+                                                  const ArrayDecomposition &decomp) {
+  Function *f = array->getParent();
+  Value *fun = getFunctionPointer(f);
+  Value *argNo = ConstantInt::get(int32Ty, array->getArgNo());
+
+  builder.CreateCall3(setArrayDecomposition, fun, argNo,
+                      ConstantInt::get(int32Ty, decomp.getMask()));
+
+  for (unsigned i = 0; i < decomp.dims.size(); ++i)
+    builder.CreateCall5(setArrayDimHalo, fun, argNo,
+                        ConstantInt::get(int32Ty, decomp.dims[i]),
+                        ConstantInt::get(int64Ty, decomp.halos[i].lo),
+                        ConstantInt::get(int64Ty, decomp.halos[i].hi));
+}
+
+void CUDArraysDriver::insertSetArrayConstant(Argument *array, StringRef symbol) {
+  Function *f = array->getParent();
+  builder.CreateCall3(setArrayConstant,
+                      getFunctionPointer(f),
+                      ConstantInt::get(int32Ty, array->getArgNo()),
+                      builder.CreateGlobalStringPtr(symbol));
+}
+
+// The evaluator returns whether the interior clone can run the blocks in
+// launch, i.e. whether every guard holds in all their threads
+void CUDArraysDriver::insertSetKernelInterior(Function *f, Function *interior,
+                                              const std::vector<BlockGuard> &guards) {
+  std::string name = (f->getName() + ".interior").str();
+  Function *eval =
+    Function::Create(interiorTy, GlobalValue::InternalLinkage, name, M);
+
+  Function::arg_iterator arg = eval->arg_begin();
+  Value *args = &*arg++;
+  Value *dims = &*arg++;
+  Value *launch = &*arg++;
+  args->setName("args");
+  dims->setName("dims");
+  launch->setName("launch");
+
+  IRBuilder<> B(BasicBlock::Create(*C, "", eval));
+  BoundsEmitter emitter(B, args, dims, launch);
+
+  Value *zero = ConstantInt::get(int64Ty, 0);
+  Value *holds = B.getTrue();
+  for (const BlockGuard &guard : guards) {
+    Bounds lhs = emitter.emit(guard.lhs);
+    Bounds rhs = emitter.emit(guard.rhs);
+
+    Value *cond = guard.isStrict? B.CreateICmpSLT(lhs.hi, rhs.lo):
+                                  B.CreateICmpSLE(lhs.hi, rhs.lo);
+    if (!guard.isSigned) {
+      cond = B.CreateAnd(cond, B.CreateICmpSGE(lhs.lo, zero));
+      cond = B.CreateAnd(cond, B.CreateICmpSGE(rhs.lo, zero));
+    }
+    holds = B.CreateAnd(holds, cond);
+  }
+
+  B.CreateRet(B.CreateZExt(holds, int8Ty));
+
+  builder.CreateCall3(setKernelInterior,
+                      getFunctionPointer(f),
+                      getFunctionPointer(interior),
+                      eval);
+}
+
+// kind: conditions (KernelCloneKind mask) under which the clone can run
+void CUDArraysDriver::insertSetKernelClone(Function *f, Function *clone,
+                                           unsigned kind) {
+  builder.CreateCall3(setKernelClone,
+                      getFunctionPointer(f),
+                      getFunctionPointer(clone),
+                      ConstantInt::get(int32Ty, kind));
+}
+
+void CUDArraysDriver::insertSetKernelCoarsening(Function *f, Function *clone,
+                                                unsigned gridDim,
+                                                unsigned factor) {
+  builder.CreateCall4(setKernelCoarsening,
+                      getFunctionPointer(f),
+                      getFunctionPointer(clone),
+                      ConstantInt::get(int32Ty, gridDim),
+                      ConstantInt::get(int32Ty, factor));
+}
+
+// shared: array pairs that may share storage in the fused kernel
+void CUDArraysDriver::insertSetKernelFusion(Function *producer,
+                                            Function *consumer,
+                                            Function *fused,
+                                            const std::vector<SharedArray> &shared) {
+  // { producer arg, consumer arg, ... }
+  std::vector<Constant *> elems;
+  for (const SharedArray &array : shared) {
+    elems.push_back(ConstantInt::get(int32Ty, array.first));
+    elems.push_back(ConstantInt::get(int32Ty, array.second));
+  }
+  ArrayType *pairsTy = ArrayType::get(int32Ty, elems.size());
+  GlobalVariable *pairs =
+    new GlobalVariable(*M, pairsTy, true, GlobalValue::InternalLinkage,
+                       ConstantArray::get(pairsTy, elems),
+                       fused->getName() + ".shared");
+
+  builder.CreateCall5(setKernelFusion,
+                      getFunctionPointer(producer),
+                      getFunctionPointer(consumer),
+                      getFunctionPointer(fused),
+                      builder.CreateConstGEP2_32(pairs, 0, 0),
+                      ConstantInt::get(int32Ty, shared.size()));
+}
+
+void CUDArraysDriver::insertSetKernelIntensity(Function *f,
+                                               const KernelIntensity &intensity) {
+  builder.CreateCall4(setKernelIntensity,
+                      getFunctionPointer(f),
+                      ConstantInt::get(int32Ty, intensity.blockSize),
+                      ConstantInt::get(int64Ty, intensity.bytes),
+                      ConstantInt::get(int64Ty, intensity.flops));
+}
+
+void CUDArraysDriver::insertSetKernelTimeSteps(Function *f,
+                                               const TemporalStencil &stencil,
+                                               unsigned steps) {
+  builder.CreateCall4(setKernelTimeSteps,
+                      getFunctionPointer(f),
+                      ConstantInt::get(int32Ty, stencil.inArg),
+                      ConstantInt::get(int32Ty, stencil.outArg),
+                      ConstantInt::get(int32Ty, steps));
+}
+
 }
 
 // vim: set ts=2 sw=2:
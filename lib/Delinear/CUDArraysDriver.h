@@ -1,8 +1,18 @@
 #ifndef CUDA_ARRAYS_DRIVER_H
 #define CUDA_ARRAYS_DRIVER_H
 
+#include <vector>
+
 #include "llvm/IR/IRBuilder.h"
 
+#include "BlockSpecializer.h"
+#include "KernelClones.h"
+#include "KernelFusion.h"
+#include "KernelIntensity.h"
+#include "PartitionPlanner.h"
+#include "TemporalBlocking.h"
+#include "SymExpr.h"
+
 namespace llvm {
 class Argument;
 class BasicBlock;
@@ -18,6 +28,9 @@ class CUDArraysDriver {
   CUDArraysDriver();
   ~CUDArraysDriver();
 
+  // Whether info for the kernel has already been inserted
+  bool isRegistered(const llvm::Function *fun) const;
+
   void insertResetInfo(llvm::Function *fun);
 
   // dims: number of dimensions of the array
@@ -32,18 +45,87 @@ class CUDArraysDriver {
   void insertSetArrayDimInfo(llvm::Argument *array,
                              unsigned dim, unsigned gridDim);
 
+  // Emits an evaluator of the lowest/highest index used to access the array
+  // dimension and registers it
+  // indices: index expressions of the accesses to the dimension
+  void insertSetArrayDimBounds(llvm::Argument *array, unsigned dim,
+                               const std::vector<SymExpr> &indices);
+
+  // Registers that the array is an array of records better laid out as
+  // arrays of fields, i.e. with dimension dim outermost
+  void insertSetArrayLayoutHint(llvm::Argument *array, unsigned dim);
+
+  // Registers the dimensions of the array that can be split across a grid
+  // of devices and the halo each of them needs
+  void insertSetArrayDecomposition(llvm::Argument *array,
+                                   const ArrayDecomposition &decomp);
+
+  // Registers the constant memory symbol the kernel reads the array from,
+  // for the runtime to copy the array to it before every launch
+  void insertSetArrayConstant(llvm::Argument *array, llvm::StringRef symbol);
+
+  // Emits an evaluator of whether the boundary guards hold in every thread
+  // of a block range and registers the interior clone of the kernel
+  // guards: conditions the interior clone relies on
+  void insertSetKernelInterior(llvm::Function *fun, llvm::Function *interior,
+                               const std::vector<BlockGuard> &guards);
+
+  // Registers a specialized clone of the kernel
+  // kind: conditions (KernelCloneKind mask) under which the clone can run
+  void insertSetKernelClone(llvm::Function *fun, llvm::Function *clone,
+                            unsigned kind);
+
+  // Registers a clone of the kernel that runs factor blocks of the
+  // original per block along gridDim. The runtime only uses it for grids
+  // whose size along gridDim is a multiple of factor.
+  void insertSetKernelCoarsening(llvm::Function *fun, llvm::Function *clone,
+                                 unsigned gridDim, unsigned factor);
+
+  // Registers the fusion of back-to-back launches of producer and consumer
+  // shared: array pairs that may share storage in the fused kernel
+  void insertSetKernelFusion(llvm::Function *producer,
+                             llvm::Function *consumer, llvm::Function *fused,
+                             const std::vector<SharedArray> &shared);
+
+  // Registers the estimated work of a thread block of the kernel, for the
+  // scheduler to tell compute bound kernels from memory bound ones
+  void insertSetKernelIntensity(llvm::Function *fun,
+                                const KernelIntensity &intensity);
+
+  // Registers that the kernel may run steps launches, swapping the arrays
+  // of the stencil, per halo exchange. The runtime widens the launches
+  // through the block offset, as described in TemporalBlocking.h.
+  void insertSetKernelTimeSteps(llvm::Function *fun,
+                                const TemporalStencil &stencil,
+                                unsigned steps);
+
  private:
   llvm::LLVMContext *C;
   llvm::Module *M;
   llvm::Type *voidTy;
   llvm::Type *int1Ty;
+  llvm::Type *int8Ty;
   llvm::Type *int32Ty;
+  llvm::Type *int64Ty;
   llvm::Type *int8PtrTy;
   llvm::IRBuilder<> builder;
 
   llvm::Value *resetInfo;
   llvm::Value *setArrayInfo;
   llvm::Value *setArrayDimInfo;
+  llvm::Value *setArrayDimBounds;
+  llvm::Value *setArrayLayoutHint;
+  llvm::Value *setArrayDecomposition;
+  llvm::Value *setArrayDimHalo;
+  llvm::Value *setArrayConstant;
+  llvm::Value *setKernelInterior;
+  llvm::Value *setKernelClone;
+  llvm::Value *setKernelCoarsening;
+  llvm::Value *setKernelFusion;
+  llvm::Value *setKernelIntensity;
+  llvm::Value *setKernelTimeSteps;
+  llvm::FunctionType *boundsTy;
+  llvm::FunctionType *interiorTy;
 
   llvm::Value *getFunctionPointer(llvm::Function *fun);
 };
@@ -1,3 +1,4 @@
+#include <sstream>
 #include <string>
 
 #include "CUDArraysRTDriver.h"
@@ -19,6 +20,39 @@ void\n\
 cudarrays_compiler_set_array_info(const void *fun, unsigned arrayArgIdx, unsigned ndims, uint8_t isRead, uint8_t isWritten);\n\
 void\n\
 cudarrays_compiler_set_array_dim_info(const void *fun, unsigned arrayArgIdx, unsigned arrayDim, unsigned gridDim);\n\
+void\n\
+cudarrays_compiler_set_array_dim_bounds(const void *fun, unsigned arrayArgIdx, unsigned arrayDim, int64_t (*bounds)(void **args, int64_t **dims, const int32_t *launch, uint8_t upper));\n\
+void\n\
+cudarrays_compiler_set_array_layout_hint(const void *fun, unsigned arrayArgIdx, unsigned arrayDim);\n\
+void\n\
+cudarrays_compiler_set_array_decomposition(const void *fun, unsigned arrayArgIdx, unsigned splitDims);\n\
+void\n\
+cudarrays_compiler_set_array_dim_halo(const void *fun, unsigned arrayArgIdx, unsigned arrayDim, int64_t lo, int64_t hi);\n\
+void\n\
+cudarrays_compiler_set_array_constant(const void *fun, unsigned arrayArgIdx, const char *symbol);\n\
+void\n\
+cudarrays_compiler_set_kernel_interior(const void *fun, const void *interior, uint8_t (*isInterior)(void **args, int64_t **dims, const int32_t *launch));\n\
+void\n\
+cudarrays_compiler_set_kernel_clone(const void *fun, const void *clone, unsigned kind);\n\
+void\n\
+cudarrays_compiler_set_kernel_coarsening(const void *fun, const void *clone, unsigned gridDim, unsigned factor);\n\
+void\n\
+cudarrays_compiler_set_kernel_fusion(const void *producer, const void *consumer, const void *fused, const unsigned *shared, unsigned nshared);\n\
+void\n\
+cudarrays_compiler_set_kernel_intensity(const void *fun, unsigned blockSize, uint64_t bytes, uint64_t flops);\n\
+void\n\
+cudarrays_compiler_set_kernel_time_steps(const void *fun, unsigned inArrayArgIdx, unsigned outArrayArgIdx, unsigned steps);\n\
+\n";
+
+static const std::string bounds_helpers =
+"\
+static inline int64_t\n\
+cudarrays_min(int64_t a, int64_t b) { return a < b? a: b; }\n\
+static inline int64_t\n\
+cudarrays_max(int64_t a, int64_t b) { return a > b? a: b; }\n\
+static inline int64_t\n\
+cudarrays_umax_lo(int64_t a, int64_t b)\n\
+{ return a >= 0 && b >= 0? cudarrays_max(a, b): cudarrays_min(a, b); }\n\
 \n";
 
 static cl::opt<std::string>
@@ -28,6 +62,131 @@ FileRT("cudarrays_rt",
 
 namespace platonic {
 
+namespace {
+
+// Emits C statements for the interval arithmetic of the footprint
+// evaluators. Each expression gets a pair of lo/hi variables.
+class BoundsWriter {
+  std::ostream &out_;
+  unsigned next_;
+
+  using bounds = std::pair<std::string, std::string>;
+
+  bounds define(const std::string &lo, const std::string &hi) {
+    std::ostringstream id;
+    id << next_++;
+    out_ << "    const int64_t lo" << id.str() << " = " << lo << ";\n";
+    out_ << "    const int64_t hi" << id.str() << " = " << hi << ";\n";
+    return bounds("lo" + id.str(), "hi" + id.str());
+  }
+
+  static std::string call(const char *fun, const std::string &a,
+                          const std::string &b) {
+    return std::string(fun) + "(" + a + ", " + b + ")";
+  }
+
+  static std::string getLaunch(unsigned field) {
+    std::ostringstream ret;
+    ret << "(int64_t)launch[" << field << "]";
+    return ret.str();
+  }
+
+  static const char *getIntType(unsigned bits) {
+    if (bits <= 8)  return "int8_t";
+    if (bits <= 16) return "int16_t";
+    if (bits <= 32) return "int32_t";
+    return "int64_t";
+  }
+
+  bounds add(const bounds &a, const bounds &b) {
+    return define(a.first + " + " + b.first, a.second + " + " + b.second);
+  }
+
+  // The unsigned max is one of its operands. It matches the signed one
+  // when both are non-negative; otherwise a negative operand wins and
+  // only the hull of the operands is known.
+  bounds umax(const bounds &a, const bounds &b) {
+    return define(call("cudarrays_umax_lo", a.first, b.first),
+                  call("cudarrays_max", a.second, b.second));
+  }
+
+  bounds mul(const bounds &a, const bounds &b) {
+    bounds p = define(a.first + " * " + b.first, a.first + " * " + b.second);
+    bounds q = define(a.second + " * " + b.first, a.second + " * " + b.second);
+    return define(call("cudarrays_min", call("cudarrays_min", p.first, p.second),
+                                        call("cudarrays_min", q.first, q.second)),
+                  call("cudarrays_max", call("cudarrays_max", p.first, p.second),
+                                        call("cudarrays_max", q.first, q.second)));
+  }
+
+ public:
+  explicit BoundsWriter(std::ostream &out) : out_(out), next_(0) {}
+
+  bounds emit(const SymExpr &expr) {
+    std::ostringstream val;
+    switch (expr.kind) {
+    case SymExpr::SymConst:
+      val << "INT64_C(" << expr.value << ")";
+      return define(val.str(), val.str());
+    case SymExpr::SymParam:
+      val << "(int64_t)*(const " << getIntType(expr.index) << " *)args["
+          << expr.arg << "]";
+      return define(val.str(), val.str());
+    case SymExpr::SymDim:
+      val << "dims[" << expr.arg << "][" << expr.index << "]";
+      return define(val.str(), val.str());
+    case SymExpr::SymThreadIdx:
+      return define("0", getLaunch(LaunchBlockDim + expr.index) + " - 1");
+    case SymExpr::SymBlockIdx:
+      return define(getLaunch(LaunchBlockBegin + expr.index),
+                    getLaunch(LaunchBlockEnd + expr.index) + " - 1");
+    case SymExpr::SymBlockSize:
+      return define(getLaunch(LaunchBlockDim + expr.index),
+                    getLaunch(LaunchBlockDim + expr.index));
+    case SymExpr::SymBlockOffset:
+      return define(getLaunch(LaunchBlockOffset + expr.index),
+                    getLaunch(LaunchBlockOffset + expr.index));
+    case SymExpr::SymAdd:
+    case SymExpr::SymMul:
+    case SymExpr::SymSMax:
+    case SymExpr::SymUMax: {
+      bounds ret = emit(expr.ops[0]);
+      for (unsigned i = 1; i < expr.ops.size(); ++i) {
+        bounds op = emit(expr.ops[i]);
+        if (expr.kind == SymExpr::SymAdd)
+          ret = add(ret, op);
+        else if (expr.kind == SymExpr::SymMul)
+          ret = mul(ret, op);
+        else if (expr.kind == SymExpr::SymSMax)
+          ret = define(call("cudarrays_max", ret.first, op.first),
+                       call("cudarrays_max", ret.second, op.second));
+        else
+          ret = umax(ret, op);
+      }
+      return ret;
+    }
+    case SymExpr::SymUDiv: {
+      // Indices are non-negative, avoid dividing by zero
+      bounds lhs = emit(expr.ops[0]);
+      bounds rhs = emit(expr.ops[1]);
+      return define(lhs.first + " / " + call("cudarrays_max", rhs.second, "1"),
+                    lhs.second + " / " + call("cudarrays_max", rhs.first, "1"));
+    }
+    case SymExpr::SymAddRec: {
+      // start + step * [0, count]
+      bounds start = emit(expr.ops[0]);
+      bounds step = emit(expr.ops[1]);
+      bounds count = emit(expr.ops[2]);
+      bounds iters = define("0", call("cudarrays_max", count.second, "0"));
+      return add(start, mul(step, iters));
+    }
+    }
+    return bounds("0", "0");
+  }
+};
+
+}
+
 CUDArraysRTDriver::CUDArraysRTDriver()
 {
 }
@@ -56,8 +215,41 @@ CUDArraysRTDriver::~CUDArraysRTDriver()
   for (const std::string &kernel : kernels_) {
     file_ << "extern void *" << kernel << ";\n";
   }
+  for (const kernel_interior &info : kernelInterior_) {
+    file_ << "extern void *" << std::get<1>(info) << ";\n";
+  }
+  for (const kernel_clone &info : kernelClones_) {
+    file_ << "extern void *" << std::get<1>(info) << ";\n";
+  }
+  for (const kernel_coarsening &info : kernelCoarsening_) {
+    file_ << "extern void *" << std::get<1>(info) << ";\n";
+  }
+  for (const kernel_fusion &info : kernelFusion_) {
+    file_ << "extern void *" << std::get<2>(info) << ";\n";
+  }
   file_ << "\n";
 
+  if (!kernelFusion_.empty()) {
+    file_ << "/* Arrays that may share storage in the fused kernels: producer arg, consumer arg */\n";
+    for (const kernel_fusion &info : kernelFusion_) {
+      file_ << "static const unsigned __cudarrays_shared_" << std::get<2>(info) << "[] = { ";
+      for (const SharedArray &array : std::get<3>(info)) {
+        file_ << array.first << ", " << array.second << ", ";
+      }
+      // Empty arrays are not valid C
+      file_ << "0 };\n";
+    }
+    file_ << "\n";
+  }
+
+  if (!evaluators_.empty()) {
+    file_ << "/* Array footprint evaluators */\n";
+    file_ << bounds_helpers;
+    for (const std::string &evaluator : evaluators_) {
+      file_ << evaluator << "\n";
+    }
+  }
+
   file_ << "__attribute__((constructor))\n";
   file_ << "void __cudarrays_compiler_register_info()\n";
   file_ << "{\n";
@@ -90,6 +282,121 @@ CUDArraysRTDriver::~CUDArraysRTDriver()
     file_ << std::get<3>(info);
     file_ << ");\n";
   }
+  file_ << "\n";
+
+  file_ << "    /* Register array dimension bounds */\n";
+  for (const array_dim_bounds &info : arrayDimBounds_) {
+    file_ << "    cudarrays_compiler_set_array_dim_bounds(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << ", ";
+    file_ << std::get<3>(info);
+    file_ << ");\n";
+  }
+  file_ << "\n";
+
+  file_ << "    /* Register array layout hints */\n";
+  for (const array_layout_hint &info : arrayLayoutHints_) {
+    file_ << "    cudarrays_compiler_set_array_layout_hint(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info);
+    file_ << ");\n";
+  }
+  file_ << "\n";
+
+  file_ << "    /* Register array decompositions */\n";
+  for (const array_decomposition &info : arrayDecompositions_) {
+    file_ << "    cudarrays_compiler_set_array_decomposition(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info);
+    file_ << ");\n";
+  }
+  for (const array_dim_halo &info : arrayDimHalos_) {
+    file_ << "    cudarrays_compiler_set_array_dim_halo(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << ", ";
+    file_ << std::get<3>(info) << ", ";
+    file_ << std::get<4>(info);
+    file_ << ");\n";
+  }
+  file_ << "\n";
+
+  file_ << "    /* Register arrays read from constant memory */\n";
+  for (const array_constant &info : arrayConstants_) {
+    file_ << "    cudarrays_compiler_set_array_constant(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << "\"" << std::get<2>(info) << "\"";
+    file_ << ");\n";
+  }
+  file_ << "\n";
+
+  file_ << "    /* Register interior kernels */\n";
+  for (const kernel_interior &info : kernelInterior_) {
+    file_ << "    cudarrays_compiler_set_kernel_interior(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info);
+    file_ << ");\n";
+  }
+
+  file_ << "\n";
+  file_ << "    /* Register coarsened kernels: kernel, clone, grid dimension, factor.\n";
+  file_ << "       The clones have no remainder blocks: grids whose size along the\n";
+  file_ << "       dimension is not a multiple of factor run the kernel. */\n";
+  for (const kernel_coarsening &info : kernelCoarsening_) {
+    file_ << "    cudarrays_compiler_set_kernel_coarsening(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << ", ";
+    file_ << std::get<3>(info);
+    file_ << ");\n";
+  }
+  file_ << "\n";
+  file_ << "    /* Register fused kernels */\n";
+  for (const kernel_fusion &info : kernelFusion_) {
+    file_ << "    cudarrays_compiler_set_kernel_fusion(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << ", ";
+    file_ << "__cudarrays_shared_" << std::get<2>(info) << ", ";
+    file_ << std::get<3>(info).size();
+    file_ << ");\n";
+  }
+  file_ << "\n";
+  file_ << "    /* Register kernel intensities: kernel, threads, bytes and FLOPs per block */\n";
+  for (const kernel_intensity &info : kernelIntensity_) {
+    file_ << "    cudarrays_compiler_set_kernel_intensity(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << "ull, ";
+    file_ << std::get<3>(info) << "ull";
+    file_ << ");\n";
+  }
+  file_ << "\n";
+  file_ << "    /* Register stencil time steps per halo exchange: kernel, in array, out array,\n";
+  file_ << "       steps. Launch t runs the kernel with the block offset moved to cover the\n";
+  file_ << "       partition widened by steps - t - 1 halos of one step. */\n";
+  for (const kernel_time_steps &info : kernelTimeSteps_) {
+    file_ << "    cudarrays_compiler_set_kernel_time_steps(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info) << ", ";
+    file_ << std::get<3>(info);
+    file_ << ");\n";
+  }
+  file_ << "\n";
+  file_ << "    /* Register kernel clones: kernel, clone, KernelCloneKind mask */\n";
+  for (const kernel_clone &info : kernelClones_) {
+    file_ << "    cudarrays_compiler_set_kernel_clone(";
+    file_ << std::get<0>(info) << ", ";
+    file_ << std::get<1>(info) << ", ";
+    file_ << std::get<2>(info);
+    file_ << ");\n";
+  }
 
   file_ << "}";
 
@@ -123,6 +430,134 @@ void CUDArraysRTDriver::insertSetArrayDimInfo(Argument *array,
   arrayDimInfo_.push_back(array_dim_info(f->getName().str(), array->getArgNo(), dim, gridDim));
 }
 
+// The evaluator returns the lowest (upper == 0) or highest index used to
+// access the dimension when the kernel runs the blocks in launch
+void CUDArraysRTDriver::insertSetArrayDimBounds(Argument *array, unsigned dim,
+                                                const std::vector<SymExpr> &indices)
+{
+  Function *f = array->getParent();
+
+  std::ostringstream name;
+  name << "__cudarrays_bounds_" << f->getName().str() << "_"
+       << array->getArgNo() << "_" << dim;
+
+  std::ostringstream out;
+  out << "static int64_t\n";
+  out << name.str()
+      << "(void **args, int64_t **dims, const int32_t *launch, uint8_t upper)\n";
+  out << "{\n";
+
+  BoundsWriter writer(out);
+  std::pair<std::string, std::string> bounds = writer.emit(indices[0]);
+  std::string lo = bounds.first, hi = bounds.second;
+  for (unsigned i = 1; i < indices.size(); ++i) {
+    bounds = writer.emit(indices[i]);
+    lo = "cudarrays_min(" + lo + ", " + bounds.first + ")";
+    hi = "cudarrays_max(" + hi + ", " + bounds.second + ")";
+  }
+
+  out << "    return upper? " << hi << ": " << lo << ";\n";
+  out << "}\n";
+
+  evaluators_.push_back(out.str());
+  arrayDimBounds_.push_back(array_dim_bounds(f->getName().str(), array->getArgNo(), dim, name.str()));
+}
+
+void CUDArraysRTDriver::insertSetArrayLayoutHint(Argument *array, unsigned dim)
+{
+  Function *f = array->getParent();
+
+  arrayLayoutHints_.push_back(array_layout_hint(f->getName().str(), array->getArgNo(), dim));
+}
+
+void CUDArraysRTDriver::insertSetArrayDecomposition(Argument *array,
+                                                    const ArrayDecomposition &decomp)
+{
+  Function *f = array->getParent();
+
+  arrayDecompositions_.push_back(array_decomposition(f->getName().str(), array->getArgNo(), decomp.getMask()));
+  for (unsigned i = 0; i < decomp.dims.size(); ++i)
+    arrayDimHalos_.push_back(array_dim_halo(f->getName().str(), array->getArgNo(), decomp.dims[i],
+                                            decomp.halos[i].lo, decomp.halos[i].hi));
+}
+
+void CUDArraysRTDriver::insertSetArrayConstant(Argument *array, StringRef symbol)
+{
+  Function *f = array->getParent();
+
+  arrayConstants_.push_back(array_constant(f->getName().str(), array->getArgNo(), symbol.str()));
+}
+
+// The evaluator returns whether the interior clone can run the blocks in
+// launch, i.e. whether every guard holds in all their threads
+void CUDArraysRTDriver::insertSetKernelInterior(Function *f, Function *interior,
+                                                const std::vector<BlockGuard> &guards)
+{
+  std::string name = "__cudarrays_interior_" + f->getName().str();
+
+  std::ostringstream out;
+  out << "static uint8_t\n";
+  out << name << "(void **args, int64_t **dims, const int32_t *launch)\n";
+  out << "{\n";
+
+  BoundsWriter writer(out);
+  for (const BlockGuard &guard : guards) {
+    std::pair<std::string, std::string> lhs = writer.emit(guard.lhs);
+    std::pair<std::string, std::string> rhs = writer.emit(guard.rhs);
+
+    out << "    if (!(" << lhs.second << (guard.isStrict? " < ": " <= ")
+        << rhs.first << ")) return 0;\n";
+    if (!guard.isSigned)
+      out << "    if (" << lhs.first << " < 0 || " << rhs.first
+          << " < 0) return 0;\n";
+  }
+
+  out << "    return 1;\n";
+  out << "}\n";
+
+  evaluators_.push_back(out.str());
+  kernelInterior_.push_back(kernel_interior(f->getName().str(), interior->getName().str(), name));
+}
+
+// kind: conditions (KernelCloneKind mask) under which the clone can run
+void CUDArraysRTDriver::insertSetKernelClone(Function *f, Function *clone,
+                                             unsigned kind)
+{
+  kernelClones_.push_back(kernel_clone(f->getName().str(), clone->getName().str(), kind));
+}
+
+void CUDArraysRTDriver::insertSetKernelCoarsening(Function *f, Function *clone,
+                                                  unsigned gridDim,
+                                                  unsigned factor)
+{
+  kernelCoarsening_.push_back(kernel_coarsening(f->getName().str(), clone->getName().str(), gridDim, factor));
+}
+
+// shared: array pairs that may share storage in the fused kernel
+void CUDArraysRTDriver::insertSetKernelFusion(Function *producer,
+                                              Function *consumer,
+                                              Function *fused,
+                                              const std::vector<SharedArray> &shared)
+{
+  kernelFusion_.push_back(kernel_fusion(producer->getName().str(), consumer->getName().str(),
+                                        fused->getName().str(), shared));
+}
+
+void CUDArraysRTDriver::insertSetKernelIntensity(Function *f,
+                                                 const KernelIntensity &intensity)
+{
+  kernelIntensity_.push_back(kernel_intensity(f->getName().str(), intensity.blockSize,
+                                              intensity.bytes, intensity.flops));
+}
+
+void CUDArraysRTDriver::insertSetKernelTimeSteps(Function *f,
+                                                 const TemporalStencil &stencil,
+                                                 unsigned steps)
+{
+  kernelTimeSteps_.push_back(kernel_time_steps(f->getName().str(), stencil.inArg,
+                                               stencil.outArg, steps));
+}
+
 }
 
 // vim: set ts=2 sw=2:
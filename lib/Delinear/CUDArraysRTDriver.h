@@ -2,9 +2,18 @@
 #define CUDA_ARRAYS_RT_DRIVER_H
 
 #include <fstream>
+#include <vector>
 
 #include "llvm/IR/IRBuilder.h"
 
+#include "BlockSpecializer.h"
+#include "KernelClones.h"
+#include "KernelFusion.h"
+#include "KernelIntensity.h"
+#include "PartitionPlanner.h"
+#include "TemporalBlocking.h"
+#include "SymExpr.h"
+
 namespace llvm {
 class Argument;
 class BasicBlock;
@@ -34,13 +43,91 @@ public:
   void insertSetArrayDimInfo(llvm::Argument *array,
                              unsigned dim, unsigned gridDim);
 
+  // Emits an evaluator of the lowest/highest index used to access the array
+  // dimension and registers it
+  // indices: index expressions of the accesses to the dimension
+  void insertSetArrayDimBounds(llvm::Argument *array, unsigned dim,
+                               const std::vector<SymExpr> &indices);
+
+  // Registers that the array is an array of records better laid out as
+  // arrays of fields, i.e. with dimension dim outermost
+  void insertSetArrayLayoutHint(llvm::Argument *array, unsigned dim);
+
+  // Registers the dimensions of the array that can be split across a grid
+  // of devices and the halo each of them needs
+  void insertSetArrayDecomposition(llvm::Argument *array,
+                                   const ArrayDecomposition &decomp);
+
+  // Registers the constant memory symbol the kernel reads the array from,
+  // for the runtime to copy the array to it before every launch
+  void insertSetArrayConstant(llvm::Argument *array, llvm::StringRef symbol);
+
+  // Emits an evaluator of whether the boundary guards hold in every thread
+  // of a block range and registers the interior clone of the kernel
+  // guards: conditions the interior clone relies on
+  void insertSetKernelInterior(llvm::Function *fun, llvm::Function *interior,
+                               const std::vector<BlockGuard> &guards);
+
+  // Registers a specialized clone of the kernel
+  // kind: conditions (KernelCloneKind mask) under which the clone can run
+  void insertSetKernelClone(llvm::Function *fun, llvm::Function *clone,
+                            unsigned kind);
+
+  // Registers a clone of the kernel that runs factor blocks of the
+  // original per block along gridDim. The runtime only uses it for grids
+  // whose size along gridDim is a multiple of factor.
+  void insertSetKernelCoarsening(llvm::Function *fun, llvm::Function *clone,
+                                 unsigned gridDim, unsigned factor);
+
+  // Registers the fusion of back-to-back launches of producer and consumer
+  // shared: array pairs that may share storage in the fused kernel
+  void insertSetKernelFusion(llvm::Function *producer,
+                             llvm::Function *consumer, llvm::Function *fused,
+                             const std::vector<SharedArray> &shared);
+
+  // Registers the estimated work of a thread block of the kernel, for the
+  // scheduler to tell compute bound kernels from memory bound ones
+  void insertSetKernelIntensity(llvm::Function *fun,
+                                const KernelIntensity &intensity);
+
+  // Registers that the kernel may run steps launches, swapping the arrays
+  // of the stencil, per halo exchange. The runtime widens the launches
+  // through the block offset, as described in TemporalBlocking.h.
+  void insertSetKernelTimeSteps(llvm::Function *fun,
+                                const TemporalStencil &stencil,
+                                unsigned steps);
+
 private:
   using array_info     = std::tuple<std::string, unsigned, unsigned, bool, bool>;
   using array_dim_info = std::tuple<std::string, unsigned, unsigned, unsigned>;
+  using array_dim_bounds = std::tuple<std::string, unsigned, unsigned, std::string>;
+  using array_layout_hint = std::tuple<std::string, unsigned, unsigned>;
+  using array_decomposition = std::tuple<std::string, unsigned, unsigned>;
+  using array_dim_halo = std::tuple<std::string, unsigned, unsigned, int64_t, int64_t>;
+  using array_constant = std::tuple<std::string, unsigned, std::string>;
+  using kernel_interior = std::tuple<std::string, std::string, std::string>;
+  using kernel_clone    = std::tuple<std::string, std::string, unsigned>;
+  using kernel_coarsening = std::tuple<std::string, std::string, unsigned, unsigned>;
+  using kernel_fusion   = std::tuple<std::string, std::string, std::string, std::vector<SharedArray> >;
+  using kernel_intensity = std::tuple<std::string, uint64_t, uint64_t, uint64_t>;
+  using kernel_time_steps = std::tuple<std::string, unsigned, unsigned, unsigned>;
 
   std::vector<std::string>    kernels_;
   std::vector<array_info>     arrayInfo_;
   std::vector<array_dim_info> arrayDimInfo_;
+  std::vector<array_dim_bounds> arrayDimBounds_;
+  std::vector<array_layout_hint> arrayLayoutHints_;
+  std::vector<array_decomposition> arrayDecompositions_;
+  std::vector<array_dim_halo> arrayDimHalos_;
+  std::vector<array_constant> arrayConstants_;
+  std::vector<kernel_interior> kernelInterior_;
+  std::vector<kernel_clone>    kernelClones_;
+  std::vector<kernel_coarsening> kernelCoarsening_;
+  std::vector<kernel_fusion>   kernelFusion_;
+  std::vector<kernel_intensity> kernelIntensity_;
+  std::vector<kernel_time_steps> kernelTimeSteps_;
+  // Definitions of the evaluators
+  std::vector<std::string>    evaluators_;
 
   std::ofstream file_;
 };
@@ -0,0 +1,156 @@
+#include <cstdlib>
+#include <cxxabi.h>
+
+#include "CUDArraysSymbols.h"
+
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+std::string demangle_symbol(const char *str) {
+  int status;
+  char *trans = abi::__cxa_demangle(str, NULL, NULL, &status);
+  if (!trans) return str;
+
+  std::string ret(trans);
+  free(trans);
+  return ret;
+}
+
+const AllocaInst *findAllocaSource(const Value *V) {
+  if (const AllocaInst *alloca = dyn_cast<AllocaInst>(V))
+    return alloca;
+
+  if (const BitCastInst *bitcast = dyn_cast<BitCastInst>(V))
+    return findAllocaSource(bitcast->getOperand(0));
+
+  const CallInst *call = dyn_cast<CallInst>(V);
+  if (!call) return NULL;
+
+  Function *fun = call->getCalledFunction();
+  if (!fun) return NULL;
+  if (!fun->getName().startswith("llvm.nvvm.ptr.gen.to.")) return NULL;
+  if (fun->arg_size() != 1) return NULL;
+
+  return findAllocaSource(call->getArgOperand(0));
+}
+
+struct RegisterInfo {
+  const char *name;
+  const char *translation;
+  SymbolKind kind;
+  unsigned gridDim;
+};
+
+static const RegisterInfo CudaRegisters[] = {
+  { "llvm.nvvm.read.ptx.sreg.ctaid.x", "b.x", SymbolBlockIdx, 0 },
+  { "llvm.nvvm.read.ptx.sreg.ctaid.y", "b.y", SymbolBlockIdx, 1 },
+  { "llvm.nvvm.read.ptx.sreg.ctaid.z", "b.z", SymbolBlockIdx, 2 },
+
+  { "llvm.nvvm.read.ptx.sreg.tid.x", "t.x", SymbolThreadIdx, 0 },
+  { "llvm.nvvm.read.ptx.sreg.tid.y", "t.y", SymbolThreadIdx, 1 },
+  { "llvm.nvvm.read.ptx.sreg.tid.z", "t.z", SymbolThreadIdx, 2 },
+
+  { "llvm.nvvm.read.ptx.sreg.ntid.x", "bsize.x", SymbolBlockSize, 0 },
+  { "llvm.nvvm.read.ptx.sreg.ntid.y", "bsize.y", SymbolBlockSize, 1 },
+  { "llvm.nvvm.read.ptx.sreg.ntid.z", "bsize.z", SymbolBlockSize, 2 },
+};
+
+static const RegisterInfo *findRegister(StringRef name) {
+  for (const RegisterInfo &reg : CudaRegisters) {
+    if (name == reg.name) return &reg;
+  }
+  return NULL;
+}
+
+// Huge hack to detect kernels
+static bool isKernelName(const std::string &name) {
+  return name.find("_kernel(") != std::string::npos ||
+         name.find("_kernel<") != std::string::npos ||
+         (name.find("_kernel_") != std::string::npos &&
+          name.find("_<") == std::string::npos &&
+          name.find("_(") == std::string::npos);
+}
+
+SymbolIndex::SymbolIndex(const Module &M) {
+  for (const Function &fun : M) {
+    StringRef mangled = fun.getName();
+    SymbolInfo info;
+
+    if (const RegisterInfo *reg = findRegister(mangled)) {
+      info.kind = reg->kind;
+      info.gridDim = reg->gridDim;
+      info.translation = reg->translation;
+      symbols_[&fun] = info;
+      continue;
+    }
+
+    if (mangled.startswith("llvm.")) continue;
+
+    if (mangled.count("cudarrays") &&
+        (mangled.count("array_storage") || mangled.count("dynarray")))
+      info.kind |= SymbolArrayStorage;
+
+    info.demangled = demangle_symbol(mangled.data());
+    const std::string &name = info.demangled;
+
+    if (name.find("cudarrays::dynarray") == 0) {
+      if (name.find("operator()") != std::string::npos &&
+          !fun.doesNotReturn())
+        info.kind |= SymbolDynarrayAccessor;
+      if (name.find("get_dim") != std::string::npos)
+        info.kind |= SymbolDynarrayGetDim;
+    }
+
+    if (!fun.isDeclaration() && isKernelName(name))
+      info.kind |= SymbolKernel;
+
+    symbols_[&fun] = info;
+  }
+}
+
+const SymbolIndex::SymbolInfo *SymbolIndex::lookup(const Function *fun) const {
+  if (!fun) return NULL;
+
+  auto it = symbols_.find(fun);
+  if (it == symbols_.end()) return NULL;
+  return &it->second;
+}
+
+unsigned SymbolIndex::getKind(const Function *fun) const {
+  const SymbolInfo *info = lookup(fun);
+  return info ? info->kind : unsigned(SymbolNone);
+}
+
+unsigned SymbolIndex::getKind(const CallInst *call) const {
+  if (!call) return SymbolNone;
+  return getKind(call->getCalledFunction());
+}
+
+unsigned SymbolIndex::getKind(const Value *val) const {
+  return getKind(dyn_cast<CallInst>(val));
+}
+
+unsigned SymbolIndex::getGridDim(const Function *fun) const {
+  const SymbolInfo *info = lookup(fun);
+  assert(info && isCUDARegister(fun) && "Not a CUDA register");
+  return info->gridDim;
+}
+
+StringRef SymbolIndex::getTranslation(const Function *fun) const {
+  const SymbolInfo *info = lookup(fun);
+  return info ? StringRef(info->translation) : StringRef();
+}
+
+StringRef SymbolIndex::getDemangledName(const Function *fun) const {
+  const SymbolInfo *info = lookup(fun);
+  if (!info || info->demangled.empty()) return fun->getName();
+  return info->demangled;
+}
+
+}
+
+// vim: set ts=2 sw=2:
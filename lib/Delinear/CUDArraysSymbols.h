@@ -0,0 +1,88 @@
+#ifndef CUDA_ARRAYS_SYMBOLS_H
+#define CUDA_ARRAYS_SYMBOLS_H
+
+#include <string>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+
+namespace llvm {
+class AllocaInst;
+class CallInst;
+class Function;
+class Module;
+class Value;
+}
+
+namespace platonic {
+
+std::string demangle_symbol(const char *str);
+
+// Kernels copy their dynarray arguments to allocas. Returns the alloca a
+// dynarray pointer comes from, looking through bitcasts and address space
+// conversions, or NULL.
+const llvm::AllocaInst *findAllocaSource(const llvm::Value *V);
+
+enum SymbolKind {
+  SymbolNone             = 0,
+  // cudarrays::dynarray<...>::operator()
+  SymbolDynarrayAccessor = 1 << 0,
+  // cudarrays::dynarray<...>::get_dim
+  SymbolDynarrayGetDim   = 1 << 1,
+  // Any cudarrays::array_storage/dynarray member
+  SymbolArrayStorage     = 1 << 2,
+  // llvm.nvvm.read.ptx.sreg.tid.*
+  SymbolThreadIdx        = 1 << 3,
+  // llvm.nvvm.read.ptx.sreg.ctaid.*
+  SymbolBlockIdx         = 1 << 4,
+  // llvm.nvvm.read.ptx.sreg.ntid.*
+  SymbolBlockSize        = 1 << 5,
+  // Kernel entry point
+  SymbolKernel           = 1 << 6
+};
+
+// Classification of the functions of a module. It is built once per module
+// so that later queries do not need to demangle the callee names again.
+class SymbolIndex {
+  struct SymbolInfo {
+    unsigned kind;
+    // Grid dimension of CUDA register reads (0: x, 1: y, 2: z)
+    unsigned gridDim;
+    // Short name used in the access strings (e.g. "t.x", "b.y")
+    std::string translation;
+    std::string demangled;
+
+    SymbolInfo() : kind(SymbolNone), gridDim(0) {}
+  };
+
+  llvm::DenseMap<const llvm::Function *, SymbolInfo> symbols_;
+
+  const SymbolInfo *lookup(const llvm::Function *fun) const;
+
+ public:
+  explicit SymbolIndex(const llvm::Module &M);
+
+  unsigned getKind(const llvm::Function *fun) const;
+  unsigned getKind(const llvm::CallInst *call) const;
+  unsigned getKind(const llvm::Value *val) const;
+
+  bool is(const llvm::Function *fun, SymbolKind kind) const {
+    return getKind(fun) & kind;
+  }
+  bool is(const llvm::Value *val, SymbolKind kind) const {
+    return getKind(val) & kind;
+  }
+
+  bool isCUDARegister(const llvm::Function *fun) const {
+    return is(fun, SymbolKind(SymbolThreadIdx | SymbolBlockIdx |
+                              SymbolBlockSize));
+  }
+
+  unsigned getGridDim(const llvm::Function *fun) const;
+  llvm::StringRef getTranslation(const llvm::Function *fun) const;
+  llvm::StringRef getDemangledName(const llvm::Function *fun) const;
+};
+
+}
+
+#endif // CUDA_ARRAYS_SYMBOLS_H
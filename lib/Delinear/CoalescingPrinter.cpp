@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "llvm/Pass.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "CUDArraysSymbols.h"
+#include "DbgLinePrinter.h"
+#include "IRHelpers.h"
+#include "KernelIntensity.h"
+#include "LaunchBounds.h"
+#include "ThreadStride.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+// Global memory serves a warp with 32-byte sectors
+static const unsigned SectorSize = 32;
+static const unsigned WarpSize   = 32;
+
+// Estimates the global memory transactions of the kernels without running
+// them. For every load and store, the addresses of the 32 threads of a warp
+// are laid out from the threadIdx coefficients of the address (threads
+// fill a warp along x first, then y), and the 32-byte sectors they touch
+// are counted. The base address is assumed to be sector aligned. Accesses
+// whose address is not affine in threadIdx, e.g. indirect ones, are
+// counted as one sector per thread.
+//
+// The kernel totals weight every access by the trip counts of its loops,
+// so that kernels can be ranked by the bytes they move but do not use.
+//
+// The addresses of the dynarray accessors are opaque calls, so kernels
+// that still call them are skipped: -cudarrays-lower-accessors must run
+// first.
+class CoalescingPrinter : public ModulePass {
+  struct KernelCost {
+    std::string name;
+    double sectors;
+    double wasted;
+    double used;
+  };
+
+ public:
+  static char ID;
+  CoalescingPrinter() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    SymbolIndex symbols(M);
+    const DataLayout &DL = getAnalysis<DataLayoutPass>().getDataLayout();
+
+    std::vector<KernelCost> kernels;
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+      kernels.push_back(runOnKernel(fun, symbols, DL));
+    }
+
+    std::sort(kernels.begin(), kernels.end(),
+              [](const KernelCost &a, const KernelCost &b) {
+                return a.wasted > b.wasted;
+              });
+
+    errs() << "Kernels by wasted bytes per warp:\n";
+    for (const KernelCost &kernel : kernels) {
+      double moved = kernel.sectors * SectorSize;
+      errs() << "  " << kernel.name << ": "
+             << format("%.0f", kernel.wasted) << " of "
+             << format("%.0f", moved) << " bytes ("
+             << format("%.1f", moved ? 100 * kernel.used / moved : 100.0)
+             << "% efficiency)\n";
+    }
+
+    return false;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<LoopInfo>();
+    AU.addRequired<ScalarEvolution>();
+    AU.setPreservesAll();
+  }
+
+ private:
+  KernelCost runOnKernel(Function &fun, const SymbolIndex &symbols,
+                         const DataLayout &DL) {
+    LoopInfo &LI = getAnalysis<LoopInfo>(fun);
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    unsigned blockWidth = std::max(1u, getLaunchBounds(fun).maxBlockDim[0]);
+
+    KernelCost cost = { fun.getName(), 0, 0, 0 };
+    errs() << "Kernel " << fun.getName() << ":\n";
+    if (callsAccessors(fun, symbols)) {
+      errs() << "  dynarray accessors not lowered, skipped\n";
+      return cost;
+    }
+
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      Value *ptr = NULL;
+      Type *type = NULL;
+      if (LoadInst *load = dyn_cast<LoadInst>(&*it)) {
+        ptr = load->getPointerOperand();
+        type = load->getType();
+      } else if (StoreInst *store = dyn_cast<StoreInst>(&*it)) {
+        ptr = store->getPointerOperand();
+        type = store->getValueOperand()->getType();
+      }
+      if (!ptr || !isGlobalMemory(ptr)) continue;
+
+      uint64_t size = DL.getTypeStoreSize(type);
+      int64_t strideX = 0, strideY = 0;
+      bool affine = getThreadStride(ptr, 0, SE, symbols, strideX) &&
+        (blockWidth >= WarpSize ||
+         getThreadStride(ptr, 1, SE, symbols, strideY));
+
+      unsigned sectors = WarpSize * ((size + SectorSize - 1) / SectorSize);
+      uint64_t used = WarpSize * size;
+      if (affine)
+        countSectors(strideX, strideY, blockWidth, size, sectors, used);
+      uint64_t wasted = sectors * SectorSize - used;
+      double trips = getTripCount(LI.getLoopFor(it->getParent()), SE);
+
+      cost.sectors += trips * sectors;
+      cost.wasted += trips * wasted;
+      cost.used += trips * used;
+
+      errs() << "  ";
+      std::string file;
+      unsigned line;
+      if (getSourceLocation(&*it, file, line))
+        errs() << file << ":" << line << ": ";
+      errs() << (isa<LoadInst>(&*it) ? "load" : "store") << " of "
+             << size << " bytes, ";
+      if (affine)
+        errs() << "stride " << strideX << " bytes";
+      else
+        errs() << "irregular";
+      errs() << ": " << sectors << " transactions, " << wasted
+             << " wasted bytes, x" << format("%.0f", trips) << "\n";
+    }
+
+    double moved = cost.sectors * SectorSize;
+    errs() << "  total: " << format("%.0f", cost.sectors) << " transactions, "
+           << format("%.0f", cost.wasted) << " wasted bytes ("
+           << format("%.1f", moved ? 100 * cost.used / moved : 100.0)
+           << "% efficiency)\n";
+    return cost;
+  }
+
+  static bool callsAccessors(Function &fun, const SymbolIndex &symbols) {
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      CallInst *call = dyn_cast<CallInst>(&*it);
+      if (call && symbols.is(call, SymbolDynarrayAccessor)) return true;
+    }
+    return false;
+  }
+
+  static bool getThreadStride(Value *ptr, unsigned dim, ScalarEvolution &SE,
+                              const SymbolIndex &symbols, int64_t &stride) {
+    if (!SE.isSCEVable(ptr->getType())) return false;
+    return getThreadCoefficient(SE.getSCEV(ptr), dim, SE, symbols, stride);
+  }
+
+  // Sectors touched by the warp and bytes it actually requests
+  static void countSectors(int64_t strideX, int64_t strideY,
+                           unsigned blockWidth, uint64_t size,
+                           unsigned &sectors, uint64_t &used) {
+    unsigned width = std::min(blockWidth, WarpSize);
+    std::set<int64_t> touched, bytes;
+    for (unsigned lane = 0; lane < WarpSize; ++lane) {
+      int64_t addr = (lane % width) * strideX + (lane / width) * strideY;
+      for (int64_t byte = addr; byte < addr + int64_t(size); ++byte) {
+        bytes.insert(byte);
+        touched.insert(byte >= 0 ? byte / SectorSize
+                                 : -((-byte + SectorSize - 1) / SectorSize));
+      }
+    }
+    sectors = touched.size();
+    used = bytes.size();
+  }
+};
+
+char CoalescingPrinter::ID;
+
+static RegisterPass<CoalescingPrinter>
+X("coalescing-printer",
+  "Print the estimated global memory transactions of the kernels",
+  true, true);
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,325 @@
+#include "ConstantArrays.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/IR/ConstantRange.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/Local.h"
+
+#include "CUDArraysSymbols.h"
+#include "KernelSummary.h"
+#include "ThreadStride.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-constant-arrays"
+
+STATISTIC(NumConstantArrays, "Number of dynarrays read from constant memory");
+
+static cl::opt<unsigned>
+ConstantMaxElems("cudarrays-constant-elems",
+                 cl::desc("Maximum number of elements of the dynarrays moved to constant memory"),
+                 cl::init(4096));
+
+static cl::opt<unsigned>
+ConstantLimit("cudarrays-constant-limit",
+              cl::desc("Bytes of constant memory available for the dynarrays of a module"),
+              cl::init(65536));
+
+namespace platonic {
+
+static const char *ConstantArraysMD = "cudarrays.constant_arrays";
+
+// Indices above this bound are not considered small
+static const int64_t MaxIndex = int64_t(1) << 31;
+
+namespace {
+
+struct Range {
+  int64_t lo;
+  int64_t hi;
+};
+
+}
+
+// Range of values of expr in every thread of every launch. Fails for the
+// indices that depend on the launch (e.g. the thread or block index) or
+// on the kernel arguments.
+static bool getRange(const SymExpr &expr, Range &range) {
+  std::vector<Range> ops(expr.ops.size());
+  for (unsigned i = 0; i < expr.ops.size(); ++i)
+    if (!getRange(expr.ops[i], ops[i])) return false;
+
+  switch (expr.kind) {
+  case SymExpr::SymConst:
+    range.lo = range.hi = expr.value;
+    break;
+  case SymExpr::SymAdd:
+    range.lo = range.hi = 0;
+    for (const Range &op : ops) {
+      range.lo += op.lo;
+      range.hi += op.hi;
+    }
+    break;
+  case SymExpr::SymMul:
+    range.lo = range.hi = 1;
+    for (const Range &op : ops) {
+      int64_t products[] = { range.lo * op.lo, range.lo * op.hi,
+                             range.hi * op.lo, range.hi * op.hi };
+      range.lo = *std::min_element(products, products + 4);
+      range.hi = *std::max_element(products, products + 4);
+    }
+    break;
+  case SymExpr::SymUMax:
+    // Only equal to the signed max for non-negative operands
+    for (const Range &op : ops)
+      if (op.lo < 0) return false;
+    // Fall through
+  case SymExpr::SymSMax:
+    range = ops[0];
+    for (const Range &op : ops) {
+      range.lo = std::max(range.lo, op.lo);
+      range.hi = std::max(range.hi, op.hi);
+    }
+    break;
+  case SymExpr::SymUDiv:
+    if (ops[0].lo < 0 || ops[1].lo <= 0) return false;
+    range.lo = ops[0].lo / ops[1].hi;
+    range.hi = ops[0].hi / ops[1].lo;
+    break;
+  case SymExpr::SymAddRec: {
+    // start + step * [0, count]
+    int64_t count = std::max<int64_t>(0, ops[2].hi);
+    int64_t ends[] = { ops[1].lo * count, ops[1].hi * count, 0 };
+    range.lo = ops[0].lo + *std::min_element(ends, ends + 3);
+    range.hi = ops[0].hi + *std::max_element(ends, ends + 3);
+    break;
+  }
+  default:
+    return false;
+  }
+
+  return range.lo > -MaxIndex && range.hi < MaxIndex;
+}
+
+bool isConstantArray(const ArraySummary &array) {
+  if (array.status == ArrayFailed || array.isWritten || !array.isRead)
+    return false;
+  if (array.dimIndices.size() != array.dims) return false;
+
+  uint64_t elems = 1;
+  for (const std::vector<SymExpr> &indices : array.dimIndices) {
+    if (indices.empty()) return false;
+
+    int64_t hi = 0;
+    for (const SymExpr &index : indices) {
+      Range range;
+      if (!getRange(index, range) || range.lo < 0) return false;
+      hi = std::max(hi, range.hi);
+    }
+
+    elems *= uint64_t(hi) + 1;
+    if (elems > ConstantMaxElems) return false;
+  }
+  return true;
+}
+
+std::string getConstantArrayName(const Function &fun, unsigned argNo) {
+  return "__cudarrays_const_" + fun.getName().str() + "_" +
+         std::to_string(argNo);
+}
+
+void markConstantArray(Function &fun, unsigned argNo) {
+  LLVMContext &C = fun.getContext();
+  Metadata *ops[] = {
+    ValueAsMetadata::get(&fun),
+    ConstantAsMetadata::get(ConstantInt::get(Type::getInt32Ty(C), argNo))
+  };
+  fun.getParent()->getOrInsertNamedMetadata(ConstantArraysMD)->
+    addOperand(MDNode::get(C, ops));
+}
+
+// Moves the dynarrays registered by delin to constant memory. The kernels
+// copy their dynarray arguments to allocas, and once the accessors are
+// lowered the elements are read through the data pointer loaded from the
+// copy. That pointer is replaced by a global of the constant address space
+// (4) named after getConstantArrayName, which the runtime fills with the
+// beginning of the array before every launch.
+//
+// The pass checks again that the pointer is only used to read elements at
+// thread-independent offsets that fit in the global, as the indices seen
+// by delin are not byte offsets, and sizes the global after the highest
+// one. Arrays that do not pass get no global and keep their global memory
+// reads; the runtime skips the copy of a missing symbol.
+//
+// It must run after -cudarrays-lower-accessors.
+class ConstantArrayPromotion : public ModulePass {
+ public:
+  static char ID;
+  ConstantArrayPromotion() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    NamedMDNode *marks = M.getNamedMetadata(ConstantArraysMD);
+    if (!marks) return false;
+
+    SymbolIndex symbols(M);
+    const DataLayout &DL = getAnalysis<DataLayoutPass>().getDataLayout();
+
+    bool result = false;
+    uint64_t available = ConstantLimit;
+    for (unsigned i = 0; i < marks->getNumOperands(); ++i) {
+      const MDNode *node = marks->getOperand(i);
+      if (node->getNumOperands() != 2) continue;
+
+      Function *fun = mdconst::dyn_extract_or_null<Function>(node->getOperand(0));
+      const ConstantInt *argNo =
+        mdconst::dyn_extract_or_null<ConstantInt>(node->getOperand(1));
+      if (!fun || !argNo || fun->isDeclaration()) continue;
+
+      result |= promote(*fun, argNo->getZExtValue(), symbols, DL, available);
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  // Loads of the data pointer of a dynarray copy, by offset in the copy
+  using FieldLoads = std::map<int64_t, std::vector<LoadInst *> >;
+
+  static AllocaInst *getArgumentCopy(Function &fun, unsigned argNo) {
+    for (Instruction &inst : fun.getEntryBlock()) {
+      StoreInst *store = dyn_cast<StoreInst>(&inst);
+      Argument *arg = store ? dyn_cast<Argument>(store->getValueOperand())
+                            : NULL;
+      if (arg && arg->getArgNo() == argNo)
+        return dyn_cast<AllocaInst>(store->getPointerOperand());
+    }
+    return NULL;
+  }
+
+  // Element reads through the pointer; fails on any other use
+  static bool collectReads(Value *ptr, std::vector<LoadInst *> &reads) {
+    for (User *user : ptr->users()) {
+      if (LoadInst *load = dyn_cast<LoadInst>(user)) {
+        if (load->isVolatile() || load->getPointerOperand() != ptr)
+          return false;
+        reads.push_back(load);
+      } else if (isa<GetElementPtrInst>(user) || isa<BitCastInst>(user) ||
+                 isa<AddrSpaceCastInst>(user)) {
+        if (!collectReads(user, reads)) return false;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool promote(Function &fun, unsigned argNo, const SymbolIndex &symbols,
+               const DataLayout &DL, uint64_t &available) {
+    AllocaInst *copy = getArgumentCopy(fun, argNo);
+    if (!copy) return false;
+
+    // The data pointer is the only pointer field of the copy whose
+    // elements are read
+    FieldLoads fields;
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      LoadInst *load = dyn_cast<LoadInst>(&*it);
+      if (!load || !load->getType()->isPointerTy()) continue;
+
+      APInt offset(DL.getPointerSizeInBits(), 0);
+      const Value *base = load->getPointerOperand()->
+        stripAndAccumulateInBoundsConstantOffsets(DL, offset);
+      if (base == copy && !load->use_empty())
+        fields[offset.getSExtValue()].push_back(load);
+    }
+    if (fields.size() != 1) return false;
+
+    std::vector<LoadInst *> &pointers = fields.begin()->second;
+    PointerType *ptrTy = cast<PointerType>(pointers[0]->getType());
+
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    uint64_t bytes = 0;
+    for (LoadInst *ptr : pointers) {
+      if (ptr->getType() != ptrTy) return false;
+
+      std::vector<LoadInst *> reads;
+      if (!collectReads(ptr, reads)) return false;
+
+      for (LoadInst *read : reads) {
+        const SCEV *offset = SE.getMinusSCEV(SE.getSCEV(read->getPointerOperand()),
+                                             SE.getSCEV(ptr));
+        for (unsigned dim = 0; dim < 3; ++dim) {
+          int64_t coef;
+          if (!getThreadCoefficient(offset, dim, SE, symbols, coef) || coef)
+            return false;
+        }
+
+        ConstantRange range = SE.getSignedRange(offset);
+        if (range.isFullSet() || range.getSignedMin().isNegative())
+          return false;
+
+        uint64_t end = range.getSignedMax().getZExtValue() +
+                       DL.getTypeStoreSize(read->getType());
+        bytes = std::max(bytes, end);
+      }
+    }
+    if (bytes == 0 || bytes > available) return false;
+
+    // The host writes the global, so it is not a constant for LLVM
+    Module &M = *fun.getParent();
+    Type *type = ArrayType::get(Type::getInt8Ty(M.getContext()), bytes);
+    GlobalVariable *global =
+      new GlobalVariable(M, type, false, GlobalValue::ExternalLinkage,
+                         Constant::getNullValue(type),
+                         getConstantArrayName(fun, argNo), NULL,
+                         GlobalVariable::NotThreadLocal, 4);
+    global->setAlignment(16);
+
+    Constant *data = ConstantExpr::getBitCast(
+      global, PointerType::get(ptrTy->getElementType(), 4));
+    if (ptrTy->getAddressSpace() != 4)
+      data = ConstantExpr::getAddrSpaceCast(data, ptrTy);
+
+    for (LoadInst *ptr : pointers) {
+      ptr->replaceAllUsesWith(data);
+      RecursivelyDeleteTriviallyDeadInstructions(ptr);
+    }
+
+    DEBUG(dbgs() << fun.getName() << ": argument " << argNo << " read from "
+                 << global->getName() << " (" << bytes << " bytes)\n");
+    available -= bytes;
+    ++NumConstantArrays;
+    return true;
+  }
+};
+
+char ConstantArrayPromotion::ID;
+
+static RegisterPass<ConstantArrayPromotion>
+X("cudarrays-constant-arrays",
+  "Read the small uniformly indexed dynarrays from constant memory",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
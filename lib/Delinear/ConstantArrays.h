@@ -0,0 +1,31 @@
+#ifndef CONSTANT_ARRAYS_H
+#define CONSTANT_ARRAYS_H
+
+#include <string>
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+struct ArraySummary;
+
+// Whether the dynarray is worth moving to constant memory: the kernel only
+// reads it, with indices that are the same in every thread and bounded by
+// small constants (e.g. coefficient tables or neighbour offset lists), so
+// its reads are broadcasts served by the constant cache.
+bool isConstantArray(const ArraySummary &array);
+
+// Name of the constant memory copy of the array argument argNo of fun, which
+// the runtime fills before launching the kernel
+std::string getConstantArrayName(const llvm::Function &fun, unsigned argNo);
+
+// Records in the module that the array argument argNo of fun has been
+// registered to be read from constant memory. The reads are rewritten by
+// the -cudarrays-constant-arrays pass once the accessors are lowered.
+void markConstantArray(llvm::Function &fun, unsigned argNo);
+
+}
+
+#endif // CONSTANT_ARRAYS_H
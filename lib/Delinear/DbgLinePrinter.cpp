@@ -107,4 +107,15 @@ unsigned getLineNumber(const Instruction *inst) {
   return info.line;
 }
 
+bool getSourceLocation(const Instruction *inst,
+                       std::string &filename, unsigned &line) {
+  DebugInfo info;
+  if(!getDebugInfo(info, inst))
+    return false;
+
+  filename = info.filename;
+  line = info.line;
+  return true;
+}
+
 }
@@ -1,6 +1,8 @@
 #ifndef DBE_LINE_PRINTER_H
 #define DBE_LINE_PRINTER_H
 
+#include <string>
+
 namespace llvm {
 class Instruction;
 }
@@ -8,6 +10,9 @@ class Instruction;
 namespace platonic {
 void printDebugInfo(const llvm::Instruction *inst);
 unsigned getLineNumber(const llvm::Instruction *inst);
+// Returns false if the instruction has no debug info
+bool getSourceLocation(const llvm::Instruction *inst,
+                       std::string &filename, unsigned &line);
 }
 
 #endif // DBE_LINE_PRINTER_H
@@ -1,34 +1,145 @@
 #include <cstdio>
 #include <cstdlib>
-#include <cxxabi.h>
 
+#include <algorithm>
+#include <memory>
+#include <set>
 #include <sstream>
+#include <thread>
+#include <tuple>
 #include <tr1/memory>
 
 #include "llvm/Pass.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Analysis/LoopInfo.h"
 #include "llvm/Analysis/ScalarEvolution.h"
 #include "llvm/Analysis/ScalarEvolutionExpressions.h"
 #include "llvm/Analysis/ValueTracking.h"
+#include "llvm/Bitcode/ReaderWriter.h"
 #include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
 #include "llvm/IR/InstIterator.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/LegacyPassManager.h"
 #include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
-
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Timer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "AnalysisCache.h"
+#include "ArrayLayout.h"
+#include "BlockSpecializer.h"
 #include "CUDArraysDriver.h"
 #include "CUDArraysRTDriver.h"
+#include "CUDArraysSymbols.h"
+#include "ConstantArrays.h"
+#include "DbgLinePrinter.h"
+#include "Delinear.h"
+#include "DistributionRemarks.h"
+#include "KernelClones.h"
+#include "KernelFusion.h"
+#include "KernelIntensity.h"
+#include "KernelSummary.h"
+#include "ParallelFor.h"
+#include "PartitionPlanner.h"
+#include "SymExpr.h"
+#include "TemporalBlocking.h"
 
 using namespace llvm;
 
 #undef DEBUG_TYPE
 #define DEBUG_TYPE "delinear"
 
+STATISTIC(NumKernels,        "Number of kernels registered");
+STATISTIC(NumCachedKernels,  "Number of kernels read from the cache");
+STATISTIC(NumAccesses,       "Number of array accesses analysed");
+STATISTIC(NumArrays,         "Number of kernel arrays");
+STATISTIC(NumPartitioned,    "Number of arrays partitioned");
+STATISTIC(NumReplicated,     "Number of arrays replicated");
+STATISTIC(NumUnanalysed,     "Number of arrays replicated due to unanalysable indices");
+STATISTIC(NumFailed,         "Number of arrays not registered");
+
+static const char *TimerGroupName = "Delinearization analysis";
+
 #if 0
 #undef DEBUG
 #define DEBUG(x) x
 #endif
 
+static cl::opt<unsigned>
+Threads("cudarrays-threads",
+        cl::desc("Number of threads used to analyse the kernels (0: one per core)"),
+        cl::init(0));
+
+static cl::opt<bool>
+SpecializeBlocks("cudarrays-interior",
+                 cl::desc("Clone the kernels with boundary guards into an interior version"),
+                 cl::init(false));
+
+static cl::opt<bool>
+ZeroOffsetClones("cudarrays-zero-offset",
+                 cl::desc("Clone the kernels for launches with zero block offsets"),
+                 cl::init(false));
+
+static cl::opt<bool>
+ReadOnlyClones("cudarrays-ldg",
+               cl::desc("Clone the kernels to load the read-only arrays through the read-only cache"),
+               cl::init(false));
+
+static cl::opt<bool>
+NoAliasClones("cudarrays-noalias",
+              cl::desc("Clone the kernels with alias scopes for launches with distinct arrays"),
+              cl::init(false));
+
+static cl::opt<unsigned>
+CoarsenFactor("cudarrays-coarsen",
+              cl::desc("Clone the kernels to run this many blocks per block (0: off)"),
+              cl::init(0));
+
+static cl::list<std::string>
+FusedKernels("cudarrays-fuse",
+             cl::desc("Fuse the launches of a producer and a consumer kernel (producer:consumer)"),
+             cl::value_desc("producer:consumer"), cl::CommaSeparated);
+
+static cl::opt<bool>
+RegisterIntensity("cudarrays-register-intensity",
+                  cl::desc("Register the estimated bytes and FLOPs per block of the kernels"),
+                  cl::init(false));
+
+static cl::opt<bool>
+LayoutHints("cudarrays-layout-hints",
+            cl::desc("Register the arrays of records better laid out as arrays of fields"),
+            cl::init(false));
+
+static cl::opt<bool>
+RegisterDecomposition("cudarrays-register-decomposition",
+                      cl::desc("Register the dimensions of the arrays that can be split across devices and their halos"),
+                      cl::init(false));
+
+static cl::opt<unsigned>
+PlanDevices("cudarrays-plan-devices",
+            cl::desc("Print the device grids of the arrays for this number of devices, ranked by halo traffic"),
+            cl::init(0));
+
+static cl::opt<unsigned>
+PlanExtent("cudarrays-plan-extent",
+           cl::desc("Extent of the array dimensions assumed by -cudarrays-plan-devices"),
+           cl::init(4096));
+
+static cl::opt<unsigned>
+TimeSteps("cudarrays-time-steps",
+          cl::desc("Let the stencil kernels run this many time steps per halo exchange"),
+          cl::init(1));
+
+static cl::opt<bool>
+ConstantArrays("cudarrays-register-constant",
+               cl::desc("Register the small uniformly indexed arrays to be read from constant memory"),
+               cl::init(false));
+
 namespace platonic {
 
 enum DimMask {
@@ -40,32 +151,31 @@ enum DimMask {
 
 using symbol_name_ptr = std::tr1::shared_ptr<char>;
 
-static std::string demangle_symbol(const char *str) {
-  int status;
-  char *trans = abi::__cxa_demangle(str, NULL, NULL, &status);
-  return trans ? trans : str;
-}
-
-static void print_function_demangled(const Function &fun) {
-  errs() << demangle_symbol(fun.getName().data()) << "\n";
-}
-
 class AccessInfo {
   struct DimInfo {
+    const SymbolIndex *symbols;
     const SCEV *scev;
     unsigned dim;
 
     std::string strAccess;
     int mask;
 
-    DimInfo() : scev(NULL), dim(-1), strAccess(""), mask(DimNone) {}
-    DimInfo(ScalarEvolution &SE, const SCEV *scev, unsigned dim) :
+    // Index expression for the footprint evaluators
+    SymExpr index;
+    bool hasIndex;
+
+    DimInfo() : symbols(NULL), scev(NULL), dim(-1), strAccess(""), mask(DimNone),
+                hasIndex(false) {}
+    DimInfo(ScalarEvolution &SE, const SymbolIndex &symbols,
+            const SymExprBuilder &builder, const SCEV *scev, unsigned dim) :
+      symbols(&symbols),
       scev(scev),
       dim(dim),
       mask(DimNone)
     {
       DEBUG("DIMINFO");
       strAccess = getDimInfo(scev, SE, false);
+      hasIndex = builder.lower(scev, index);
     }
 
     unsigned getDim() const { return dim; }
@@ -73,35 +183,24 @@ class AccessInfo {
 
     using loop_bounds = std::pair<std::string, std::string>;
 
-    static bool isCUDAIntrinsic(const CallInst *call)
+    bool isCUDAIntrinsic(const CallInst *call) const
     {
       const Function *fun = call->getCalledFunction();
       assert(fun && "Indirect thread id!?");
-      auto ret = CudaIntrinsicTranslations.count(fun->getName());
-      return ret > 0;
+      return symbols->isCUDARegister(fun);
     }
 
-    static bool isArrayIntrinsic(const CallInst *call)
+    bool isArrayIntrinsic(const CallInst *call) const
     {
       const Function *fun = call->getCalledFunction();
       assert(fun && "Indirect thread id!?");
-
-      std::string name = demangle_symbol(fun->getName().data());
-      auto ret = name.find("cudarrays::dynarray") == 0 &&
-                 name.find("get_dim") != std::string::npos;
-
-      return ret;
+      return symbols->is(fun, SymbolDynarrayGetDim);
     }
 
-    static std::string getArrayIntrinsic(const CallInst *call)
+    std::string getArrayIntrinsic(const CallInst *call) const
     {
       std::string ret;
-      const Function *fun = call->getCalledFunction();
-      assert(fun && "Indirect thread id!?");
-
-      std::string name = demangle_symbol(fun->getName().data());
-      if (name.find("cudarrays::dynarray") == 0 &&
-          name.find("get_dim") != std::string::npos) {
+      if (isArrayIntrinsic(call)) {
         ret = "dim";
       }
       return ret;
@@ -119,7 +218,7 @@ class AccessInfo {
       bool isArray = false;
 
       if (isCUDA) {
-        name = CudaIntrinsicTranslations[name];
+        name = symbols->getTranslation(fun).str();
         if (name == "b.x") {
             mask |= DimX;
         } else if (name == "b.y") {
@@ -161,16 +260,15 @@ class AccessInfo {
       DEBUG(errs() << "\n");
 
       // Is not a val value
-      StringRef name;
-      if(isThreadID(val, name)) {
+      if(symbols->is(val, SymbolThreadIdx)) {
         DEBUG(errs() << "Thread ID\n");
 
         ret << getFunctionName(dyn_cast<CallInst>(val));
-      } else if (isBlockSize(val, name)) {
+      } else if (symbols->is(val, SymbolBlockSize)) {
         DEBUG(errs() << "BlockSize\n");
 
         ret << getFunctionName(dyn_cast<CallInst>(val));
-      } else if (isBlockIdx(val, name)) {
+      } else if (symbols->is(val, SymbolBlockIdx)) {
         DEBUG(errs() << "BlockIdx\n");
 
         const CallInst *call = dyn_cast<CallInst>(val);
@@ -202,12 +300,7 @@ class AccessInfo {
       } else if (auto *call = dyn_cast<CallInst>(val)) {
         DEBUG(errs() << "CallInst\n");
 
-        const Function *fun = call->getCalledFunction();
-        std::string name = demangle_symbol(fun->getName().data());
-        if (name.find("cudarrays::dynarray") == 0 &&
-            name.find("operator()") != std::string::npos &&
-            fun->doesNotReturn() == false) {
-
+        if (symbols->is(call, SymbolDynarrayAccessor)) {
           ret << "#MEM";
         } else {
           ret << getFunctionName(call);
@@ -570,52 +663,35 @@ class AccessInfo {
     int getDimMask() const {
       return mask;
     }
+
+    const SymExpr *getIndex() const {
+      return hasIndex ? &index : NULL;
+    }
+
+    // Whether the access string contains a marker (e.g. "#EXPR")
+    bool hasMarker(const char *marker) const {
+      return strAccess.find(marker) != std::string::npos;
+    }
   };
 
   std::vector<DimInfo> base_;
+  const CallInst *call_;
   Value *dynarray_;
   ScalarEvolution &SE_;
   unsigned dim_;
   bool write_;
 
-  static const size_t THREAD_ID_FUN_NAMES_COUNT = 3;
-  static std::string ThreadIdFunNames[THREAD_ID_FUN_NAMES_COUNT];
-  static const size_t BLOCK_ID_FUN_NAMES_COUNT = 3;
-  static std::string BlockIdFunNames[BLOCK_ID_FUN_NAMES_COUNT];
-  static const size_t FUN_SIZE_NAMES_COUNT = 3;
-  static std::string SizeFunNames[FUN_SIZE_NAMES_COUNT];
-
-  using map_fun_translation = std::map<std::string, std::string>;
-  static map_fun_translation CudaIntrinsicTranslations;
-
-  static
-  void initFunctionTranslations()
-  {
-    if (CudaIntrinsicTranslations.size() > 0) return;
-
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ctaid.x", "b.x"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ctaid.y", "b.y"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ctaid.z", "b.z"});
-
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.tid.x", "t.x"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.tid.y", "t.y"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.tid.z", "t.z"});
-
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ntid.x", "bsize.x"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ntid.y", "bsize.y"});
-    CudaIntrinsicTranslations.insert({"llvm.nvvm.read.ptx.sreg.ntid.z", "bsize.z"});
-  }
-
  public:
-  AccessInfo(Value *dynarray, CallInst &call, Loop *loop, ScalarEvolution &SE, bool write) :
+  AccessInfo(Value *dynarray, CallInst &call, Loop *loop, ScalarEvolution &SE,
+             const SymbolIndex &symbols, const SymExprBuilder &builder,
+             bool write) :
     base_(),
+    call_(&call),
     dynarray_(dynarray),
     SE_(SE),
     dim_(call.getCalledFunction()->arg_size() - 1),
     write_(write) {
 
-    initFunctionTranslations();
-
     dynarray_ = dynarray_->stripPointerCasts();
 
     base_.resize(dim_);
@@ -632,7 +708,7 @@ class AccessInfo {
       }
 
       // getAccessInfo(SE_, *this, scev, dim_ - i + 1, false);
-      addDimInfo(SE, scev, dim_ - (i + 1));
+      addDimInfo(SE, symbols, builder, scev, dim_ - (i + 1));
     }
   }
 
@@ -640,12 +716,16 @@ class AccessInfo {
     return dynarray_;
   }
 
+  const CallInst *getCall() const { return call_; }
+
   unsigned getNumDims() const { return dim_; }
   const std::vector<DimInfo> &getDimInfo() const { return base_; }
 
  private:
-  void addDimInfo(ScalarEvolution &SE, const SCEV *scev, unsigned dim) {
-    base_[dim] = DimInfo(SE, scev, dim);
+  void addDimInfo(ScalarEvolution &SE, const SymbolIndex &symbols,
+                  const SymExprBuilder &builder, const SCEV *scev,
+                  unsigned dim) {
+    base_[dim] = DimInfo(SE, symbols, builder, scev, dim);
   }
 
   static bool isConstant(const SCEV *scev) {
@@ -673,70 +753,9 @@ class AccessInfo {
     return false;
   }
 
-  static bool isThreadID(const Value *v, StringRef &name) {
-    const CallInst *call = dyn_cast<CallInst>(v);
-    if(!call) return false;
-
-    const Function *fun = call->getCalledFunction();
-    if(!fun) return false;
-
-    name = fun->getName();
-    auto ret = std::find(ThreadIdFunNames, ThreadIdFunNames + THREAD_ID_FUN_NAMES_COUNT, name) != ThreadIdFunNames + THREAD_ID_FUN_NAMES_COUNT;
-
-    return ret;
-  }
-
-  static bool isBlockSize(const Value *v, StringRef &name) {
-    const CallInst *call = dyn_cast<CallInst>(v);
-    if(!call) return false;
-
-    const Function *fun = call->getCalledFunction();
-    if(!fun) return false;
-
-    name = fun->getName();
-    return std::find(SizeFunNames, SizeFunNames + FUN_SIZE_NAMES_COUNT, name) != SizeFunNames + FUN_SIZE_NAMES_COUNT;
-  }
-
-  static bool isBlockIdx(const Value *v, StringRef &name) {
-    const CallInst *call = dyn_cast<CallInst>(v);
-    if(!call) return false;
-
-    const Function *fun = call->getCalledFunction();
-    if(!fun) return false;
-
-    name = fun->getName();
-    auto ret = std::find(BlockIdFunNames, BlockIdFunNames + BLOCK_ID_FUN_NAMES_COUNT, name) != BlockIdFunNames + BLOCK_ID_FUN_NAMES_COUNT;
-    return ret;
-  }
-
-
   template<class T> friend T &operator<<(T &out, const AccessInfo &info);
 };
 
-  // OpenCL
-  // std::string("get_global_id"),
-  // std::string("get_local_id"),
-  // std::string("get_group_id"),
-  // CUDA
-std::string AccessInfo::ThreadIdFunNames[] = {
-  std::string("llvm.nvvm.read.ptx.sreg.tid.x"),
-  std::string("llvm.nvvm.read.ptx.sreg.tid.y"),
-  std::string("llvm.nvvm.read.ptx.sreg.tid.z")
-};
-std::string AccessInfo::BlockIdFunNames[] = {
-  std::string("llvm.nvvm.read.ptx.sreg.ctaid.x"),
-  std::string("llvm.nvvm.read.ptx.sreg.ctaid.y"),
-  std::string("llvm.nvvm.read.ptx.sreg.ctaid.z")
-};
-std::string AccessInfo::SizeFunNames[] = {
-  // CUDA
-  std::string("llvm.nvvm.read.ptx.sreg.ntid.x"),
-  std::string("llvm.nvvm.read.ptx.sreg.ntid.y"),
-  std::string("llvm.nvvm.read.ptx.sreg.ntid.z"),
-};
-
-AccessInfo::map_fun_translation AccessInfo::CudaIntrinsicTranslations;
-
 template<class T> T &operator<<(T &out, const AccessInfo &info) {
   out << info.getDynarray()->getName() << ": ";
   for (unsigned i = info.getNumDims(); i; --i) {
@@ -750,13 +769,18 @@ template<class T> T &operator<<(T &out, const AccessInfo &info) {
 
 class FunctionAccessInfo {
   Function &_fn;
+  const SymbolIndex &_symbols;
+  AllocaToArgMap _argMap;
 
   using map_array_info = std::map<const Value *, std::vector<AccessInfo>>;
   map_array_info _arrayInfo;
 
  public:
-  FunctionAccessInfo(Function &fn) :
-    _fn(fn) {
+  FunctionAccessInfo(Function &fn, const SymbolIndex &symbols,
+                     const AllocaToArgMap &argMap) :
+    _fn(fn),
+    _symbols(symbols),
+    _argMap(argMap) {
   }
 
   void addAccessInfo(const AccessInfo &arrayInfo) {
@@ -770,11 +794,19 @@ class FunctionAccessInfo {
     return _fn;
   }
 
+  const SymbolIndex &getSymbols() const {
+    return _symbols;
+  }
+
+  const AllocaToArgMap &getArgMap() const {
+    return _argMap;
+  }
+
   template<class T> friend T &operator<<(T &out, const FunctionAccessInfo &info);
 };
 
 template<class T> T &operator<<(T &out, const FunctionAccessInfo &info) {
-  print_function_demangled(info._fn);
+  out << info._symbols.getDemangledName(&info._fn) << "\n";
 
   for (auto &arrayInfo : info._arrayInfo) {
     for (auto &accessInfo : arrayInfo.second) {
@@ -787,46 +819,184 @@ template<class T> T &operator<<(T &out, const FunctionAccessInfo &info) {
 
 class Delinear : public ModulePass {
 
-  using AllocaToArgMap = DenseMap<const AllocaInst *, Argument *>;
-  using AllocaSet      = DenseSet<const AllocaInst *>;
+  using AllocaSet = DenseSet<const AllocaInst *>;
 
  public:
   static char ID;
-  Delinear() : ModulePass(ID) {}
+  Delinear() : ModulePass(ID), driver_(NULL), driverRT_(NULL) {}
+  Delinear(CUDArraysDriver &driver, CUDArraysRTDriver &driverRT) :
+    ModulePass(ID), driver_(&driver), driverRT_(&driverRT) {}
 
   bool runOnModule(Module &M) {
     bool result = false;
     printf("MIERDA\n");
 
-    CUDArraysDriver driver;
-    CUDArraysRTDriver driverRT;
+    // Without external drivers, the info is written when the drivers are
+    // destroyed at the end of the pass
+    std::unique_ptr<CUDArraysDriver> localDriver;
+    std::unique_ptr<CUDArraysRTDriver> localDriverRT;
+    if(!driver_) {
+      localDriver.reset(new CUDArraysDriver());
+      localDriverRT.reset(new CUDArraysRTDriver());
+    }
+    CUDArraysDriver &driver = driver_? *driver_: *localDriver;
+    CUDArraysRTDriver &driverRT = driverRT_? *driverRT_: *localDriverRT;
+
+    AnalysisCache cache;
+    DistributionRemarks remarks;
+    // Classify every function once instead of demangling each callee
+    SymbolIndex symbols(M);
+
+    std::vector<KernelSummary> summaries;
     for(auto &fun : M) {
-      if(!fun.isDeclaration()) {
-        // Huge hack to detect kernels
-        std::string name = demangle_symbol(fun.getName().data());
-        if(name.find("_kernel(") != std::string::npos ||
-           name.find("_kernel<") != std::string::npos ||
-           (name.find("_kernel_") != std::string::npos &&
-            name.find("_<") == std::string::npos &&
-            name.find("_(") == std::string::npos)) {
+      if(symbols.is(&fun, SymbolKernel)) {
+        summaries.push_back(KernelSummary());
+        summaries.back().fun = &fun;
+      }
+    }
 
-          FunctionAccessInfo funInfo(fun);
+    // Hashing only reads the IR
+    std::vector<std::string> hashes(summaries.size());
+    std::vector<char> cached(summaries.size(), false);
+    if(cache.isEnabled()) {
+      NamedRegionTimer T("Kernel hashing", TimerGroupName,
+                         TimePassesIsEnabled);
+      parallelFor(summaries.size(), Threads, [&](size_t i) {
+        hashes[i] = AnalysisCache::getKernelHash(*summaries[i].fun);
+        cached[i] = cache.lookup(hashes[i], summaries[i]);
+      });
+    }
 
-          result |= runOnFunction(funInfo);
+    std::vector<size_t> pending;
+    for(size_t i = 0; i < summaries.size(); ++i)
+      if(!cached[i]) pending.push_back(i);
 
-          errs() << funInfo;
+    unsigned workers = Threads ? Threads :
+                       std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min<size_t>(workers, pending.size());
+
+    // SCEV walk and summary of the kernels that were not cached
+    std::vector<std::string> accesses(summaries.size());
+    {
+      NamedRegionTimer T("Access analysis", TimerGroupName,
+                         TimePassesIsEnabled);
+      if(workers <= 1) {
+        for(size_t i : pending) {
+          Function &fun = *summaries[i].fun;
+          KernelAnalysis analysis =
+            analyzeKernel(fun, symbols, getAnalysis<LoopInfo>(fun),
+                          getAnalysis<ScalarEvolution>(fun));
+          summaries[i] = analysis.summary;
+          accesses[i] = analysis.accesses;
+          cache.store(hashes[i], summaries[i]);
+        }
+      } else {
+        analyzeKernels(M, pending, workers, summaries, accesses, hashes,
+                       cache);
+      }
+    }
+
+    // Merge in module order to keep the driver output stable. Remarks are
+    // emitted here too, as the LLVMContext diagnostics are not thread safe.
+    NamedRegionTimer T("Driver emission", TimerGroupName,
+                       TimePassesIsEnabled);
+    DataLayout DL(&M);
+    for(size_t i = 0; i < summaries.size(); ++i) {
+      // Template kernels are instantiated in every module that launches them
+      if(driver.isRegistered(summaries[i].fun)) continue;
+
+      StringRef name = symbols.getDemangledName(summaries[i].fun);
+      if(cached[i]) {
+        errs() << name << " (cached)\n";
+        ++NumCachedKernels;
+      } else {
+        errs() << accesses[i];
+      }
+
+      ++NumKernels;
+      updateStatistics(summaries[i]);
+      remarks.emitKernel(summaries[i], name);
+      if(PlanDevices)
+        printPartitionPlans(errs(), summaries[i], PlanDevices, PlanExtent);
+
+      result |= insertCUDArrayInfo(driver, summaries[i]);
+      insertCUDArrayInfo(driverRT, summaries[i]);
+
+      if(RegisterIntensity) {
+        Function &fun = *summaries[i].fun;
+        KernelIntensity intensity =
+          computeKernelIntensity(fun, DL, getAnalysis<LoopInfo>(fun),
+                                 getAnalysis<ScalarEvolution>(fun));
+        driver.insertSetKernelIntensity(&fun, intensity);
+        driverRT.insertSetKernelIntensity(&fun, intensity);
+      }
 
-          AllocaToArgMap argMap = createAllocaToArgMap(fun);
-          AllocaSet readSet = getCUDArraySet<LoadInst>(fun);
-          AllocaSet writeSet = getCUDArraySet<StoreInst>(fun);
+      if(ConstantArrays)
+        result |= registerConstantArrays(summaries[i], driver, driverRT);
 
-          result |= insertCUDArrayInfo(driver, funInfo,
-                                       argMap, readSet, writeSet);
+      if(SpecializeBlocks)
+        result |= specializeKernel(*summaries[i].fun, symbols,
+                                   driver, driverRT);
 
-          insertCUDArrayInfo(driverRT, funInfo,
-                             argMap, readSet, writeSet);
+      if(ZeroOffsetClones)
+        result |= createZeroOffsetClones(*summaries[i].fun, driver, driverRT);
+
+      if(ReadOnlyClones) {
+        unsigned kind;
+        if(Function *clone = createReadOnlyClone(*summaries[i].fun,
+                                                 summaries[i], symbols,
+                                                 kind)) {
+          driver.insertSetKernelClone(summaries[i].fun, clone, kind);
+          driverRT.insertSetKernelClone(summaries[i].fun, clone, kind);
+          result = true;
+        }
+      }
+
+      if(NoAliasClones) {
+        if(Function *clone = createNoAliasClone(*summaries[i].fun, symbols)) {
+          driver.insertSetKernelClone(summaries[i].fun, clone, CloneDistinctArrays);
+          driverRT.insertSetKernelClone(summaries[i].fun, clone, CloneDistinctArrays);
+          result = true;
         }
       }
+
+      if(CoarsenFactor > 1) {
+        unsigned gridDim;
+        if(Function *clone = createCoarsenedClone(*summaries[i].fun,
+                                                  summaries[i], CoarsenFactor,
+                                                  gridDim)) {
+          driver.insertSetKernelCoarsening(summaries[i].fun, clone, gridDim,
+                                           CoarsenFactor);
+          driverRT.insertSetKernelCoarsening(summaries[i].fun, clone, gridDim,
+                                             CoarsenFactor);
+          result = true;
+        }
+      }
+    }
+
+    // Fusions name the kernels by their mangled names
+    for(const std::string &pair : FusedKernels) {
+      size_t colon = pair.find(':');
+      StringRef producerName = StringRef(pair).substr(0, colon);
+      StringRef consumerName = colon == std::string::npos ?
+                               StringRef() : StringRef(pair).substr(colon + 1);
+
+      const KernelSummary *producer = NULL, *consumer = NULL;
+      for(const KernelSummary &summary : summaries) {
+        if(summary.fun->getName() == producerName) producer = &summary;
+        if(summary.fun->getName() == consumerName) consumer = &summary;
+      }
+      if(!producer || !consumer) {
+        errs() << "Cannot fuse " << pair << ": kernel not found\n";
+        continue;
+      }
+
+      std::vector<SharedArray> shared;
+      if(Function *fused = createFusedKernel(*producer, *consumer, shared)) {
+        driver.insertSetKernelFusion(producer->fun, consumer->fun, fused, shared);
+        driverRT.insertSetKernelFusion(producer->fun, consumer->fun, fused, shared);
+        result = true;
+      }
     }
 
     return result;
@@ -838,9 +1008,107 @@ class Delinear : public ModulePass {
   }
 
  private:
+  CUDArraysDriver *driver_;
+  CUDArraysRTDriver *driverRT_;
+
+  // Result of the access walk of a kernel
+  struct KernelAnalysis {
+    KernelSummary summary;
+    // The accesses, as printed after the analysis
+    std::string accesses;
+  };
+
+  static KernelAnalysis analyzeKernel(Function &fun,
+                                      const SymbolIndex &symbols,
+                                      LoopInfo &LI, ScalarEvolution &SE) {
+    FunctionAccessInfo F(fun, symbols, createAllocaToArgMap(fun));
+    runOnFunction(F, LI, SE);
+
+    KernelAnalysis analysis;
+    analysis.summary = summarizeKernel(F, symbols);
+    raw_string_ostream out(analysis.accesses);
+    out << F;
+    out.flush();
+    return analysis;
+  }
+
+  // Walks the kernel it runs on with the LoopInfo and ScalarEvolution of
+  // its own pass manager
+  class KernelAccessWalk : public FunctionPass {
+    const SymbolIndex &symbols_;
+
+   public:
+    static char ID;
+    KernelAnalysis analysis;
+
+    explicit KernelAccessWalk(const SymbolIndex &symbols) :
+      FunctionPass(ID), symbols_(symbols) {}
+
+    bool runOnFunction(Function &fun) {
+      analysis = analyzeKernel(fun, symbols_, getAnalysis<LoopInfo>(),
+                               getAnalysis<ScalarEvolution>());
+      return false;
+    }
+
+    void getAnalysisUsage(AnalysisUsage &AU) const {
+      AU.addRequired<LoopInfo>();
+      AU.addRequired<ScalarEvolution>();
+      AU.setPreservesAll();
+    }
+  };
+
+  // Analyses the pending kernels on workers threads. Building SCEVs
+  // creates constants in the LLVMContext, which is not thread safe, so
+  // every worker parses a copy of the module in a context of its own and
+  // runs LoopInfo and ScalarEvolution on it with its own pass manager.
+  // The summaries are context free and point back to the kernels of M.
+  static void analyzeKernels(Module &M, const std::vector<size_t> &pending,
+                             unsigned workers,
+                             std::vector<KernelSummary> &summaries,
+                             std::vector<std::string> &accesses,
+                             const std::vector<std::string> &hashes,
+                             const AnalysisCache &cache) {
+    SmallString<0> bitcode;
+    {
+      raw_svector_ostream out(bitcode);
+      WriteBitcodeToFile(&M, out);
+    }
+
+    parallelFor(workers, workers, [&](size_t worker) {
+      LLVMContext context;
+      ErrorOr<Module *> copy =
+        parseBitcodeFile(MemoryBufferRef(bitcode.str(),
+                                         M.getModuleIdentifier()),
+                         context);
+      if(std::error_code EC = copy.getError())
+        report_fatal_error("Cannot copy the module: " + EC.message());
+      std::unique_ptr<Module> module(copy.get());
+      SymbolIndex symbols(*module);
+
+      legacy::FunctionPassManager FPM(module.get());
+      FPM.add(new DataLayoutPass());
+      KernelAccessWalk *walk = new KernelAccessWalk(symbols);
+      FPM.add(walk);
+      FPM.doInitialization();
+
+      for(size_t k = worker; k < pending.size(); k += workers) {
+        size_t i = pending[k];
+        Function *kernel = summaries[i].fun;
+        FPM.run(*module->getFunction(kernel->getName()));
+
+        summaries[i] = walk->analysis.summary;
+        summaries[i].fun = kernel;
+        accesses[i] = walk->analysis.accesses;
+        cache.store(hashes[i], summaries[i]);
+      }
+
+      FPM.doFinalization();
+    });
+  }
 
   template<class T>
-  static const AllocaSet getCUDArraySet(const Function &F) {
+  static const AllocaSet getCUDArraySet(const Function &F,
+                                        const SymbolIndex &symbols) {
     AllocaSet allocaSet;
     for(const_inst_iterator inst = inst_begin(F),
           E = inst_end(F); inst != E; ++inst) {
@@ -854,12 +1122,7 @@ class Delinear : public ModulePass {
       const CallInst *call = dyn_cast<CallInst>(UO);
       if(!call) continue;
 
-      const Function *target = call->getCalledFunction();
-      if(!target) continue;
-
-      if(!target->getName().count("cudarrays")) continue;
-      if(!target->getName().count("array_storage") &&
-         !target->getName().count("dynarray")) continue;
+      if(!symbols.is(call, SymbolArrayStorage)) continue;
 
       const AllocaInst *alloca = findAllocaSource(call->getArgOperand(0));
       allocaSet.insert(alloca);
@@ -867,24 +1130,6 @@ class Delinear : public ModulePass {
     return allocaSet;
   }
 
-  static const AllocaInst *findAllocaSource(const Value *V) {
-    if(const AllocaInst *alloca = dyn_cast<AllocaInst>(V))
-      return alloca;
-
-    if(const BitCastInst *bitcast = dyn_cast<BitCastInst>(V))
-      return findAllocaSource(bitcast->getOperand(0));
-
-    const CallInst *call = dyn_cast<CallInst>(V);
-    if(!call) return NULL;
-
-    Function *fun = call->getCalledFunction();
-    if(!fun) return NULL;
-    if(!fun->getName().startswith("llvm.nvvm.ptr.gen.to.")) return NULL;
-    if(fun->arg_size() != 1) return NULL;
-
-    return findAllocaSource(call->getArgOperand(0));
-  }
-
   static AllocaToArgMap createAllocaToArgMap(Function &F) {
     AllocaToArgMap argMap;
     for(inst_iterator it = inst_begin(F),
@@ -931,57 +1176,266 @@ class Delinear : public ModulePass {
     return mask;
   }
 
+  // Distinct index expressions used to access a dimension, or none if
+  // some of them could not be lowered
+  static std::vector<SymExpr> getArrayIndices(const std::vector<AccessInfo> &infos,
+                                              unsigned dim) {
+    std::vector<SymExpr> indices;
+    std::set<std::string> seen;
+    for(auto &it : infos) {
+      const SymExpr *index = it.getDimInfo()[dim].getIndex();
+      if(!index) return std::vector<SymExpr>();
+
+      std::string str;
+      raw_string_ostream os(str);
+      index->print(os);
+      if(seen.insert(os.str()).second)
+        indices.push_back(*index);
+    }
+    return indices;
+  }
+
+  // Describes the first index that could not be analysed, if any
+  static std::string getUnanalysedReason(const std::vector<AccessInfo> &infos) {
+    for(auto &it : infos) {
+      for(auto &dimInfo : it.getDimInfo()) {
+        std::stringstream ret;
+        if(dimInfo.hasMarker("#EXPR")) {
+          ret << "the index of dimension " << dimInfo.getDim()
+              << " could not be computed by ScalarEvolution (#EXPR)";
+        } else if(dimInfo.hasMarker("#PHIRECURSION")) {
+          ret << "the index of dimension " << dimInfo.getDim()
+              << " depends on a recursive PHI node (#PHIRECURSION)";
+        } else {
+          continue;
+        }
+        return ret.str();
+      }
+    }
+    return "";
+  }
+
+  static void updateStatistics(const KernelSummary &summary) {
+    for(const ArraySummary &array : summary.arrays) {
+      ++NumArrays;
+      switch(array.status) {
+      case ArrayPartitioned: ++NumPartitioned; break;
+      case ArrayReplicated:  ++NumReplicated;  break;
+      case ArrayUnanalysed:  ++NumUnanalysed;  break;
+      case ArrayFailed:      ++NumFailed;      break;
+      }
+    }
+  }
+
+  static Argument *getArgument(Function &F, unsigned argNo) {
+    Function::arg_iterator arg = F.arg_begin();
+    std::advance(arg, argNo);
+    return &*arg;
+  }
+
+  static KernelSummary summarizeKernel(FunctionAccessInfo &F,
+                                       const SymbolIndex &symbols) {
+    Function &fun = F.getFunction();
+
+    const AllocaToArgMap &argMap = F.getArgMap();
+    AllocaSet readSet = getCUDArraySet<LoadInst>(fun, symbols);
+    AllocaSet writeSet = getCUDArraySet<StoreInst>(fun, symbols);
+
+    KernelSummary summary;
+    summary.fun = &fun;
+
+    for(auto &info : F) {
+      ArraySummary array;
+      array.name = info.first->getName();
+      getSourceLocation(info.second.front().getCall(),
+                        array.file, array.line);
+
+      // The API assumes all CUDArrays are passed as arguments to the kernel.
+      // Arrays that break this assumption are reported and skipped.
+      const AllocaInst *alloca = dyn_cast<AllocaInst>(info.first);
+      AllocaToArgMap::const_iterator arg = argMap.end();
+      if(alloca) arg = argMap.find(alloca);
+      if(arg == argMap.end()) {
+        array.status = ArrayFailed;
+        array.reason = "the array is not a copy of a kernel argument";
+        summary.arrays.push_back(array);
+        continue;
+      }
+
+      array.argNo = arg->second->getArgNo();
+      array.name = arg->second->getName();
+
+      if(!hasConsistentDims(info.second)) {
+        array.status = ArrayFailed;
+        array.reason = "the array is accessed with different numbers of "
+                       "dimensions";
+        summary.arrays.push_back(array);
+        continue;
+      }
+
+      array.dims = info.second.begin()->getNumDims();
+      array.isRead = readSet.count(alloca);
+      array.isWritten = writeSet.count(alloca);
+
+      unsigned masks = DimNone;
+      for(unsigned i = 0; i < array.dims; ++i) {
+        array.dimMasks.push_back(getArrayMask(info.second, i));
+        masks |= array.dimMasks.back();
+        array.dimIndices.push_back(getArrayIndices(info.second, i));
+      }
+
+      if(masks != DimNone) {
+        array.status = ArrayPartitioned;
+      } else {
+        array.reason = getUnanalysedReason(info.second);
+        if(!array.reason.empty()) {
+          array.status = ArrayUnanalysed;
+        } else {
+          array.status = ArrayReplicated;
+          array.reason = "no index depends on the block index";
+        }
+      }
+
+      summary.arrays.push_back(array);
+    }
+
+    // The access info is keyed by pointer, so sort to get the same
+    // registration order in every run. The arrays that are not arguments
+    // all have argNo 0 and are told apart by their location and name.
+    std::stable_sort(summary.arrays.begin(), summary.arrays.end(),
+                     [](const ArraySummary &a, const ArraySummary &b) {
+                       return std::tie(a.argNo, a.file, a.line, a.name) <
+                              std::tie(b.argNo, b.file, b.line, b.name);
+                     });
+
+    return summary;
+  }
+
   template <typename Driver>
   static bool insertCUDArrayInfo(Driver &driver,
-                                 FunctionAccessInfo &F,
-                                 const AllocaToArgMap &argMap,
-                                 const AllocaSet &readSet,
-                                 const AllocaSet &writeSet) {
-    Function &fun = F.getFunction();
+                                 const KernelSummary &summary) {
+    Function &fun = *summary.fun;
 
     // Reset the info at the beginning of each function
     driver.insertResetInfo(&fun);
 
-    for(auto &info : F) {
-      // The API assumes all CUDArrays are passed as arguments to the kernel.
-      const AllocaInst *alloca = cast<AllocaInst>(info.first);
-      AllocaToArgMap::const_iterator arg = argMap.find(alloca);
-      assert(arg != argMap.end());
+    TemporalStencil stencil;
+    bool temporal = TimeSteps > 1 && getTemporalStencil(summary, stencil);
 
-      assert(hasConsistentDims(info.second));
-      unsigned dims = info.second.begin()->getNumDims();
+    for(const ArraySummary &array : summary.arrays) {
+      if(array.status == ArrayFailed) continue;
 
-      bool isRead = readSet.count(alloca);
-      bool isWritten = writeSet.count(alloca);
+      Argument *arg = getArgument(fun, array.argNo);
 
       // Set the array info
-      driver.insertSetArrayInfo(arg->second, dims, isRead, isWritten);
+      driver.insertSetArrayInfo(arg, array.dims,
+                                array.isRead, array.isWritten);
 
-      for(unsigned i = 0; i < dims; ++i) {
-        DimMask mask = getArrayMask(info.second, i);
+      for(unsigned i = 0; i < array.dims; ++i) {
+        unsigned mask = array.dimMasks[i];
         if(mask & DimX)
-          driver.insertSetArrayDimInfo(arg->second, i, 0);
+          driver.insertSetArrayDimInfo(arg, i, 0);
 
         if(mask & DimY)
-          driver.insertSetArrayDimInfo(arg->second, i, 1);
+          driver.insertSetArrayDimInfo(arg, i, 1);
 
         if(mask & DimZ)
-          driver.insertSetArrayDimInfo(arg->second, i, 2);
+          driver.insertSetArrayDimInfo(arg, i, 2);
+
+        if(!array.dimIndices[i].empty())
+          driver.insertSetArrayDimBounds(arg, i, array.dimIndices[i]);
       }
+
+      if(LayoutHints) {
+        int fieldDim = getFieldDim(array);
+        if(fieldDim >= 0)
+          driver.insertSetArrayLayoutHint(arg, fieldDim);
+      }
+
+      // Both arrays of the stencil are split, with the halo of one time
+      // step: the runtime widens it for the time steps and block size
+      ArrayDecomposition decomp;
+      if(temporal && (array.argNo == stencil.inArg ||
+                      array.argNo == stencil.outArg))
+        driver.insertSetArrayDecomposition(arg, stencil.decomp);
+      else if(RegisterDecomposition && getArrayDecomposition(array, decomp))
+        driver.insertSetArrayDecomposition(arg, decomp);
     }
 
+    if(temporal)
+      driver.insertSetKernelTimeSteps(&fun, stencil, TimeSteps);
+
     return true;
   }
 
 
-  using BBSet = DenseSet<BasicBlock *>;
+  // Registers the clone for single GPU launches and, when the kernel reads
+  // the offsets of several grid dimensions, one clone per dimension for the
+  // launches that do not partition it
+  static bool createZeroOffsetClones(Function &fun, CUDArraysDriver &driver,
+                                     CUDArraysRTDriver &driverRT) {
+    Function *clone = createZeroOffsetClone(fun);
+    if(!clone) return false;
+    driver.insertSetKernelClone(&fun, clone, CloneZeroOffset);
+    driverRT.insertSetKernelClone(&fun, clone, CloneZeroOffset);
+
+    unsigned dims = getOffsetDims(fun);
+    if(dims == 1 || dims == 2 || dims == 4) return true;
+
+    for(unsigned dim = 0; dim < 3; ++dim) {
+      if(!(dims & (1 << dim))) continue;
+      if(Function *dimClone = createZeroOffsetClone(fun, 1 << dim)) {
+        driver.insertSetKernelClone(&fun, dimClone, CloneZeroOffsetX << dim);
+        driverRT.insertSetKernelClone(&fun, dimClone, CloneZeroOffsetX << dim);
+      }
+    }
+    return true;
+  }
+
+  // Marks the arrays to be moved to constant memory by
+  // -cudarrays-constant-arrays and registers their symbols
+  static bool registerConstantArrays(const KernelSummary &summary,
+                                     CUDArraysDriver &driver,
+                                     CUDArraysRTDriver &driverRT) {
+    Function &fun = *summary.fun;
 
-  bool runOnFunction(FunctionAccessInfo &F) {
     bool result = false;
-    Function &fun = F.getFunction();
+    for(const ArraySummary &array : summary.arrays) {
+      if(!isConstantArray(array)) continue;
+
+      Argument *arg = getArgument(fun, array.argNo);
+      std::string symbol = getConstantArrayName(fun, array.argNo);
+      markConstantArray(fun, array.argNo);
+      driver.insertSetArrayConstant(arg, symbol);
+      driverRT.insertSetArrayConstant(arg, symbol);
+      result = true;
+    }
 
-    LoopInfo &LI = getAnalysis<LoopInfo>(fun);
+    return result;
+  }
+
+  // Registers an interior clone of the kernel for the blocks where its
+  // boundary guards hold in every thread
+  bool specializeKernel(Function &fun, const SymbolIndex &symbols,
+                        CUDArraysDriver &driver, CUDArraysRTDriver &driverRT) {
     ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    AllocaToArgMap argMap = createAllocaToArgMap(fun);
+
+    BlockSpecializer specializer(SE, symbols, argMap);
+    if(!specializer.analyze(fun)) return false;
+
+    Function *interior = specializer.createInteriorClone();
+    driver.insertSetKernelInterior(&fun, interior, specializer.getGuards());
+    driverRT.insertSetKernelInterior(&fun, interior, specializer.getGuards());
+    return true;
+  }
+
+  using BBSet = DenseSet<BasicBlock *>;
+
+  static bool runOnFunction(FunctionAccessInfo &F, LoopInfo &LI,
+                            ScalarEvolution &SE) {
+    bool result = false;
+    Function &fun = F.getFunction();
 
     BBSet blocksVisited;
     std::vector<Loop *> workList;
@@ -1006,7 +1460,7 @@ class Delinear : public ModulePass {
     return result;
   }
 
-  bool runOnLoop(FunctionAccessInfo &F, Loop &loop, ScalarEvolution &SE, BBSet &blocksVisited) {
+  static bool runOnLoop(FunctionAccessInfo &F, Loop &loop, ScalarEvolution &SE, BBSet &blocksVisited) {
     bool result = false;
     for(auto bb = loop.block_begin(), E = loop.block_end(); bb != E; ++bb) {
       result |= runOnBB(F, &loop, **bb, SE, blocksVisited);
@@ -1015,20 +1469,14 @@ class Delinear : public ModulePass {
     return result;
   }
 
-  bool runOnBB(FunctionAccessInfo &F, Loop *loop, BasicBlock &bb, ScalarEvolution &SE, BBSet &blocksVisited) {
+  static bool runOnBB(FunctionAccessInfo &F, Loop *loop, BasicBlock &bb, ScalarEvolution &SE, BBSet &blocksVisited) {
     bool result = false;
     blocksVisited.insert(&bb);
 
     for(auto &inst : bb) {
       if(CallInst *call = dyn_cast<CallInst>(&inst)) {
-        if(Function *fun = call->getCalledFunction()) {
-          std::string name = demangle_symbol(fun->getName().data());
-          if (name.find("cudarrays::dynarray") == 0 &&
-              name.find("operator()") != std::string::npos &&
-              !fun->doesNotReturn()) {
-            runOnAccess(F, loop, *call, SE, true);
-          }
-
+        if(F.getSymbols().is(call, SymbolDynarrayAccessor)) {
+          runOnAccess(F, loop, *call, SE, true);
         }
       }
     }
@@ -1042,18 +1490,27 @@ class Delinear : public ModulePass {
 
     assert(dynarray->getType()->isPointerTy() && "This must be a pointer!");
 
-    AccessInfo arrayInfo(dynarray, call, loop, SE, write);
+    SymExprBuilder builder(SE, F.getSymbols(), F.getArgMap());
+    AccessInfo arrayInfo(dynarray, call, loop, SE, F.getSymbols(), builder,
+                         write);
     F.addAccessInfo(arrayInfo);
+    ++NumAccesses;
 
     return false;
   }
 };
 
 char Delinear::ID = 0;
+char Delinear::KernelAccessWalk::ID = 0;
 
 static RegisterPass<Delinear>
 X("delin", "Delinearization analysis", true, false);
 
+ModulePass *createDelinearPass(CUDArraysDriver &driver,
+                               CUDArraysRTDriver &driverRT) {
+  return new Delinear(driver, driverRT);
+}
+
 }
 
 // vim: set ts=2 sw=2:
@@ -0,0 +1,21 @@
+#ifndef DELINEAR_H
+#define DELINEAR_H
+
+namespace llvm {
+class ModulePass;
+}
+
+namespace platonic {
+
+class CUDArraysDriver;
+class CUDArraysRTDriver;
+
+// Creates a Delinear pass that registers the kernel info in the given
+// drivers instead of writing one output per module. Used to combine the
+// info of several modules in a single registration output.
+llvm::ModulePass *createDelinearPass(CUDArraysDriver &driver,
+                                     CUDArraysRTDriver &driverRT);
+
+}
+
+#endif // DELINEAR_H
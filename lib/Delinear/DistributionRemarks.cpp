@@ -0,0 +1,210 @@
+#include <string>
+#include <vector>
+
+#include "DistributionRemarks.h"
+#include "IRHelpers.h"
+
+#include "llvm/IR/DebugInfo.h"
+#include "llvm/IR/DebugLoc.h"
+#include "llvm/IR/DiagnosticInfo.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+static cl::opt<std::string>
+RemarksFile("cudarrays-remarks-file",
+            cl::desc("File where the distribution remarks are appended as YAML"),
+            cl::init(""));
+
+static const char *PassName = "delin";
+
+namespace platonic {
+
+namespace {
+
+enum RemarkKind {
+  RemarkPassed,
+  RemarkMissed,
+  RemarkAnalysis
+};
+
+struct Remark {
+  RemarkKind kind;
+  // Identifier of the remark (e.g. "ArrayPartitioned")
+  const char *name;
+  std::string file;
+  unsigned line;
+  std::string message;
+  // Extra key/value pairs for the YAML output
+  std::vector<std::pair<const char *, std::string> > args;
+
+  Remark(RemarkKind kind, const char *name) :
+    kind(kind), name(name), line(0) {}
+};
+
+}
+
+static const char *DimNames[] = { "x", "y", "z" };
+
+static DebugLoc getDebugLoc(const Function &fun, unsigned line) {
+  if (!line) return DebugLoc();
+
+  DISubprogram subprogram = getDISubprogram(&fun);
+  if (!subprogram) return DebugLoc();
+
+  return DebugLoc::get(line, 0, subprogram);
+}
+
+static void emit(raw_fd_ostream *yaml, const Function &fun,
+                 const Remark &remark) {
+  LLVMContext &C = fun.getContext();
+  DebugLoc loc = getDebugLoc(fun, remark.line);
+
+  switch (remark.kind) {
+  case RemarkPassed:
+    emitOptimizationRemark(C, PassName, fun, loc, remark.message);
+    break;
+  case RemarkMissed:
+    emitOptimizationRemarkMissed(C, PassName, fun, loc, remark.message);
+    break;
+  case RemarkAnalysis:
+    emitOptimizationRemarkAnalysis(C, PassName, fun, loc, remark.message);
+    break;
+  }
+
+  if (!yaml) return;
+
+  static const char *Tags[] = { "!Passed", "!Missed", "!Analysis" };
+  raw_fd_ostream &out = *yaml;
+  out << "--- " << Tags[remark.kind] << "\n";
+  out << "Pass:            " << PassName << "\n";
+  out << "Name:            " << remark.name << "\n";
+  if (remark.line) {
+    out << "DebugLoc:        { File: " << quote(remark.file)
+        << ", Line: " << remark.line << ", Column: 0 }\n";
+  }
+  out << "Function:        " << quote(fun.getName()) << "\n";
+  out << "Args:\n";
+  for (auto &arg : remark.args)
+    out << "  - " << arg.first << ": " << quote(arg.second) << "\n";
+  out << "  - Message: " << quote(remark.message) << "\n";
+  out << "...\n";
+}
+
+DistributionRemarks::DistributionRemarks() {
+  if (RemarksFile.empty()) return;
+
+  // Appended so that the remarks of several modules end in the same file
+  std::error_code EC;
+  yaml_.reset(new raw_fd_ostream(RemarksFile, EC,
+                                 sys::fs::F_Append | sys::fs::F_Text));
+  if (EC) {
+    errs() << "Cannot open remarks file " << RemarksFile << ": "
+           << EC.message() << "\n";
+    yaml_.reset();
+  }
+}
+
+DistributionRemarks::~DistributionRemarks() {
+}
+
+void DistributionRemarks::emitKernel(const KernelSummary &summary,
+                                     StringRef kernelName) {
+  const Function &fun = *summary.fun;
+
+  unsigned partitioned = 0;
+  for (const ArraySummary &array : summary.arrays) {
+    emitArray(summary, kernelName, array);
+    if (array.status == ArrayPartitioned) ++partitioned;
+  }
+
+  std::string message;
+  raw_string_ostream os(message);
+  RemarkKind kind;
+  const char *name;
+  if (summary.arrays.empty()) {
+    kind = RemarkAnalysis;
+    name = "KernelNoArrays";
+    os << "kernel " << kernelName << " accesses no arrays";
+  } else if (partitioned) {
+    kind = RemarkPassed;
+    name = "KernelPartitioned";
+    os << "kernel " << kernelName << ": " << partitioned << " of "
+       << summary.arrays.size() << " arrays partitioned";
+  } else {
+    kind = RemarkMissed;
+    name = "KernelNotPartitioned";
+    os << "kernel " << kernelName << ": none of the "
+       << summary.arrays.size() << " arrays is partitioned";
+  }
+
+  Remark remark(kind, name);
+  remark.message = os.str();
+  remark.args.push_back(std::make_pair("Kernel", kernelName.str()));
+
+  DISubprogram subprogram = getDISubprogram(&fun);
+  if (subprogram) {
+    remark.file = subprogram.getFilename();
+    remark.line = subprogram.getLineNumber();
+  }
+
+  emit(yaml_.get(), fun, remark);
+}
+
+void DistributionRemarks::emitArray(const KernelSummary &summary,
+                                    StringRef kernelName,
+                                    const ArraySummary &array) {
+  static const char *Names[] = {
+    "ArrayPartitioned", "ArrayReplicated", "ArrayUnanalysed", "ArrayFailed"
+  };
+  static const RemarkKind Kinds[] = {
+    RemarkPassed, RemarkAnalysis, RemarkMissed, RemarkMissed
+  };
+  Remark remark(Kinds[array.status], Names[array.status]);
+  remark.file = array.file;
+  remark.line = array.line;
+
+  std::string message;
+  raw_string_ostream os(message);
+  os << "array " << array.name << " in " << kernelName;
+  switch (array.status) {
+  case ArrayPartitioned:
+    os << " partitioned:";
+    for (unsigned i = array.dims; i; --i) {
+      os << " [";
+      unsigned mask = array.dimMasks[i - 1];
+      for (unsigned d = 0; d < 3; ++d)
+        if (mask & (1 << d)) os << " b." << DimNames[d];
+      os << " ]";
+    }
+    break;
+  case ArrayReplicated:
+    os << " replicated";
+    break;
+  case ArrayUnanalysed:
+    os << " replicated because the accesses could not be analysed";
+    break;
+  case ArrayFailed:
+    os << " not registered";
+    break;
+  }
+  if (!array.reason.empty())
+    os << ": " << array.reason;
+
+  remark.message = os.str();
+  remark.args.push_back(std::make_pair("Kernel", kernelName.str()));
+  remark.args.push_back(std::make_pair("Array", array.name));
+  remark.args.push_back(std::make_pair("Dims", std::to_string(array.dims)));
+  if (!array.reason.empty())
+    remark.args.push_back(std::make_pair("Reason", array.reason));
+
+  emit(yaml_.get(), *summary.fun, remark);
+}
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,38 @@
+#ifndef DISTRIBUTION_REMARKS_H
+#define DISTRIBUTION_REMARKS_H
+
+#include <memory>
+
+#include "llvm/ADT/StringRef.h"
+
+#include "KernelSummary.h"
+
+namespace llvm {
+class raw_fd_ostream;
+}
+
+namespace platonic {
+
+// Explains the distribution decision of every kernel and array. Remarks
+// are reported as LLVM optimization remarks of the "delin" pass (shown
+// with -pass-remarks=delin, -pass-remarks-missed=delin and
+// -pass-remarks-analysis=delin) and, with -cudarrays-remarks-file, are
+// also appended to a YAML file.
+class DistributionRemarks {
+ public:
+  DistributionRemarks();
+  ~DistributionRemarks();
+
+  // kernelName: demangled kernel name used in the messages
+  void emitKernel(const KernelSummary &summary, llvm::StringRef kernelName);
+
+ private:
+  std::unique_ptr<llvm::raw_fd_ostream> yaml_;
+
+  void emitArray(const KernelSummary &summary, llvm::StringRef kernelName,
+                 const ArraySummary &array);
+};
+
+}
+
+#endif // DISTRIBUTION_REMARKS_H
@@ -0,0 +1,606 @@
+#include "llvm/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ValueHandle.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/Local.h"
+
+#include "CUDArraysSymbols.h"
+#include "IRHelpers.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-double-buffer"
+
+STATISTIC(NumPipelinedLoops, "Number of tile loops software pipelined");
+STATISTIC(NumDoubleBuffers,  "Number of shared memory buffers doubled");
+
+static cl::opt<unsigned>
+MaxSharedBytes("cudarrays-shared-limit",
+               cl::desc("Shared memory available to a block"),
+               cl::init(49152));
+
+namespace platonic {
+
+// Software pipelines the tile loops of the kernels:
+//
+//   for (k...) {                      buf[0] = A[first k];
+//     buf = A[k];                     for (k...) {
+//     __syncthreads();        =>        __syncthreads();
+//     compute(buf);                     if (next k) a = A[next k];
+//     __syncthreads();                  compute(buf[cur]);
+//   }                                   buf[cur ^ 1] = a;
+//                                     }
+//
+// The global load of the next tile is in flight while the current one is
+// computed. With two buffers, the writes of the next tile cannot overwrite
+// the one other threads are reading, so the second barrier goes away: a
+// thread that writes buf[cur ^ 1] has passed the barrier that every
+// thread reaches after computing the previous tile.
+//
+// The loop must be rotated (only the latch exits) and the addresses of the
+// tile loads must be pure functions of the header phis, so that they can
+// be computed for the first and for the next iteration.
+class DoubleBuffering : public ModulePass {
+  // Iterations a loop value is computed for
+  enum Iteration { IterFirst, IterCurrent, IterNext };
+
+  // A global load whose value is stored to a shared buffer
+  struct Stage {
+    LoadInst *load;
+    StoreInst *store;
+    GlobalVariable *buffer;
+  };
+
+  struct Pipeline {
+    Loop *L;
+    BasicBlock *preheader;
+    BasicBlock *header;
+    BranchInst *backedge;
+    // Barriers after the tile stores and after the compute
+    CallInst *loadBarrier;
+    CallInst *computeBarrier;
+    std::vector<Stage> stages;
+    SetVector<GlobalVariable *> buffers;
+  };
+
+ public:
+  static char ID;
+  DoubleBuffering() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+    DL_ = &getAnalysis<DataLayoutPass>().getDataLayout();
+    AA_ = &getAnalysis<AliasAnalysis>();
+
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+      LoopInfo &LI = getAnalysis<LoopInfo>(fun);
+
+      SmallVector<Loop *, 8> loops;
+      collectLoops(LI, loops, false);
+
+      // Pipelines are found before any loop changes
+      std::vector<Pipeline> pipelines;
+      for (Loop *L : loops) {
+        Pipeline pipeline;
+        if (analyzeLoop(L, pipeline) && fitsSharedMemory(fun, pipeline))
+          pipelines.push_back(pipeline);
+      }
+
+      SmallPtrSet<Loop *, 4> done;
+      for (Pipeline &pipeline : pipelines) {
+        // The blocks of nested loops change with the transformation
+        bool nested = false;
+        for (Loop *L : done)
+          nested = nested || L->contains(pipeline.L) ||
+                   pipeline.L->contains(L);
+        if (nested) continue;
+
+        if (transform(fun, pipeline)) {
+          done.insert(pipeline.L);
+          result = true;
+        }
+      }
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<AliasAnalysis>();
+    AU.addRequired<LoopInfo>();
+  }
+
+ private:
+  const DataLayout *DL_;
+  AliasAnalysis *AA_;
+
+  static bool isBarrier(const Instruction *inst) {
+    const IntrinsicInst *call = dyn_cast<IntrinsicInst>(inst);
+    return call && (call->getIntrinsicID() == Intrinsic::cuda_syncthreads ||
+                    call->getIntrinsicID() == Intrinsic::nvvm_barrier0);
+  }
+
+  // Whether ptr may point to shared memory: a generic pointer may, unless
+  // it comes from an alloca or from a global outside the shared space
+  bool mayPointToShared(Value *ptr) const {
+    unsigned AS = ptr->getType()->getPointerAddressSpace();
+    if (AS != 0) return AS == 3;
+
+    Value *object = GetUnderlyingObject(ptr, DL_);
+    if (isa<AllocaInst>(object)) return false;
+    if (GlobalVariable *global = dyn_cast<GlobalVariable>(object))
+      return global->getType()->getAddressSpace() == 3;
+    return true;
+  }
+
+  bool mayAccessShared(Instruction *inst) const {
+    if (LoadInst *load = dyn_cast<LoadInst>(inst))
+      return mayPointToShared(load->getPointerOperand());
+    if (StoreInst *store = dyn_cast<StoreInst>(inst))
+      return mayPointToShared(store->getPointerOperand());
+    return inst->mayReadOrWriteMemory();
+  }
+
+  static bool isPure(const Instruction *inst) {
+    return !isa<PHINode>(inst) && !isa<TerminatorInst>(inst) &&
+           !inst->mayReadOrWriteMemory() && !inst->mayHaveSideEffects();
+  }
+
+  // Whether val can be computed for any iteration of L: it only depends
+  // on the header phis through pure instructions
+  static bool canMaterialize(Value *val, Loop *L) {
+    Instruction *inst = dyn_cast<Instruction>(val);
+    if (!inst || !L->contains(inst)) return true;
+
+    if (PHINode *phi = dyn_cast<PHINode>(inst))
+      return phi->getParent() == L->getHeader();
+    if (!isPure(inst)) return false;
+
+    for (Value *op : inst->operands())
+      if (!canMaterialize(op, L)) return false;
+    return true;
+  }
+
+  // Computes val for the given iteration at insertPt. The values of the
+  // next iteration are those the latch passes to the header phis.
+  static Value *materialize(Value *val, Iteration iter, const Pipeline &P,
+                            Instruction *insertPt,
+                            DenseMap<Value *, Value *> &cache) {
+    Instruction *inst = dyn_cast<Instruction>(val);
+    if (!inst || !P.L->contains(inst)) return val;
+
+    auto cached = cache.find(val);
+    if (cached != cache.end()) return cached->second;
+
+    Value *result;
+    if (PHINode *phi = dyn_cast<PHINode>(inst)) {
+      if (iter == IterFirst) {
+        result = phi->getIncomingValueForBlock(P.preheader);
+      } else if (iter == IterCurrent) {
+        result = phi;
+      } else {
+        DenseMap<Value *, Value *> current;
+        Value *incoming =
+          phi->getIncomingValueForBlock(P.backedge->getParent());
+        result = materialize(incoming, IterCurrent, P, insertPt, current);
+      }
+    } else {
+      Instruction *copy = inst->clone();
+      copy->setName(inst->getName() + ".db");
+      copy->insertBefore(insertPt);
+      for (unsigned i = 0; i < copy->getNumOperands(); ++i)
+        copy->setOperand(i, materialize(copy->getOperand(i), iter, P,
+                                        copy, cache));
+      result = copy;
+    }
+
+    cache[val] = result;
+    return result;
+  }
+
+  // Whether ptr is an address in buffer that does not change in L
+  static bool isInvariantAddress(Value *ptr, GlobalVariable *buffer, Loop *L) {
+    if (ptr == buffer || isa<Constant>(ptr)) return true;
+
+    Instruction *inst = dyn_cast<Instruction>(ptr);
+    if (!inst || !L->contains(inst)) return true;
+    if (!isa<GetElementPtrInst>(inst) && !isa<BitCastInst>(inst))
+      return false;
+
+    if (!isInvariantAddress(inst->getOperand(0), buffer, L)) return false;
+    for (unsigned i = 1; i < inst->getNumOperands(); ++i)
+      if (!L->isLoopInvariant(inst->getOperand(i))) return false;
+    return true;
+  }
+
+  // The loads and stores of buffer, through its address computations
+  static bool collectAccesses(Value *val,
+                              SmallVectorImpl<Instruction *> &accesses) {
+    for (User *user : val->users()) {
+      if (isa<LoadInst>(user) || isa<StoreInst>(user)) {
+        if (isa<StoreInst>(user) &&
+            cast<StoreInst>(user)->getValueOperand() == val)
+          return false;
+        accesses.push_back(cast<Instruction>(user));
+      } else if (isa<GetElementPtrInst>(user) || isa<BitCastInst>(user) ||
+                 isa<ConstantExpr>(user)) {
+        if (!collectAccesses(user, accesses)) return false;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool analyzeLoop(Loop *L, Pipeline &P) const {
+    P.L = L;
+    P.preheader = L->getLoopPreheader();
+    P.header = L->getHeader();
+    BasicBlock *latch = L->getLoopLatch();
+    if (!P.preheader || !latch || L->getExitingBlock() != latch) return false;
+
+    P.backedge = dyn_cast<BranchInst>(latch->getTerminator());
+    if (!P.backedge || !P.backedge->isConditional() ||
+        !canMaterialize(P.backedge->getCondition(), L))
+      return false;
+
+    // One barrier at the end of the tile stores and one at the end of the
+    // compute, right before the latch
+    SmallVector<CallInst *, 2> barriers;
+    for (BasicBlock *bb : L->blocks())
+      for (Instruction &inst : *bb)
+        if (isBarrier(&inst)) barriers.push_back(cast<CallInst>(&inst));
+    if (barriers.size() != 2) return false;
+
+    P.loadBarrier = barriers[0]->getParent() == P.header ? barriers[0]
+                                                         : barriers[1];
+    P.computeBarrier = P.loadBarrier == barriers[0] ? barriers[1]
+                                                    : barriers[0];
+    if (P.loadBarrier->getParent() != P.header) return false;
+
+    BasicBlock *computeEnd = P.computeBarrier->getParent();
+    if (computeEnd != latch && latch->getSinglePredecessor() != computeEnd)
+      return false;
+    for (BasicBlock::iterator it =
+           std::next(BasicBlock::iterator(P.computeBarrier));
+         !isa<TerminatorInst>(&*it); ++it)
+      if (it->mayReadOrWriteMemory()) return false;
+    if (computeEnd != latch) {
+      for (Instruction &inst : *latch)
+        if (inst.mayReadOrWriteMemory()) return false;
+    }
+
+    // Global loads stored to shared buffers before the first barrier
+    SmallPtrSet<Instruction *, 8> beforeBarrier;
+    for (Instruction &inst : *P.header) {
+      if (&inst == P.loadBarrier) break;
+      beforeBarrier.insert(&inst);
+
+      StoreInst *store = dyn_cast<StoreInst>(&inst);
+      if (!store || store->getPointerAddressSpace() != 3) continue;
+
+      // The tile comes from global memory, not from another shared buffer
+      LoadInst *load = dyn_cast<LoadInst>(store->getValueOperand());
+      if (!load || load->getParent() != P.header || !load->hasOneUse() ||
+          !load->isSimple() || !store->isSimple() ||
+          load->getPointerAddressSpace() == 3 ||
+          getSharedToGeneric(GetUnderlyingObject(load->getPointerOperand(),
+                                                DL_)))
+        return false;
+
+      GlobalVariable *buffer = dyn_cast<GlobalVariable>(
+        GetUnderlyingObject(store->getPointerOperand(), DL_));
+      if (!buffer || !buffer->hasLocalLinkage() ||
+          !isInvariantAddress(store->getPointerOperand(), buffer, L) ||
+          !canMaterialize(load->getPointerOperand(), L))
+        return false;
+
+      Stage stage = { load, store, buffer };
+      P.stages.push_back(stage);
+      P.buffers.insert(buffer);
+    }
+    if (P.stages.empty()) return false;
+
+    // Without the compute barrier, nothing else before the first barrier
+    // may touch shared memory: other threads may still be reading it
+    for (Instruction *inst : beforeBarrier) {
+      if (!inst->mayReadOrWriteMemory()) continue;
+
+      bool isStage = false;
+      for (const Stage &stage : P.stages)
+        isStage = isStage || stage.load == inst || stage.store == inst;
+      if (!isStage && mayAccessShared(inst)) return false;
+    }
+
+    // The buffers are only written by the stages and only read after the
+    // first barrier, in the loop
+    for (GlobalVariable *buffer : P.buffers) {
+      SmallVector<Instruction *, 16> accesses;
+      if (!collectAccesses(buffer, accesses)) return false;
+
+      for (Instruction *access : accesses) {
+        if (!L->contains(access)) return false;
+        if (isa<LoadInst>(access) && !beforeBarrier.count(access)) continue;
+
+        bool isStage = false;
+        for (const Stage &stage : P.stages)
+          isStage = isStage || stage.store == access;
+        if (!isStage) return false;
+      }
+    }
+
+    // The loads of the next tile move above the compute of the current one
+    for (BasicBlock *bb : L->blocks()) {
+      for (Instruction &inst : *bb) {
+        if (!inst.mayWriteToMemory() || isBarrier(&inst)) continue;
+
+        for (const Stage &stage : P.stages) {
+          if (&inst == stage.store) continue;
+          if (AA_->getModRefInfo(&inst, AA_->getLocation(stage.load)) &
+              AliasAnalysis::Mod)
+            return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  static bool isUsedBy(const Value *val, const Function &fun) {
+    for (const User *user : val->users()) {
+      if (const Instruction *inst = dyn_cast<Instruction>(user)) {
+        if (inst->getParent()->getParent() == &fun) return true;
+      } else if (isUsedBy(user, fun)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool fitsSharedMemory(const Function &fun, const Pipeline &P) const {
+    uint64_t bytes = 0;
+    for (const GlobalVariable &global : fun.getParent()->globals()) {
+      if (global.getType()->getAddressSpace() == 3 && isUsedBy(&global, fun))
+        bytes += DL_->getTypeAllocSize(global.getType()->getElementType());
+    }
+    for (GlobalVariable *buffer : P.buffers)
+      bytes += DL_->getTypeAllocSize(buffer->getType()->getElementType());
+    return bytes <= MaxSharedBytes;
+  }
+
+  // Turns the constant expressions over global in the instructions of fun
+  // into instructions, so that each use can get its own buffer
+  static void expandConstantUses(GlobalVariable *global, Function &fun) {
+    std::vector<Instruction *> work;
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it)
+      work.push_back(&*it);
+
+    while (!work.empty()) {
+      Instruction *inst = work.back();
+      work.pop_back();
+
+      for (unsigned i = 0; i < inst->getNumOperands(); ++i) {
+        ConstantExpr *expr = dyn_cast<ConstantExpr>(inst->getOperand(i));
+        if (!expr || !dependsOn(expr, global)) continue;
+
+        Instruction *insertPt = inst;
+        if (PHINode *phi = dyn_cast<PHINode>(inst))
+          insertPt = phi->getIncomingBlock(i)->getTerminator();
+
+        Instruction *copy = expr->getAsInstruction();
+        copy->insertBefore(insertPt);
+        inst->setOperand(i, copy);
+        work.push_back(copy);
+      }
+    }
+  }
+
+  static bool dependsOn(const Constant *expr, const GlobalVariable *global) {
+    if (expr == global) return true;
+    for (const Use &op : expr->operands()) {
+      const Constant *constant = dyn_cast<Constant>(op.get());
+      if (constant && dependsOn(constant, global)) return true;
+    }
+    return false;
+  }
+
+  // Clones the address computation of ptr over buffer for view
+  static Value *rebase(Value *ptr, GlobalVariable *buffer, Value *view,
+                       Instruction *insertPt) {
+    if (ptr == buffer) return view;
+
+    Instruction *inst = cast<Instruction>(ptr);
+    Instruction *copy = inst->clone();
+    copy->setName(inst->getName() + ".db");
+    copy->setOperand(0, rebase(inst->getOperand(0), buffer, view, insertPt));
+    copy->insertBefore(insertPt);
+    return copy;
+  }
+
+  // Address computations over buffer outside L (e.g. hoisted by LICM) are
+  // cloned at their uses in L, where the current buffer is known. The
+  // computations left without uses are added to dead.
+  static void localizeAddress(Instruction *addr, GlobalVariable *buffer,
+                              Value *view, Loop *L,
+                              SmallVectorImpl<WeakVH> &dead) {
+    SmallVector<User *, 8> users(addr->user_begin(), addr->user_end());
+    for (User *user : users) {
+      Instruction *inst = cast<Instruction>(user);
+      if (L->contains(inst))
+        inst->replaceUsesOfWith(addr, rebase(addr, buffer, view, inst));
+      else
+        localizeAddress(inst, buffer, view, L, dead);
+    }
+    dead.push_back(addr);
+  }
+
+  bool transform(Function &fun, Pipeline &P) {
+    Module &M = *fun.getParent();
+    LLVMContext &ctx = M.getContext();
+    Type *int32Ty = Type::getInt32Ty(ctx);
+
+    // Every stage needs its own copy of the store address
+    for (GlobalVariable *buffer : P.buffers)
+      expandConstantUses(buffer, fun);
+    for (Stage &stage : P.stages) {
+      bool changed;
+      if (!P.L->makeLoopInvariant(stage.store->getPointerOperand(), changed))
+        return false;
+    }
+
+    DEBUG(errs() << "Double buffering loop " << P.header->getName()
+                 << " in " << fun.getName() << "\n");
+
+    // Buffer pairs
+    DenseMap<GlobalVariable *, GlobalVariable *> doubled;
+    for (GlobalVariable *buffer : P.buffers) {
+      ArrayType *type = ArrayType::get(buffer->getType()->getElementType(), 2);
+      GlobalVariable *pair =
+        new GlobalVariable(M, type, false, GlobalValue::InternalLinkage,
+                           UndefValue::get(type), buffer->getName() + ".db",
+                           buffer, GlobalVariable::NotThreadLocal, 3);
+      pair->setAlignment(buffer->getAlignment());
+      doubled[buffer] = pair;
+      ++NumDoubleBuffers;
+    }
+
+    // Prologue: the first tile goes to buffer 0
+    Instruction *prologue = P.preheader->getTerminator();
+    DenseMap<Value *, Value *> first;
+    for (Stage &stage : P.stages) {
+      Value *ptr = materialize(stage.load->getPointerOperand(), IterFirst, P,
+                               prologue, first);
+      LoadInst *load = new LoadInst(ptr, stage.load->getName() + ".first",
+                                    prologue);
+      load->setAlignment(stage.load->getAlignment());
+
+      Value *idx[] = { ConstantInt::get(int32Ty, 0), ConstantInt::get(int32Ty, 0) };
+      Value *view = ConstantExpr::getInBoundsGetElementPtr(doubled[stage.buffer], idx);
+      Value *dst = rebase(stage.store->getPointerOperand(), stage.buffer,
+                          view, prologue);
+      StoreInst *store = new StoreInst(load, dst, prologue);
+      store->setAlignment(stage.store->getAlignment());
+    }
+
+    // Loads of the next tile right after the first barrier, when there is
+    // a next iteration
+    Instruction *afterBarrier = std::next(BasicBlock::iterator(P.loadBarrier));
+    DenseMap<Value *, Value *> current;
+    Value *hasNext = materialize(P.backedge->getCondition(), IterCurrent, P,
+                                 afterBarrier, current);
+    if (P.backedge->getSuccessor(0) != P.header)
+      hasNext = BinaryOperator::CreateNot(hasNext, "db.has_next", afterBarrier);
+
+    BasicBlock *compute = P.header->splitBasicBlock(afterBarrier, "db.compute");
+    BasicBlock *prefetch = BasicBlock::Create(ctx, "db.prefetch", &fun, compute);
+    P.header->getTerminator()->eraseFromParent();
+    BranchInst::Create(prefetch, compute, hasNext, P.header);
+    BranchInst *prefetchEnd = BranchInst::Create(compute, prefetch);
+
+    // Current buffer
+    PHINode *cur = PHINode::Create(int32Ty, 2, "db.buf", &P.header->front());
+    BasicBlock *latch = P.backedge->getParent();
+    cur->addIncoming(ConstantInt::get(int32Ty, 0), P.preheader);
+    cur->addIncoming(BinaryOperator::CreateXor(cur, ConstantInt::get(int32Ty, 1),
+                                               "db.next", P.backedge),
+                     latch);
+
+    DenseMap<Value *, Value *> next;
+    std::vector<PHINode *> values;
+    for (Stage &stage : P.stages) {
+      Value *ptr = materialize(stage.load->getPointerOperand(), IterNext, P,
+                               prefetchEnd, next);
+      LoadInst *load = new LoadInst(ptr, stage.load->getName() + ".next",
+                                    prefetchEnd);
+      load->setAlignment(stage.load->getAlignment());
+
+      PHINode *value = PHINode::Create(load->getType(), 2, "db.value",
+                                       &compute->front());
+      value->addIncoming(UndefValue::get(load->getType()), P.header);
+      value->addIncoming(load, prefetch);
+      values.push_back(value);
+    }
+
+    // The next tile replaces the second barrier. After the last iteration
+    // the undefined values are stored to a buffer that is not read again.
+    Instruction *epilogue = P.computeBarrier;
+    Value *other = BinaryOperator::CreateXor(cur, ConstantInt::get(int32Ty, 1),
+                                             "db.other", epilogue);
+    for (unsigned i = 0; i < P.stages.size(); ++i) {
+      Stage &stage = P.stages[i];
+      Value *idx[] = { ConstantInt::get(int32Ty, 0), other };
+      Value *view = GetElementPtrInst::CreateInBounds(doubled[stage.buffer],
+                                                      idx, "db.view", epilogue);
+      Value *dst = rebase(stage.store->getPointerOperand(), stage.buffer,
+                          view, epilogue);
+      StoreInst *store = new StoreInst(values[i], dst, epilogue);
+      store->setAlignment(stage.store->getAlignment());
+    }
+    P.computeBarrier->eraseFromParent();
+
+    for (Stage &stage : P.stages) {
+      Value *ptr = stage.store->getPointerOperand();
+      stage.store->eraseFromParent();
+      stage.load->eraseFromParent();
+      RecursivelyDeleteTriviallyDeadInstructions(ptr);
+    }
+
+    // The compute reads the current buffer
+    Instruction *viewPt = P.header->getFirstInsertionPt();
+    for (GlobalVariable *buffer : P.buffers) {
+      Value *idx[] = { ConstantInt::get(int32Ty, 0), cur };
+      Value *view = GetElementPtrInst::CreateInBounds(doubled[buffer], idx,
+                                                      "db.cur", viewPt);
+
+      buffer->removeDeadConstantUsers();
+      SmallVector<User *, 16> users(buffer->user_begin(), buffer->user_end());
+      SmallVector<WeakVH, 16> dead;
+      for (User *user : users) {
+        Instruction *inst = cast<Instruction>(user);
+        if (P.L->contains(inst))
+          inst->replaceUsesOfWith(buffer, view);
+        else
+          localizeAddress(inst, buffer, view, P.L, dead);
+      }
+      for (WeakVH &addr : dead) {
+        if (Instruction *inst = dyn_cast_or_null<Instruction>(addr))
+          RecursivelyDeleteTriviallyDeadInstructions(inst);
+      }
+      if (buffer->use_empty())
+        buffer->eraseFromParent();
+    }
+
+    ++NumPipelinedLoops;
+    return true;
+  }
+};
+
+char DoubleBuffering::ID;
+
+static RegisterPass<DoubleBuffering>
+X("cudarrays-double-buffer",
+  "Double buffer the shared memory tiles of the kernel loops",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,69 @@
+#include "IRHelpers.h"
+
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+const CallInst *getSharedToGeneric(const Value *val) {
+  const IntrinsicInst *call = dyn_cast<IntrinsicInst>(val);
+  return call && call->getIntrinsicID() == Intrinsic::nvvm_ptr_shared_to_gen ?
+    call : NULL;
+}
+
+static bool isToGeneric(const IntrinsicInst *call) {
+  switch (call->getIntrinsicID()) {
+  case Intrinsic::nvvm_ptr_global_to_gen:
+  case Intrinsic::nvvm_ptr_shared_to_gen:
+  case Intrinsic::nvvm_ptr_constant_to_gen:
+  case Intrinsic::nvvm_ptr_local_to_gen:
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool isGlobalMemory(const Value *ptr) {
+  while (true) {
+    unsigned addrSpace = ptr->getType()->getPointerAddressSpace();
+    if (addrSpace != 0 && addrSpace != 1) return false;
+
+    const Value *object = GetUnderlyingObject(ptr, NULL);
+    if (isa<AllocaInst>(object)) return false;
+
+    const IntrinsicInst *call = dyn_cast<IntrinsicInst>(object);
+    if (!call || !isToGeneric(call)) return true;
+    ptr = call->getArgOperand(0);
+  }
+}
+
+static void collectLoops(Loop *L, SmallVectorImpl<Loop *> &loops,
+                         bool innerFirst) {
+  if (!innerFirst) loops.push_back(L);
+  for (Loop *sub : *L)
+    collectLoops(sub, loops, innerFirst);
+  if (innerFirst) loops.push_back(L);
+}
+
+void collectLoops(LoopInfo &LI, SmallVectorImpl<Loop *> &loops,
+                  bool innerFirst) {
+  for (Loop *L : LI)
+    collectLoops(L, loops, innerFirst);
+}
+
+std::string quote(StringRef str) {
+  std::string ret = "\"";
+  for (char c : str) {
+    if (c == '"' || c == '\\') ret += '\\';
+    ret += c;
+  }
+  return ret + "\"";
+}
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,37 @@
+#ifndef IR_HELPERS_H
+#define IR_HELPERS_H
+
+#include <string>
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+
+namespace llvm {
+class CallInst;
+class Loop;
+class LoopInfo;
+class Value;
+}
+
+namespace platonic {
+
+// The llvm.nvvm.ptr.shared.to.gen call val is, or NULL
+const llvm::CallInst *getSharedToGeneric(const llvm::Value *val);
+
+// Whether the loads and stores at ptr go to global memory. Shared (3),
+// constant (4) and local (5) pointers do not, and neither do generic ones
+// converted from them by llvm.nvvm.ptr.*.to.gen or pointing to allocas,
+// e.g. the ones that hold the dynarray objects.
+bool isGlobalMemory(const llvm::Value *ptr);
+
+// Appends the loops of LI, outer loops first or inner loops first
+void collectLoops(llvm::LoopInfo &LI,
+                  llvm::SmallVectorImpl<llvm::Loop *> &loops,
+                  bool innerFirst);
+
+// str as a double-quoted JSON string, which YAML also reads
+std::string quote(llvm::StringRef str);
+
+}
+
+#endif // IR_HELPERS_H
@@ -0,0 +1,575 @@
+#include "KernelClones.h"
+
+#include "CUDArraysSymbols.h"
+#include "KernelSummary.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/InstructionSimplify.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/InlineAsm.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Intrinsics.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/ValueHandle.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/Local.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "delinear"
+
+STATISTIC(NumZeroOffsetClones, "Number of zero block offset kernel clones");
+STATISTIC(NumOffsetReads,      "Number of block offset reads folded");
+STATISTIC(NumReadOnlyClones,   "Number of read-only cache kernel clones");
+STATISTIC(NumGlobalLoads,      "Number of dynarray loads through the read-only cache");
+STATISTIC(NumNoAliasClones,    "Number of noalias kernel clones");
+STATISTIC(NumScopedAccesses,   "Number of dynarray accesses with alias scopes");
+STATISTIC(NumCoarsenedClones,  "Number of coarsened kernel clones");
+
+namespace platonic {
+
+void copyKernelAnnotations(Function &fun, Function *clone) {
+  Module &M = *fun.getParent();
+  NamedMDNode *annotations = M.getNamedMetadata("nvvm.annotations");
+  if (!annotations) return;
+
+  for (unsigned i = 0, e = annotations->getNumOperands(); i < e; ++i) {
+    MDNode *node = annotations->getOperand(i);
+    if (node->getNumOperands() == 0 ||
+        mdconst::dyn_extract_or_null<Function>(node->getOperand(0)) != &fun)
+      continue;
+
+    SmallVector<Metadata *, 8> ops(node->op_begin(), node->op_end());
+    ops[0] = ValueAsMetadata::get(clone);
+    annotations->addOperand(MDNode::get(M.getContext(), ops));
+  }
+}
+
+Function *cloneKernel(Function &fun, StringRef suffix,
+                      ValueToValueMapTy &VMap) {
+  Function *clone = CloneFunction(&fun, VMap, false);
+  clone->setName(fun.getName() + suffix);
+  fun.getParent()->getFunctionList().push_back(clone);
+
+  copyKernelAnnotations(fun, clone);
+  return clone;
+}
+
+// Reads of the block offset: loads from the 'offset' global and fields of
+// the dim3 'off' argument (see SymExprBuilder). Returns the mask of the
+// grid dimensions read, which is 7 when they cannot be told apart.
+static unsigned getOffsetRead(const Instruction &inst) {
+  if (const ExtractValueInst *extract = dyn_cast<ExtractValueInst>(&inst)) {
+    const Argument *arg = dyn_cast<Argument>(extract->getAggregateOperand());
+    if (!arg || !arg->getName().endswith("off")) return 0;
+    if (extract->getNumIndices() != 1 || extract->getIndices()[0] > 2)
+      return 7;
+    return 1 << extract->getIndices()[0];
+  }
+
+  const LoadInst *load = dyn_cast<LoadInst>(&inst);
+  if (!load || !load->getType()->isIntegerTy()) return 0;
+
+  unsigned dims = 7;
+  const GlobalValue *global =
+    dyn_cast<GlobalValue>(load->getPointerOperand()->stripPointerCasts());
+  if (const ConstantExpr *gep =
+        dyn_cast<ConstantExpr>(load->getPointerOperand())) {
+    if (gep->getOpcode() == Instruction::GetElementPtr) {
+      global = dyn_cast<GlobalValue>(gep->getOperand(0));
+      const ConstantInt *field = gep->getNumOperands() == 3 ?
+        dyn_cast<ConstantInt>(gep->getOperand(2)) : NULL;
+      if (field && field->getZExtValue() <= 2)
+        dims = 1 << field->getZExtValue();
+    }
+  } else if (global && load->getType()->getIntegerBitWidth() <= 32) {
+    // The first field of the global
+    dims = 1;
+  }
+  if (!global || !global->getName().startswith("offset")) return 0;
+  return dims;
+}
+
+unsigned getOffsetDims(Function &fun) {
+  unsigned dims = 0;
+  for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it)
+    dims |= getOffsetRead(*it);
+  return dims;
+}
+
+Function *createZeroOffsetClone(Function &fun, unsigned dims) {
+  if (!(getOffsetDims(fun) & dims)) return NULL;
+
+  // _off0 for all the offsets, _off0x, _off0xy... for some of them
+  std::string suffix = "_off0";
+  if (dims != 7) {
+    for (unsigned dim = 0; dim < 3; ++dim)
+      if (dims & (1 << dim)) suffix += "xyz"[dim];
+  }
+
+  ValueToValueMapTy VMap;
+  Function *clone = cloneKernel(fun, suffix, VMap);
+
+  // Reads whose dimension is unknown are only folded when all are zero
+  std::vector<Instruction *> reads;
+  for (inst_iterator it = inst_begin(clone), E = inst_end(clone); it != E; ++it) {
+    unsigned read = getOffsetRead(*it);
+    if (read && (read & ~dims) == 0 && it->getType()->isIntegerTy())
+      reads.push_back(&*it);
+  }
+
+  // Fold the offset adds (b + off) and whatever depends on them
+  for (Instruction *read : reads) {
+    SmallVector<WeakVH, 8> users;
+    for (User *user : read->users())
+      users.push_back(user);
+
+    read->replaceAllUsesWith(Constant::getNullValue(read->getType()));
+    RecursivelyDeleteTriviallyDeadInstructions(read);
+    ++NumOffsetReads;
+
+    for (WeakVH &user : users) {
+      if (Instruction *inst = dyn_cast_or_null<Instruction>(user))
+        recursivelySimplifyInstruction(inst);
+    }
+  }
+
+  for (BasicBlock &bb : *clone)
+    ConstantFoldTerminator(&bb);
+  removeUnreachableBlocks(*clone);
+
+  ++NumZeroOffsetClones;
+  return clone;
+}
+
+// Whether an element pointer returned by an accessor is only loaded from.
+// Pointers passed to calls or stored are conservatively taken as written.
+static bool isOnlyLoaded(Value *ptr, SmallVectorImpl<LoadInst *> &loads) {
+  for (User *user : ptr->users()) {
+    if (LoadInst *load = dyn_cast<LoadInst>(user)) {
+      if (load->isVolatile()) return false;
+      loads.push_back(load);
+      continue;
+    }
+    if (isa<GetElementPtrInst>(user) || isa<BitCastInst>(user)) {
+      if (!isOnlyLoaded(user, loads)) return false;
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+// ldg is only available for scalars in the generic address space
+static bool canLoadGlobal(const LoadInst *load) {
+  Type *type = load->getType();
+  return load->getPointerAddressSpace() == 0 && load->getAlignment() != 0 &&
+         (type->isIntegerTy() || type->isFloatingPointTy() ||
+          type->isPointerTy());
+}
+
+static void loadGlobal(LoadInst *load) {
+  Module *M = load->getParent()->getParent()->getParent();
+  Type *type = load->getType();
+
+  Intrinsic::ID id = Intrinsic::nvvm_ldg_global_i;
+  if (type->isFloatingPointTy())
+    id = Intrinsic::nvvm_ldg_global_f;
+  else if (type->isPointerTy())
+    id = Intrinsic::nvvm_ldg_global_p;
+
+  // dynarray storage is always allocated in global memory
+  IRBuilder<> B(load);
+  Type *ptrTy = type->getPointerTo(1);
+  Value *ptr = B.CreateAddrSpaceCast(load->getPointerOperand(), ptrTy);
+
+  Type *types[] = { type, ptrTy };
+  Function *ldg = Intrinsic::getDeclaration(M, id, types);
+  CallInst *call = B.CreateCall2(ldg, ptr, B.getInt32(load->getAlignment()),
+                                 load->getName());
+  call->setDebugLoc(load->getDebugLoc());
+
+  load->replaceAllUsesWith(call);
+  load->eraseFromParent();
+  ++NumGlobalLoads;
+}
+
+// Whether a dynarray copy is used for anything but the copy of its
+// argument and the accessor and get_dim calls, e.g. passed to another
+// function or read field by field. Such uses are taken as writes.
+static bool hasOtherUses(const Value *ptr, const SymbolIndex &symbols) {
+  for (const User *user : ptr->users()) {
+    if (const StoreInst *store = dyn_cast<StoreInst>(user)) {
+      if (store->getPointerOperand() == ptr &&
+          isa<Argument>(store->getValueOperand()))
+        continue;
+      return true;
+    }
+    if (isa<BitCastInst>(user) || findAllocaSource(user)) {
+      if (hasOtherUses(user, symbols)) return true;
+      continue;
+    }
+
+    const CallInst *call = dyn_cast<CallInst>(user);
+    if (!call || call->getArgOperand(0) != ptr ||
+        !symbols.is(call, SymbolKind(SymbolDynarrayAccessor |
+                                     SymbolDynarrayGetDim)))
+      return true;
+    for (unsigned i = 1; i < call->getNumArgOperands(); ++i)
+      if (call->getArgOperand(i) == ptr) return true;
+  }
+  return false;
+}
+
+// The argument a dynarray is copied from must only be copied
+static bool isOnlyCopied(const Argument *arg, const AllocaInst *alloca) {
+  for (const User *user : arg->users()) {
+    const StoreInst *store = dyn_cast<StoreInst>(user);
+    if (!store || store->getValueOperand() != arg ||
+        findAllocaSource(store->getPointerOperand()) != alloca)
+      return false;
+  }
+  return true;
+}
+
+// Whether the summary proves that the dynarray argument is never written
+static bool isReadOnlyArgument(const KernelSummary &summary, unsigned argNo) {
+  for (const ArraySummary &array : summary.arrays) {
+    if (array.status != ArrayFailed && array.argNo == argNo)
+      return !array.isWritten;
+  }
+  return false;
+}
+
+Function *createReadOnlyClone(Function &fun, const KernelSummary &summary,
+                              const SymbolIndex &symbols, unsigned &kind) {
+  // Loads of each dynarray and whether it is written
+  DenseMap<const AllocaInst *, SmallVector<LoadInst *, 16> > arrays;
+  DenseMap<const AllocaInst *, bool> written;
+  DenseMap<const AllocaInst *, const Argument *> args;
+
+  for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    if (StoreInst *store = dyn_cast<StoreInst>(&*it)) {
+      const Argument *arg = dyn_cast<Argument>(store->getValueOperand());
+      const AllocaInst *alloca = findAllocaSource(store->getPointerOperand());
+      if (arg && alloca) args[alloca] = arg;
+      continue;
+    }
+
+    CallInst *call = dyn_cast<CallInst>(&*it);
+    if (!call || !symbols.is(call, SymbolDynarrayAccessor)) continue;
+
+    const AllocaInst *alloca = findAllocaSource(call->getArgOperand(0));
+    SmallVector<LoadInst *, 16> &loads = arrays[alloca];
+    if (!alloca || !isOnlyLoaded(call, loads))
+      written[alloca] = true;
+  }
+
+  // The accessor results are not the only way to write a dynarray: the
+  // write set of the summary and the other uses of its copy must agree
+  for (auto &array : arrays) {
+    const AllocaInst *alloca = array.first;
+    const Argument *arg = alloca ? args.lookup(alloca) : NULL;
+    if (!arg || !isReadOnlyArgument(summary, arg->getArgNo()) ||
+        !isOnlyCopied(arg, alloca) || hasOtherUses(alloca, symbols))
+      written[alloca] = true;
+  }
+
+  bool anyWritten = false;
+  std::vector<LoadInst *> readOnly;
+  for (auto &array : arrays) {
+    if (written.lookup(array.first)) {
+      anyWritten = true;
+      continue;
+    }
+
+    for (LoadInst *load : array.second) {
+      if (canLoadGlobal(load))
+        readOnly.push_back(load);
+    }
+  }
+  if (readOnly.empty()) return NULL;
+
+  ValueToValueMapTy VMap;
+  Function *clone = cloneKernel(fun, "_ldg", VMap);
+  for (LoadInst *load : readOnly)
+    loadGlobal(cast<LoadInst>(VMap[load]));
+
+  kind = anyWritten? CloneDistinctArrays: 0;
+  ++NumReadOnlyClones;
+  return clone;
+}
+
+// Loads and stores through an element pointer returned by an accessor
+static void collectAccesses(Value *ptr, SmallVectorImpl<Instruction *> &accesses) {
+  for (User *user : ptr->users()) {
+    if (LoadInst *load = dyn_cast<LoadInst>(user)) {
+      accesses.push_back(load);
+    } else if (StoreInst *store = dyn_cast<StoreInst>(user)) {
+      if (store->getPointerOperand() == ptr)
+        accesses.push_back(store);
+    } else if (isa<GetElementPtrInst>(user) || isa<BitCastInst>(user)) {
+      collectAccesses(user, accesses);
+    }
+  }
+}
+
+// Only dynarrays copied from a kernel argument are covered by the contract
+static bool isArgumentCopy(const AllocaInst *alloca) {
+  for (const User *user : alloca->users()) {
+    const StoreInst *store = dyn_cast<StoreInst>(user);
+    if (store && isa<Argument>(store->getValueOperand())) return true;
+  }
+  return false;
+}
+
+Function *createNoAliasClone(Function &fun, const SymbolIndex &symbols) {
+  // Element accesses of each dynarray argument, in program order
+  std::vector<const AllocaInst *> order;
+  DenseMap<const AllocaInst *, SmallVector<Instruction *, 16> > arrays;
+  bool anyStore = false;
+
+  for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    CallInst *call = dyn_cast<CallInst>(&*it);
+    if (!call || !symbols.is(call, SymbolDynarrayAccessor)) continue;
+
+    const AllocaInst *alloca = findAllocaSource(call->getArgOperand(0));
+    if (!alloca || !isArgumentCopy(alloca)) continue;
+
+    if (!arrays.count(alloca)) order.push_back(alloca);
+    SmallVector<Instruction *, 16> &accesses = arrays[alloca];
+    unsigned first = accesses.size();
+    collectAccesses(call, accesses);
+    for (unsigned i = first; i < accesses.size(); ++i)
+      anyStore = anyStore || isa<StoreInst>(accesses[i]);
+  }
+
+  if (order.size() < 2 || !anyStore) return NULL;
+
+  ValueToValueMapTy VMap;
+  Function *clone = cloneKernel(fun, "_noalias", VMap);
+
+  MDBuilder MDB(fun.getContext());
+  MDNode *domain = MDB.createAnonymousAliasScopeDomain(clone->getName());
+  std::vector<Metadata *> scopes;
+  for (const AllocaInst *alloca : order)
+    scopes.push_back(MDB.createAnonymousAliasScope(domain, alloca->getName()));
+
+  for (unsigned i = 0; i < order.size(); ++i) {
+    std::vector<Metadata *> others(scopes);
+    others.erase(others.begin() + i);
+    MDNode *scope = MDNode::get(fun.getContext(), scopes[i]);
+    MDNode *noalias = MDNode::get(fun.getContext(), others);
+
+    for (Instruction *access : arrays[order[i]]) {
+      Instruction *inst = cast<Instruction>(VMap[access]);
+      MDNode *oldScope = inst->getMetadata(LLVMContext::MD_alias_scope);
+      MDNode *oldNoAlias = inst->getMetadata(LLVMContext::MD_noalias);
+      inst->setMetadata(LLVMContext::MD_alias_scope,
+                        MDNode::concatenate(oldScope, scope));
+      inst->setMetadata(LLVMContext::MD_noalias,
+                        MDNode::concatenate(oldNoAlias, noalias));
+      ++NumScopedAccesses;
+    }
+  }
+
+  ++NumNoAliasClones;
+  return clone;
+}
+
+static const Intrinsic::ID BlockIdxRegisters[] = {
+  Intrinsic::nvvm_read_ptx_sreg_ctaid_x,
+  Intrinsic::nvvm_read_ptx_sreg_ctaid_y,
+  Intrinsic::nvvm_read_ptx_sreg_ctaid_z
+};
+
+static const Intrinsic::ID GridSizeRegisters[] = {
+  Intrinsic::nvvm_read_ptx_sreg_nctaid_x,
+  Intrinsic::nvvm_read_ptx_sreg_nctaid_y,
+  Intrinsic::nvvm_read_ptx_sreg_nctaid_z
+};
+
+static bool hasBarrier(const Function &fun) {
+  for (const_inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    const CallInst *call = dyn_cast<CallInst>(&*it);
+    const Function *callee = call ? call->getCalledFunction() : NULL;
+    if (!callee) continue;
+
+    Intrinsic::ID id = Intrinsic::ID(callee->getIntrinsicID());
+    if (id == Intrinsic::cuda_syncthreads || id == Intrinsic::nvvm_barrier0)
+      return true;
+  }
+  return false;
+}
+
+// Whether fun reads the block index or the grid size along gridDim. The
+// reads in the kernel itself are rewritten by createBlockFunction, so for
+// the kernel only those of the functions it calls count. Indirect calls
+// may read them.
+static bool readsBlock(const Function &fun, unsigned gridDim, bool kernel,
+                       SmallPtrSetImpl<const Function *> &visited) {
+  for (const_inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    const CallInst *call = dyn_cast<CallInst>(&*it);
+    if (!call || isa<InlineAsm>(call->getCalledValue())) continue;
+
+    const Function *callee =
+      dyn_cast<Function>(call->getCalledValue()->stripPointerCasts());
+    if (!callee) return true;
+
+    if (callee->isDeclaration()) {
+      Intrinsic::ID id = Intrinsic::ID(callee->getIntrinsicID());
+      if (!kernel && (id == BlockIdxRegisters[gridDim] ||
+                      id == GridSizeRegisters[gridDim]))
+        return true;
+    } else if (visited.insert(callee).second &&
+               readsBlock(*callee, gridDim, false, visited)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Clones the kernel into an internal function that runs one logical block,
+// whose index along gridDim is passed as an extra argument
+static Function *createBlockFunction(Function &fun, unsigned gridDim,
+                                     unsigned factor) {
+  Module &M = *fun.getParent();
+  LLVMContext &ctx = fun.getContext();
+
+  std::vector<Type *> params(fun.getFunctionType()->param_begin(),
+                             fun.getFunctionType()->param_end());
+  params.push_back(Type::getInt32Ty(ctx));
+  FunctionType *type = FunctionType::get(fun.getReturnType(), params, false);
+  Function *block = Function::Create(type, GlobalValue::InternalLinkage,
+                                     fun.getName() + ".block", &M);
+
+  ValueToValueMapTy VMap;
+  Function::arg_iterator dest = block->arg_begin();
+  for (Function::arg_iterator arg = fun.arg_begin(), E = fun.arg_end();
+       arg != E; ++arg, ++dest) {
+    dest->setName(arg->getName());
+    VMap[arg] = dest;
+  }
+  Argument *blockIdx = dest;
+  blockIdx->setName("blockIdx");
+
+  SmallVector<ReturnInst *, 8> returns;
+  CloneFunctionInto(block, &fun, VMap, false, returns);
+  block->removeFnAttr(Attribute::NoInline);
+  block->addFnAttr(Attribute::AlwaysInline);
+
+  // Logical block index and grid size along gridDim
+  std::vector<CallInst *> reads;
+  for (inst_iterator it = inst_begin(block), E = inst_end(block); it != E; ++it) {
+    CallInst *call = dyn_cast<CallInst>(&*it);
+    const Function *callee = call ? call->getCalledFunction() : NULL;
+    if (!callee) continue;
+
+    Intrinsic::ID id = Intrinsic::ID(callee->getIntrinsicID());
+    if (id == BlockIdxRegisters[gridDim] || id == GridSizeRegisters[gridDim])
+      reads.push_back(call);
+  }
+
+  for (CallInst *call : reads) {
+    if (call->getCalledFunction()->getIntrinsicID() == BlockIdxRegisters[gridDim]) {
+      call->replaceAllUsesWith(blockIdx);
+      call->eraseFromParent();
+      continue;
+    }
+
+    Instruction *size = BinaryOperator::CreateMul(
+      call, ConstantInt::get(call->getType(), factor), "coarse.nctaid");
+    size->insertAfter(call);
+    call->replaceAllUsesWith(size);
+    size->setOperand(0, call);
+  }
+
+  return block;
+}
+
+Function *createCoarsenedClone(Function &fun, const KernelSummary &summary,
+                               unsigned factor, unsigned &gridDim) {
+  // Every access must be known for the blocks to be merged, and the
+  // accesses tell which grid dimensions partition the work
+  unsigned used = 0;
+  for (const ArraySummary &array : summary.arrays) {
+    if (array.status == ArrayUnanalysed || array.status == ArrayFailed)
+      return NULL;
+    for (unsigned mask : array.dimMasks)
+      used |= mask;
+  }
+  if (!used) return NULL;
+
+  // The outermost dimension: merged blocks then cover consecutive rows
+  // and the blocks along x keep their coalesced accesses
+  // (DimMask: 1 x, 2 y, 4 z)
+  gridDim = used & 4 ? 2 : used & 2 ? 1 : 0;
+
+  // Device functions that were not inlined would still see the physical
+  // block
+  SmallPtrSet<const Function *, 8> visited;
+  if (readsBlock(fun, gridDim, true, visited)) return NULL;
+
+  Module &M = *fun.getParent();
+  Function *block = createBlockFunction(fun, gridDim, factor);
+
+  Function *clone = Function::Create(fun.getFunctionType(), fun.getLinkage(),
+                                     fun.getName() + "_coarse" + utostr(factor),
+                                     &M);
+  clone->copyAttributesFrom(&fun);
+  copyKernelAnnotations(fun, clone);
+
+  std::vector<Value *> args;
+  Function::arg_iterator dest = clone->arg_begin();
+  for (Function::arg_iterator arg = fun.arg_begin(), E = fun.arg_end();
+       arg != E; ++arg, ++dest) {
+    dest->setName(arg->getName());
+    args.push_back(dest);
+  }
+
+  //   for (r = 0; r < factor; ++r)
+  //     block(args, blockIdx * factor + r);
+  LLVMContext &ctx = fun.getContext();
+  BasicBlock *entry = BasicBlock::Create(ctx, "entry", clone);
+  BasicBlock *loop = BasicBlock::Create(ctx, "coarse.loop", clone);
+  BasicBlock *exit = BasicBlock::Create(ctx, "coarse.exit", clone);
+
+  IRBuilder<> B(entry);
+  Value *blockIdx =
+    B.CreateCall(Intrinsic::getDeclaration(&M, BlockIdxRegisters[gridDim]));
+  Value *first = B.CreateMul(blockIdx, B.getInt32(factor), "coarse.first");
+  B.CreateBr(loop);
+
+  B.SetInsertPoint(loop);
+  PHINode *r = B.CreatePHI(B.getInt32Ty(), 2, "coarse.r");
+  r->addIncoming(B.getInt32(0), entry);
+  args.push_back(B.CreateAdd(first, r, "coarse.block"));
+  B.CreateCall(block, args);
+  // The next logical block must not overwrite the shared memory still in
+  // use by the threads of this one
+  if (hasBarrier(fun))
+    B.CreateCall(Intrinsic::getDeclaration(&M, Intrinsic::cuda_syncthreads));
+  Value *next = B.CreateAdd(r, B.getInt32(1), "coarse.next");
+  r->addIncoming(next, loop);
+  B.CreateCondBr(B.CreateICmpULT(next, B.getInt32(factor)), loop, exit);
+
+  B.SetInsertPoint(exit);
+  B.CreateRetVoid();
+
+  ++NumCoarsenedClones;
+  return clone;
+}
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,84 @@
+#ifndef KERNEL_CLONES_H
+#define KERNEL_CLONES_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Transforms/Utils/ValueMapper.h"
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+class SymbolIndex;
+struct KernelSummary;
+
+// Specializations registered with the runtime, which picks a clone per
+// launch when all its conditions are met
+enum KernelCloneKind {
+  // Launches whose block offsets (the 'offset' global and the dim3 'off'
+  // argument) are zero, i.e. the kernel runs on a single GPU
+  CloneZeroOffset = 1 << 0,
+  // Launches whose dynarray arguments do not share storage
+  CloneDistinctArrays = 1 << 1,
+  // Launches whose block offset is zero along one grid dimension, i.e.
+  // the dimension is not partitioned across GPUs
+  CloneZeroOffsetX = 1 << 2,
+  CloneZeroOffsetY = 1 << 3,
+  CloneZeroOffsetZ = 1 << 4
+};
+
+// Copies the nvvm.annotations of the kernel so that clone is launched as
+// a kernel with the same bounds
+void copyKernelAnnotations(llvm::Function &fun, llvm::Function *clone);
+
+// Clones the kernel into <name><suffix>, adds it to the module and copies
+// its nvvm.annotations so that it is launched as a kernel too
+llvm::Function *cloneKernel(llvm::Function &fun, llvm::StringRef suffix,
+                            llvm::ValueToValueMapTy &VMap);
+
+// Returns the mask (bit i: grid dimension i) of the block offsets the
+// kernel reads
+unsigned getOffsetDims(llvm::Function &fun);
+
+// Returns the clone of the kernel for zero block offsets along the grid
+// dimensions in dims (bit i: grid dimension i), with the offset reads
+// folded, or NULL if the kernel does not read those offsets
+llvm::Function *createZeroOffsetClone(llvm::Function &fun, unsigned dims = 7);
+
+// Returns the clone of the kernel that loads the read-only dynarrays
+// through the non-coherent texture cache (ld.global.nc), or NULL if no
+// dynarray is read-only. A dynarray is read-only when the summary does
+// not write it and its copy is only used by the accessors whose results
+// are loaded. kind is set to the conditions of the clone:
+// CloneDistinctArrays when another dynarray is written, as it could share
+// storage with the read-only ones.
+llvm::Function *createReadOnlyClone(llvm::Function &fun,
+                                    const KernelSummary &summary,
+                                    const SymbolIndex &symbols,
+                                    unsigned &kind);
+
+// Returns the clone of the kernel for launches with CloneDistinctArrays,
+// where the element accesses of each dynarray argument get their own
+// alias scope and are marked noalias with the other dynarrays. Returns
+// NULL if the kernel does not write a dynarray and read another one.
+llvm::Function *createNoAliasClone(llvm::Function &fun,
+                                   const SymbolIndex &symbols);
+
+// Returns the clone of the kernel where every block runs factor
+// consecutive blocks of the original along gridDim, which is chosen from
+// the grid dimensions that index the arrays. The clone is launched with
+// the grid divided by factor along gridDim, so it has no remainder
+// blocks: it may only replace launches whose grid size along gridDim is a
+// multiple of factor, the other launches run the original kernel. Returns
+// NULL if some access
+// could not be analysed, no access depends on the block index, or a
+// function the kernel calls reads the block index or grid size along
+// gridDim.
+llvm::Function *createCoarsenedClone(llvm::Function &fun,
+                                     const KernelSummary &summary,
+                                     unsigned factor, unsigned &gridDim);
+
+}
+
+#endif // KERNEL_CLONES_H
@@ -0,0 +1,209 @@
+#include "KernelFusion.h"
+
+#include "KernelClones.h"
+#include "KernelSummary.h"
+
+#include "llvm/ADT/Statistic.h"
+#include "llvm/IR/Attributes.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/ValueMapper.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "delinear"
+
+STATISTIC(NumFusedKernels, "Number of fused producer/consumer kernels");
+STATISTIC(NumSharedArrays, "Number of arrays passed between fused kernels");
+
+namespace platonic {
+
+// Whether the element an index selects only depends on the thread, and
+// is the same in both kernels when the arrays share storage. Parameters
+// are arguments of different kernels and cannot be compared.
+static bool isSameIndex(const SymExpr &a, unsigned arrayA,
+                        const SymExpr &b, unsigned arrayB) {
+  if (a.kind != b.kind || a.ops.size() != b.ops.size()) return false;
+
+  switch (a.kind) {
+  case SymExpr::SymConst:
+    return a.value == b.value;
+  case SymExpr::SymParam:
+  case SymExpr::SymUDiv:
+  case SymExpr::SymAddRec:
+    return false;
+  case SymExpr::SymDim:
+    // Extents of the shared array itself
+    return a.arg == arrayA && b.arg == arrayB && a.index == b.index;
+  default:
+    break;
+  }
+
+  if (a.isLeaf()) return a.index == b.index;
+  for (unsigned i = 0; i < a.ops.size(); ++i)
+    if (!isSameIndex(a.ops[i], arrayA, b.ops[i], arrayB)) return false;
+  return true;
+}
+
+static bool isLeaf(const SymExpr &expr, SymExpr::Kind kind, unsigned dim) {
+  return expr.kind == kind && expr.index == dim;
+}
+
+// Whether a term is blockIdx * blockDim along dim, where the block index
+// may include the block offset of the launch. Terms offset * blockDim are
+// uniform in the launch and accepted without counting as the block.
+static bool isBlockTerm(const SymExpr &term, unsigned dim, unsigned &blocks) {
+  if (term.kind != SymExpr::SymMul || term.ops.size() != 2) return false;
+
+  const SymExpr *block = NULL;
+  if (isLeaf(term.ops[0], SymExpr::SymBlockSize, dim)) block = &term.ops[1];
+  else if (isLeaf(term.ops[1], SymExpr::SymBlockSize, dim)) block = &term.ops[0];
+  if (!block) return false;
+
+  if (isLeaf(*block, SymExpr::SymBlockOffset, dim)) return true;
+  if (isLeaf(*block, SymExpr::SymBlockIdx, dim)) {
+    ++blocks;
+    return true;
+  }
+
+  // (blockIdx + offset) * blockDim
+  if (block->kind != SymExpr::SymAdd || block->ops.size() != 2) return false;
+  bool hasIdx = false, hasOffset = false;
+  for (const SymExpr &op : block->ops) {
+    hasIdx = hasIdx || isLeaf(op, SymExpr::SymBlockIdx, dim);
+    hasOffset = hasOffset || isLeaf(op, SymExpr::SymBlockOffset, dim);
+  }
+  if (!hasIdx || !hasOffset) return false;
+  ++blocks;
+  return true;
+}
+
+// Whether an index is blockIdx * blockDim + threadIdx (plus a constant)
+// along some grid dimension, i.e. each thread of the grid selects its own
+// element. An index driven by the thread index alone selects the same
+// element in every block.
+static bool isGlobalThreadIndex(const SymExpr &index) {
+  if (index.kind != SymExpr::SymAdd) return false;
+
+  for (unsigned dim = 0; dim < 3; ++dim) {
+    unsigned threads = 0, blocks = 0;
+    bool matches = true;
+    for (const SymExpr &term : index.ops) {
+      if (term.kind == SymExpr::SymConst) continue;
+      if (isLeaf(term, SymExpr::SymThreadIdx, dim)) {
+        ++threads;
+        continue;
+      }
+      matches = matches && isBlockTerm(term, dim, blocks);
+    }
+    if (matches && threads == 1 && blocks == 1) return true;
+  }
+  return false;
+}
+
+// Whether every thread accesses the same single element of the array in
+// both kernels, and no other thread of the grid accesses it
+static bool isThreadLocal(const ArraySummary &producer,
+                          const ArraySummary &consumer) {
+  if (producer.dims != consumer.dims ||
+      producer.dimIndices.size() != producer.dims ||
+      consumer.dimIndices.size() != consumer.dims)
+    return false;
+
+  bool byGlobalThread = false;
+  for (unsigned dim = 0; dim < producer.dims; ++dim) {
+    const std::vector<SymExpr> &indices = producer.dimIndices[dim];
+    if (indices.empty() || consumer.dimIndices[dim].empty()) return false;
+
+    const SymExpr &index = indices.front();
+    for (const SymExpr &other : indices)
+      if (!isSameIndex(index, producer.argNo, other, producer.argNo))
+        return false;
+    for (const SymExpr &other : consumer.dimIndices[dim])
+      if (!isSameIndex(index, producer.argNo, other, consumer.argNo))
+        return false;
+
+    byGlobalThread = byGlobalThread || isGlobalThreadIndex(index);
+  }
+  return byGlobalThread;
+}
+
+static bool isAnalysed(const KernelSummary &summary) {
+  for (const ArraySummary &array : summary.arrays) {
+    if (array.status == ArrayUnanalysed || array.status == ArrayFailed)
+      return false;
+  }
+  return true;
+}
+
+// Internal copy of a kernel to be inlined in the fused kernel
+static Function *createStage(Function &fun, StringRef suffix) {
+  ValueToValueMapTy VMap;
+  Function *stage = CloneFunction(&fun, VMap, false);
+  stage->setName(fun.getName() + suffix);
+  stage->setLinkage(GlobalValue::InternalLinkage);
+  stage->removeFnAttr(Attribute::NoInline);
+  stage->addFnAttr(Attribute::AlwaysInline);
+  fun.getParent()->getFunctionList().push_back(stage);
+  return stage;
+}
+
+Function *createFusedKernel(const KernelSummary &producer,
+                            const KernelSummary &consumer,
+                            std::vector<SharedArray> &shared) {
+  if (!isAnalysed(producer) || !isAnalysed(consumer)) return NULL;
+
+  shared.clear();
+  for (const ArraySummary &p : producer.arrays) {
+    for (const ArraySummary &c : consumer.arrays) {
+      // Arrays only read by both kernels can always share storage
+      if (!p.isWritten && !c.isWritten) continue;
+      if (isThreadLocal(p, c))
+        shared.push_back(SharedArray(p.argNo, c.argNo));
+    }
+  }
+
+  Function &first = *producer.fun;
+  Function &second = *consumer.fun;
+  Module &M = *first.getParent();
+
+  std::vector<Type *> params(first.getFunctionType()->param_begin(),
+                             first.getFunctionType()->param_end());
+  params.insert(params.end(), second.getFunctionType()->param_begin(),
+                second.getFunctionType()->param_end());
+  FunctionType *type =
+    FunctionType::get(Type::getVoidTy(M.getContext()), params, false);
+  Function *fused = Function::Create(type, first.getLinkage(),
+                                     first.getName() + "_fused_" +
+                                     second.getName(), &M);
+  copyKernelAnnotations(first, fused);
+
+  std::vector<Value *> firstArgs, secondArgs;
+  Function::arg_iterator arg = fused->arg_begin();
+  for (Argument &param : first.getArgumentList()) {
+    arg->setName(param.getName());
+    firstArgs.push_back(arg++);
+  }
+  for (Argument &param : second.getArgumentList()) {
+    arg->setName(param.getName());
+    secondArgs.push_back(arg++);
+  }
+
+  // The stages are inlined, so the consumer loads of the elements the
+  // producer stored in the same thread can be forwarded from registers
+  IRBuilder<> B(BasicBlock::Create(M.getContext(), "entry", fused));
+  B.CreateCall(createStage(first, ".producer"), firstArgs);
+  B.CreateCall(createStage(second, ".consumer"), secondArgs);
+  B.CreateRetVoid();
+
+  NumSharedArrays += shared.size();
+  ++NumFusedKernels;
+  return fused;
+}
+
+}
+
+// vim: set ts=2 sw=2:
@@ -0,0 +1,37 @@
+#ifndef KERNEL_FUSION_H
+#define KERNEL_FUSION_H
+
+#include <utility>
+#include <vector>
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+struct KernelSummary;
+
+// Argument indices (producer, consumer) of two dynarrays that may share
+// storage in the fused kernel
+using SharedArray = std::pair<unsigned, unsigned>;
+
+// Returns the kernel that runs the producer and then the consumer in every
+// thread, for back-to-back launches with the same grid and blocks. Its
+// arguments are those of the producer followed by those of the consumer.
+//
+// Fusion is correct when every element written by one kernel and accessed
+// by the other is accessed by the same thread in both, so that no thread
+// needs another to finish. This is proven when the indices are the same
+// in both kernels and one of them is blockIdx * blockDim + threadIdx, so
+// that no two threads of the grid share an element. shared is set to the
+// pairs of arrays for which this was proven; the runtime must only use the fused kernel when the
+// other pairs with a written array do not share storage. Returns NULL if
+// some access of either kernel could not be analysed.
+llvm::Function *createFusedKernel(const KernelSummary &producer,
+                                  const KernelSummary &consumer,
+                                  std::vector<SharedArray> &shared);
+
+}
+
+#endif // KERNEL_FUSION_H
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "KernelIntensity.h"
+
+#include "llvm/Pass.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "CUDArraysSymbols.h"
+#include "IRHelpers.h"
+#include "LaunchBounds.h"
+
+using namespace llvm;
+
+static cl::opt<unsigned>
+DefaultTripCount("cudarrays-trip-count",
+                 cl::desc("Trip count assumed for loops whose trip count is unknown"),
+                 cl::init(16));
+
+static cl::opt<std::string>
+IntensityFile("cudarrays-intensity-file",
+              cl::desc("File where the kernel intensities are written as JSON "
+                       "(standard error if empty)"),
+              cl::init(""));
+
+static cl::opt<double>
+MachineBalance("cudarrays-machine-balance",
+               cl::desc("FLOPs per byte above which kernels are compute bound"),
+               cl::init(8.0));
+
+namespace platonic {
+
+static const uint64_t MaxBlockSize = 1024;
+
+double getTripCount(Loop *L, ScalarEvolution &SE) {
+  double trips = 1;
+  for (; L; L = L->getParentLoop()) {
+    const SCEVConstant *count =
+      dyn_cast<SCEVConstant>(SE.getBackedgeTakenCount(L));
+    if (!count)
+      count = dyn_cast<SCEVConstant>(SE.getMaxBackedgeTakenCount(L));
+    trips *= count ? count->getValue()->getZExtValue() + 1.0
+                   : double(DefaultTripCount);
+  }
+  return trips;
+}
+
+static unsigned getNumElements(Type *type) {
+  VectorType *vector = dyn_cast<VectorType>(type);
+  return vector ? vector->getNumElements() : 1;
+}
+
+// Floating-point operations of an instruction: arithmetic, comparisons and
+// math functions count one per element, fused multiply-adds two
+static unsigned countFlops(const Instruction &inst) {
+  switch (inst.getOpcode()) {
+  case Instruction::FAdd:
+  case Instruction::FSub:
+  case Instruction::FMul:
+  case Instruction::FDiv:
+  case Instruction::FRem:
+    return getNumElements(inst.getType());
+  case Instruction::FCmp:
+    return getNumElements(inst.getOperand(0)->getType());
+  default:
+    break;
+  }
+
+  const CallInst *call = dyn_cast<CallInst>(&inst);
+  if (!call || !call->getType()->getScalarType()->isFloatingPointTy())
+    return 0;
+
+  unsigned elements = getNumElements(call->getType());
+  if (const IntrinsicInst *intrinsic = dyn_cast<IntrinsicInst>(call)) {
+    Intrinsic::ID id = intrinsic->getIntrinsicID();
+    return id == Intrinsic::fma || id == Intrinsic::fmuladd ? 2 * elements
+                                                            : elements;
+  }
+
+  // libdevice math functions
+  const Function *callee = call->getCalledFunction();
+  return callee && callee->getName().startswith("__nv_") ? elements : 0;
+}
+
+KernelIntensity computeKernelIntensity(Function &fun, const DataLayout &DL,
+                                       LoopInfo &LI, ScalarEvolution &SE) {
+  LaunchBounds bounds = getLaunchBounds(fun);
+  uint64_t blockSize = 1;
+  for (unsigned i = 0; i < 3; ++i)
+    blockSize = std::min(MaxBlockSize, blockSize * bounds.maxBlockDim[i]);
+
+  double bytes = 0, flops = 0;
+  for (BasicBlock &bb : fun) {
+    double trips = getTripCount(LI.getLoopFor(&bb), SE);
+
+    for (Instruction &inst : bb) {
+      if (LoadInst *load = dyn_cast<LoadInst>(&inst)) {
+        if (isGlobalMemory(load->getPointerOperand()))
+          bytes += trips * DL.getTypeStoreSize(load->getType());
+      } else if (StoreInst *store = dyn_cast<StoreInst>(&inst)) {
+        if (isGlobalMemory(store->getPointerOperand()))
+          bytes += trips *
+            DL.getTypeStoreSize(store->getValueOperand()->getType());
+      } else {
+        flops += trips * countFlops(inst);
+      }
+    }
+  }
+
+  KernelIntensity intensity;
+  intensity.blockSize = blockSize;
+  intensity.bytes = uint64_t(bytes * blockSize);
+  intensity.flops = uint64_t(flops * blockSize);
+  return intensity;
+}
+
+// Reports the bytes, FLOPs and arithmetic intensity of every kernel, as a
+// table and as JSON. Kernels above -cudarrays-machine-balance FLOPs per
+// byte are compute bound and worth distributing across GPUs; the others
+// are bound by the memory transfers.
+class KernelIntensityPrinter : public ModulePass {
+ public:
+  static char ID;
+  KernelIntensityPrinter() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    SymbolIndex symbols(M);
+    const DataLayout &DL = getAnalysis<DataLayoutPass>().getDataLayout();
+
+    std::vector<std::pair<Function *, KernelIntensity> > kernels;
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel)) continue;
+      LoopInfo &LI = getAnalysis<LoopInfo>(fun);
+      ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+      kernels.push_back(std::make_pair(&fun,
+                                       computeKernelIntensity(fun, DL, LI, SE)));
+    }
+
+    printTable(kernels, symbols);
+
+    std::unique_ptr<raw_fd_ostream> file;
+    if (!IntensityFile.empty()) {
+      std::error_code EC;
+      file.reset(new raw_fd_ostream(IntensityFile, EC, sys::fs::F_Text));
+      if (EC) {
+        errs() << "Cannot open intensity file " << IntensityFile << ": "
+               << EC.message() << "\n";
+        return false;
+      }
+    }
+    // Not outs(), where opt writes the bitcode
+    printJSON(file ? *file : errs(), kernels, symbols);
+
+    return false;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<LoopInfo>();
+    AU.addRequired<ScalarEvolution>();
+    AU.setPreservesAll();
+  }
+
+ private:
+  typedef std::vector<std::pair<Function *, KernelIntensity> > KernelList;
+
+  static const char *getBound(const KernelIntensity &intensity) {
+    return intensity.getIntensity() >= MachineBalance ? "compute" : "memory";
+  }
+
+  static void printTable(const KernelList &kernels,
+                         const SymbolIndex &symbols) {
+    errs() << format("%-40s %8s %14s %14s %10s %8s\n", "Kernel", "Threads",
+                     "Bytes/block", "FLOPs/block", "FLOP/byte", "Bound");
+    for (auto &kernel : kernels) {
+      const KernelIntensity &intensity = kernel.second;
+      std::string name = symbols.getDemangledName(kernel.first);
+      if (name.size() > 40) name = name.substr(0, 37) + "...";
+      errs() << format("%-40s %8llu %14llu %14llu %10.3f %8s\n", name.c_str(),
+                       (unsigned long long)intensity.blockSize,
+                       (unsigned long long)intensity.bytes,
+                       (unsigned long long)intensity.flops,
+                       intensity.getIntensity(), getBound(intensity));
+    }
+  }
+
+  static void printJSON(raw_ostream &out, const KernelList &kernels,
+                        const SymbolIndex &symbols) {
+    out << "{\n  \"machineBalance\": " << format("%g", double(MachineBalance))
+        << ",\n  \"kernels\": [";
+    for (size_t i = 0; i < kernels.size(); ++i) {
+      const KernelIntensity &intensity = kernels[i].second;
+      out << (i ? ",\n" : "\n") << "    {\n"
+          << "      \"name\": " << quote(kernels[i].first->getName()) << ",\n"
+          << "      \"demangled\": "
+          << quote(symbols.getDemangledName(kernels[i].first)) << ",\n"
+          << "      \"blockSize\": " << intensity.blockSize << ",\n"
+          << "      \"bytesPerBlock\": " << intensity.bytes << ",\n"
+          << "      \"flopsPerBlock\": " << intensity.flops << ",\n"
+          << "      \"intensity\": "
+          << format("%g", intensity.getIntensity()) << ",\n"
+          << "      \"bound\": \"" << getBound(intensity) << "\"\n"
+          << "    }";
+    }
+    out << "\n  ]\n}\n";
+  }
+};
+
+char KernelIntensityPrinter::ID;
+
+static RegisterPass<KernelIntensityPrinter>
+X("cudarrays-intensity",
+  "Print the arithmetic intensity of the kernels",
+  true, true);
+
+}
+
+// vim: set ts=2 sw=2:
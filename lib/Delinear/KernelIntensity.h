@@ -0,0 +1,47 @@
+#ifndef KERNEL_INTENSITY_H
+#define KERNEL_INTENSITY_H
+
+#include <stdint.h>
+
+namespace llvm {
+class DataLayout;
+class Function;
+class Loop;
+class LoopInfo;
+class ScalarEvolution;
+}
+
+namespace platonic {
+
+// Work of a thread block of a kernel, estimated from its IR. Every thread
+// runs the loops for their SCEV trip counts and every global load and
+// store goes to memory, i.e. the caches give no reuse.
+struct KernelIntensity {
+  // Threads per block, from the launch bounds
+  uint64_t blockSize;
+  // Global memory bytes loaded and stored per block
+  uint64_t bytes;
+  // Floating-point operations per block
+  uint64_t flops;
+
+  KernelIntensity() : blockSize(0), bytes(0), flops(0) {}
+
+  // FLOPs per byte, 0 for kernels that do not access memory
+  double getIntensity() const {
+    return bytes ? double(flops) / double(bytes) : 0;
+  }
+};
+
+KernelIntensity computeKernelIntensity(llvm::Function &fun,
+                                       const llvm::DataLayout &DL,
+                                       llvm::LoopInfo &LI,
+                                       llvm::ScalarEvolution &SE);
+
+// Times a block of L runs per thread, from the trip counts of L and its
+// parents. Loops whose trip count is unknown run -cudarrays-trip-count
+// times. Returns 1 outside loops.
+double getTripCount(llvm::Loop *L, llvm::ScalarEvolution &SE);
+
+}
+
+#endif // KERNEL_INTENSITY_H
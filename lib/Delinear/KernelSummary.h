@@ -0,0 +1,64 @@
+#ifndef KERNEL_SUMMARY_H
+#define KERNEL_SUMMARY_H
+
+#include <string>
+#include <vector>
+
+#include "SymExpr.h"
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+// Distribution decision for an array
+enum ArrayStatus {
+  // At least one dimension is indexed by the block index
+  ArrayPartitioned,
+  // No dimension is indexed by the block index
+  ArrayReplicated,
+  // Replicated because some index could not be analysed
+  ArrayUnanalysed,
+  // Not registered (see reason)
+  ArrayFailed
+};
+
+// Distribution info of a dynarray passed as a kernel argument
+struct ArraySummary {
+  // Index of the array in the kernel argument list
+  unsigned argNo;
+  // Number of dimensions of the array
+  unsigned dims;
+  bool isRead;
+  bool isWritten;
+  // Grid dimensions (DimMask) used to access each array dimension
+  std::vector<unsigned> dimMasks;
+  // Index expressions of the accesses to each dimension. Empty for the
+  // dimensions with some index that could not be lowered.
+  std::vector<std::vector<SymExpr> > dimIndices;
+
+  ArrayStatus status;
+  // Why the array is not partitioned (empty if it is)
+  std::string reason;
+  // Array name and source location of its first access, for the remarks
+  std::string name;
+  std::string file;
+  unsigned line;
+
+  ArraySummary() : argNo(0), dims(0), isRead(false), isWritten(false),
+                   status(ArrayReplicated), line(0) {}
+};
+
+// What Delinear registers in the drivers for a kernel. Arrays are sorted
+// by argument index.
+struct KernelSummary {
+  llvm::Function *fun;
+  std::vector<ArraySummary> arrays;
+
+  KernelSummary() : fun(NULL) {}
+};
+
+}
+
+#endif // KERNEL_SUMMARY_H
@@ -0,0 +1,104 @@
+#include <algorithm>
+
+#include "LaunchBounds.h"
+
+#include "CUDArraysSymbols.h"
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/IR/Module.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+LaunchBounds::LaunchBounds() {
+  // CUDA limits for compute capability 2.0 and above
+  maxBlockDim[0] = 1024;
+  maxBlockDim[1] = 1024;
+  maxBlockDim[2] = 64;
+  maxGridDim[0] = 2147483647u;
+  maxGridDim[1] = 65535;
+  maxGridDim[2] = 65535;
+}
+
+LaunchBounds getLaunchBounds(const Function &fun) {
+  static const char *Keys[][3] = {
+    { "maxntidx", "maxntidy", "maxntidz" },
+    { "reqntidx", "reqntidy", "reqntidz" }
+  };
+
+  LaunchBounds bounds;
+
+  const NamedMDNode *annotations =
+    fun.getParent()->getNamedMetadata("nvvm.annotations");
+  if (!annotations) return bounds;
+
+  // Each annotation is { function, key, value, key, value, ... }
+  for (unsigned i = 0; i < annotations->getNumOperands(); ++i) {
+    const MDNode *node = annotations->getOperand(i);
+    if (node->getNumOperands() < 3) continue;
+    if (mdconst::dyn_extract_or_null<Function>(node->getOperand(0)) != &fun)
+      continue;
+
+    for (unsigned op = 1; op + 1 < node->getNumOperands(); op += 2) {
+      const MDString *key = dyn_cast<MDString>(node->getOperand(op));
+      const ConstantInt *val =
+        mdconst::dyn_extract_or_null<ConstantInt>(node->getOperand(op + 1));
+      if (!key || !val) continue;
+
+      for (unsigned kind = 0; kind < 2; ++kind) {
+        for (unsigned dim = 0; dim < 3; ++dim) {
+          if (key->getString() != Keys[kind][dim]) continue;
+          bounds.maxBlockDim[dim] =
+            std::min<uint64_t>(bounds.maxBlockDim[dim], val->getZExtValue());
+        }
+      }
+    }
+  }
+
+  return bounds;
+}
+
+bool annotateRegisterRanges(Function &fun, const SymbolIndex &symbols) {
+  LaunchBounds bounds = getLaunchBounds(fun);
+  MDBuilder MDB(fun.getContext());
+
+  bool result = false;
+  for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+    CallInst *call = dyn_cast<CallInst>(&*it);
+    if (!call || call->getMetadata(LLVMContext::MD_range)) continue;
+
+    const Function *callee = call->getCalledFunction();
+    if (!callee || !symbols.isCUDARegister(callee)) continue;
+    if (!call->getType()->isIntegerTy()) continue;
+
+    unsigned bits = call->getType()->getIntegerBitWidth();
+    unsigned dim = symbols.getGridDim(callee);
+
+    // Ranges are half-open: [lo, hi)
+    uint64_t lo = 0, hi;
+    if (symbols.is(callee, SymbolThreadIdx)) {
+      hi = bounds.maxBlockDim[dim];
+    } else if (symbols.is(callee, SymbolBlockSize)) {
+      lo = 1;
+      hi = uint64_t(bounds.maxBlockDim[dim]) + 1;
+    } else {
+      hi = bounds.maxGridDim[dim];
+    }
+
+    call->setMetadata(LLVMContext::MD_range,
+                      MDB.createRange(APInt(bits, lo), APInt(bits, hi)));
+    result = true;
+  }
+
+  return result;
+}
+
+}
+
+// vim: set ts=2 sw=2:
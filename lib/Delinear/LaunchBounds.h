@@ -0,0 +1,33 @@
+#ifndef LAUNCH_BOUNDS_H
+#define LAUNCH_BOUNDS_H
+
+namespace llvm {
+class Function;
+}
+
+namespace platonic {
+
+class SymbolIndex;
+
+// Limits of the thread blocks a function can run in. Kernels take them
+// from the maxntid/reqntid nvvm.annotations, other functions (and kernels
+// without annotations) get the hardware limits.
+struct LaunchBounds {
+  // Maximum block size in each grid dimension
+  unsigned maxBlockDim[3];
+  // Maximum grid size in each grid dimension
+  unsigned maxGridDim[3];
+
+  LaunchBounds();
+};
+
+LaunchBounds getLaunchBounds(const llvm::Function &fun);
+
+// Attaches !range metadata with the launch bounds to the thread id, block
+// id and block size reads of the function, so that ScalarEvolution and
+// ValueTracking know their ranges. Returns whether anything changed.
+bool annotateRegisterRanges(llvm::Function &fun, const SymbolIndex &symbols);
+
+}
+
+#endif // LAUNCH_BOUNDS_H
@@ -0,0 +1,45 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace platonic {
+
+// Calls fn(i) for every i in [0, n) using up to 'threads' threads (0: one
+// per core). Iterations are handed out dynamically, so fn must store its
+// result in the i-th slot of a preallocated container to keep the output
+// independent of the scheduling.
+template <typename Fn>
+void parallelFor(size_t n, unsigned threads, Fn fn) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  if (threads > n)
+    threads = unsigned(n);
+
+  if (threads <= 1) {
+    for (size_t i = 0; i < n; ++i)
+      fn(i);
+    return;
+  }
+
+  std::atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < n; i = next++)
+      fn(i);
+  };
+
+  std::vector<std::thread> pool;
+  for (unsigned t = 1; t < threads; ++t)
+    pool.emplace_back(worker);
+  worker();
+
+  for (std::thread &thread : pool)
+    thread.join();
+}
+
+}
+
+#endif // PARALLEL_FOR_H
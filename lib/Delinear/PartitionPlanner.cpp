@@ -0,0 +1,198 @@
+#include "PartitionPlanner.h"
+
+#include <algorithm>
+#include <string>
+
+#include "llvm/Support/raw_ostream.h"
+
+#include "KernelSummary.h"
+#include "SymExpr.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+unsigned ArrayDecomposition::getMask() const {
+  unsigned mask = 0;
+  for (unsigned dim : dims)
+    mask |= 1u << dim;
+  return mask;
+}
+
+// Splits index into an expression and a constant offset added to it
+static void splitOffset(const SymExpr &index, std::string &base,
+                        int64_t &offset) {
+  SymExpr rest;
+  offset = 0;
+  if (index.kind == SymExpr::SymConst) {
+    offset = index.value;
+  } else if (index.kind == SymExpr::SymAdd) {
+    rest.kind = SymExpr::SymAdd;
+    for (const SymExpr &op : index.ops) {
+      if (op.kind == SymExpr::SymConst)
+        offset += op.value;
+      else
+        rest.ops.push_back(op);
+    }
+    if (rest.ops.size() == 1) {
+      SymExpr op = rest.ops[0];
+      rest = op;
+    }
+  } else {
+    rest = index;
+  }
+
+  raw_string_ostream out(base);
+  rest.print(out);
+  out.flush();
+}
+
+static bool hasRecurrence(const SymExpr &expr) {
+  if (expr.kind == SymExpr::SymAddRec) return true;
+  for (const SymExpr &op : expr.ops)
+    if (hasRecurrence(op)) return true;
+  return false;
+}
+
+static bool getHalo(const std::vector<SymExpr> &indices, DimHalo &halo) {
+  if (indices.empty()) return false;
+
+  std::string first;
+  int64_t lo = 0, hi = 0;
+  for (unsigned i = 0; i < indices.size(); ++i) {
+    std::string base;
+    int64_t offset;
+    // The neighbourhood reached by a loop is not a constant offset
+    if (hasRecurrence(indices[i])) return false;
+    splitOffset(indices[i], base, offset);
+    if (i == 0) {
+      first = base;
+      lo = hi = offset;
+    } else if (base != first) {
+      return false;
+    }
+    lo = std::min(lo, offset);
+    hi = std::max(hi, offset);
+  }
+
+  // The element owned by a thread is the one with no offset
+  halo.lo = std::max<int64_t>(0, -lo);
+  halo.hi = std::max<int64_t>(0, hi);
+  return true;
+}
+
+bool getArrayDecomposition(const ArraySummary &array,
+                           ArrayDecomposition &decomp) {
+  if (array.status != ArrayPartitioned) return false;
+  if (array.dimIndices.size() != array.dims) return false;
+
+  unsigned used = 0, shared = 0;
+  for (unsigned dim = 0; dim < array.dims; ++dim) {
+    shared |= used & array.dimMasks[dim];
+    used |= array.dimMasks[dim];
+  }
+
+  for (unsigned dim = 0; dim < array.dims; ++dim) {
+    unsigned mask = array.dimMasks[dim];
+    // Exactly one grid dimension, not used by other array dimensions
+    if (mask == 0 || (mask & (mask - 1)) || (mask & shared)) continue;
+
+    DimHalo halo;
+    if (!getHalo(array.dimIndices[dim], halo)) continue;
+
+    unsigned gridDim = 0;
+    while (!(mask & (1u << gridDim))) ++gridDim;
+
+    decomp.dims.push_back(dim);
+    decomp.gridDims.push_back(gridDim);
+    decomp.halos.push_back(halo);
+  }
+
+  return !decomp.dims.empty();
+}
+
+static uint64_t getVolume(const ArrayDecomposition &decomp,
+                          const std::vector<uint64_t> &extents,
+                          const std::vector<unsigned> &devices) {
+  uint64_t volume = 0;
+  for (unsigned i = 0; i < decomp.dims.size(); ++i) {
+    if (devices[i] < 2) continue;
+
+    // Every boundary between two devices along the dimension is crossed
+    // by the halos of both, over the whole cross-section of the array
+    uint64_t section = 1;
+    for (unsigned dim = 0; dim < extents.size(); ++dim)
+      if (dim != decomp.dims[i]) section *= extents[dim];
+
+    const DimHalo &halo = decomp.halos[i];
+    volume += (devices[i] - 1) * uint64_t(halo.lo + halo.hi) * section;
+  }
+  return volume;
+}
+
+static void enumerate(const ArrayDecomposition &decomp,
+                      const std::vector<uint64_t> &extents,
+                      unsigned devices, std::vector<unsigned> &shape,
+                      std::vector<PartitionPlan> &plans) {
+  unsigned i = shape.size();
+  uint64_t extent = extents[decomp.dims[i]];
+
+  if (i + 1 == decomp.dims.size()) {
+    if (devices > extent) return;
+    shape.push_back(devices);
+    PartitionPlan plan = { shape, getVolume(decomp, extents, shape) };
+    plans.push_back(plan);
+    shape.pop_back();
+    return;
+  }
+
+  for (unsigned factor = 1; factor <= devices && factor <= extent; ++factor) {
+    if (devices % factor) continue;
+    shape.push_back(factor);
+    enumerate(decomp, extents, devices / factor, shape, plans);
+    shape.pop_back();
+  }
+}
+
+std::vector<PartitionPlan> planPartitions(const ArrayDecomposition &decomp,
+                                          const std::vector<uint64_t> &extents,
+                                          unsigned devices) {
+  std::vector<PartitionPlan> plans;
+  if (decomp.dims.empty() || devices == 0) return plans;
+
+  std::vector<unsigned> shape;
+  enumerate(decomp, extents, devices, shape, plans);
+
+  std::stable_sort(plans.begin(), plans.end(),
+                   [](const PartitionPlan &a, const PartitionPlan &b) {
+                     return a.volume < b.volume;
+                   });
+  return plans;
+}
+
+void printPartitionPlans(raw_ostream &out, const KernelSummary &summary,
+                         unsigned devices, uint64_t extent) {
+  for (const ArraySummary &array : summary.arrays) {
+    ArrayDecomposition decomp;
+    if (!getArrayDecomposition(array, decomp)) continue;
+
+    out << "  array " << array.name << ": " << decomp.dims.size()
+        << "D decomposition\n";
+    for (unsigned i = 0; i < decomp.dims.size(); ++i)
+      out << "    dim " << decomp.dims[i] << " (grid " << decomp.gridDims[i]
+          << "): halo -" << decomp.halos[i].lo << "/+"
+          << decomp.halos[i].hi << "\n";
+
+    std::vector<uint64_t> extents(array.dims, extent);
+    for (const PartitionPlan &plan : planPartitions(decomp, extents, devices)) {
+      out << "    ";
+      for (unsigned i = 0; i < plan.devices.size(); ++i)
+        out << (i ? "x" : "") << plan.devices[i];
+      out << " devices: " << plan.volume << " halo elements\n";
+    }
+  }
+}
+
+}
+
+// vim: set ts=2 sw=2:
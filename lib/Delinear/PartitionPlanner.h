@@ -0,0 +1,67 @@
+#ifndef PARTITION_PLANNER_H
+#define PARTITION_PLANNER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace llvm {
+class raw_ostream;
+}
+
+namespace platonic {
+
+struct ArraySummary;
+struct KernelSummary;
+
+// Elements a thread accesses below (lo) and above (hi) the one it owns in
+// an array dimension, i.e. the halo a device needs from its neighbours
+struct DimHalo {
+  int64_t lo;
+  int64_t hi;
+
+  DimHalo() : lo(0), hi(0) {}
+};
+
+// Array dimensions that can be split across a grid of devices. A dimension
+// can be split when it is indexed by a single grid dimension, that no other
+// array dimension uses, and all its indices are the same expression plus
+// constant offsets. Splitting more than one dimension (2D/3D decomposition)
+// is legal when several are.
+struct ArrayDecomposition {
+  // Array dimensions, in increasing order
+  std::vector<unsigned> dims;
+  // Grid dimension used to access each of them
+  std::vector<unsigned> gridDims;
+  std::vector<DimHalo> halos;
+
+  // Mask of the array dimensions that can be split
+  unsigned getMask() const;
+};
+
+// Returns false if no dimension of the array can be split
+bool getArrayDecomposition(const ArraySummary &array,
+                           ArrayDecomposition &decomp);
+
+// Shape of a grid of devices and the halo elements it exchanges
+struct PartitionPlan {
+  // Devices along each dimension of the decomposition
+  std::vector<unsigned> devices;
+  // Halo elements copied from neighbours per run of the kernel, in total
+  uint64_t volume;
+};
+
+// Enumerates the ways of laying out the devices over the dimensions of the
+// decomposition, sorted by communication volume. extents holds the extent
+// of every array dimension. Corner elements of the halos are not counted.
+std::vector<PartitionPlan> planPartitions(const ArrayDecomposition &decomp,
+                                          const std::vector<uint64_t> &extents,
+                                          unsigned devices);
+
+// Prints the plans of the arrays of the kernel, assuming every dimension
+// has the given extent
+void printPartitionPlans(llvm::raw_ostream &out, const KernelSummary &summary,
+                         unsigned devices, uint64_t extent);
+
+}
+
+#endif // PARTITION_PLANNER_H
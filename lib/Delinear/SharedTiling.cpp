@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <set>
+
+#include "llvm/Pass.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Analysis/PostDominators.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpander.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DataLayout.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Intrinsics.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "CUDArraysSymbols.h"
+#include "LaunchBounds.h"
+
+using namespace llvm;
+
+#undef DEBUG_TYPE
+#define DEBUG_TYPE "cudarrays-shared-tiling"
+
+STATISTIC(NumTiles,      "Number of array windows staged in shared memory");
+STATISTIC(NumTiledLoads, "Number of loads redirected to shared memory");
+
+static cl::opt<unsigned>
+MaxTileBytes("cudarrays-tile-bytes",
+             cl::desc("Maximum shared memory used for the tiles of a kernel"),
+             cl::init(16384));
+
+namespace platonic {
+
+// Stages in shared memory the window of an array that the threads of a
+// block read at constant offsets along x, e.g. the neighbourhood of
+//
+//   out(x) = in(x - 1) + in(x) + in(x + 1)
+//
+// with x = blockIdx.x * blockDim.x + threadIdx.x. The block loads the
+// window [x0 - 1, x0 + blockDim.x + 1) cooperatively at the kernel entry,
+// waits in a barrier and the reads of the kernel are redirected to it.
+//
+// Only loads that run in every thread of every launch (i.e. they
+// post-dominate the entry, as in the -cudarrays-interior clones) are
+// staged, so the window never reads an element the kernel does not. The
+// array must not be written by the kernel, which alias analysis can prove
+// in the -cudarrays-noalias clones. Windows that move with a loop (the
+// rows and columns of matrixmul) are not handled.
+//
+// The accessors must have been lowered (-cudarrays-lower-accessors).
+class SharedTiling : public ModulePass {
+  // Loads of an array at a constant element offset from a common base
+  struct Window {
+    const SCEV *base;
+    Type *type;
+    std::vector<std::pair<LoadInst *, int64_t> > loads;
+    int64_t first, last;
+  };
+
+ public:
+  static char ID;
+  SharedTiling() : ModulePass(ID) {}
+
+  bool runOnModule(Module &M) {
+    bool result = false;
+    SymbolIndex symbols(M);
+    DL_ = &getAnalysis<DataLayoutPass>().getDataLayout();
+    AA_ = &getAnalysis<AliasAnalysis>();
+
+    for (Function &fun : M) {
+      if (!symbols.is(&fun, SymbolKernel) || fun.isDeclaration()) continue;
+      result |= runOnKernel(fun, symbols);
+    }
+
+    return result;
+  }
+
+  void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired<DataLayoutPass>();
+    AU.addRequired<AliasAnalysis>();
+    AU.addRequired<PostDominatorTree>();
+    AU.addRequired<ScalarEvolution>();
+  }
+
+ private:
+  const DataLayout *DL_;
+  AliasAnalysis *AA_;
+
+  struct FindUnknowns {
+    SmallVector<const SCEVUnknown *, 8> unknowns;
+    bool recurrence;
+    FindUnknowns() : recurrence(false) {}
+    bool follow(const SCEV *scev) {
+      if (const SCEVUnknown *unknown = dyn_cast<SCEVUnknown>(scev))
+        unknowns.push_back(unknown);
+      recurrence = recurrence || isa<SCEVAddRecExpr>(scev);
+      return true;
+    }
+    bool isDone() const { return recurrence; }
+  };
+
+  // Values that are the same in every thread of a block: launch
+  // parameters, block registers and the dynarray metadata read by
+  // -cudarrays-lower-accessors
+  static bool isUniform(const Value *val, const SymbolIndex &symbols) {
+    if (isa<Argument>(val) || isa<Constant>(val)) return true;
+
+    const Instruction *inst = dyn_cast<Instruction>(val);
+    if (!inst || isa<PHINode>(inst) || isa<AllocaInst>(inst)) return false;
+
+    if (const CallInst *call = dyn_cast<CallInst>(inst)) {
+      const Function *callee = call->getCalledFunction();
+      return callee && symbols.isCUDARegister(callee) &&
+             !symbols.is(callee, SymbolThreadIdx);
+    }
+    if (const LoadInst *load = dyn_cast<LoadInst>(inst)) {
+      if (load->getMetadata(LLVMContext::MD_invariant_load)) return true;
+      // The block offsets live in constant memory
+      return load->getPointerAddressSpace() == 4 &&
+             isUniform(load->getPointerOperand(), symbols);
+    }
+    if (inst->mayReadOrWriteMemory()) return false;
+
+    for (const Value *op : inst->operands())
+      if (!isUniform(op, symbols)) return false;
+    return true;
+  }
+
+  // Whether scev is threadIdx.x (possibly extended)
+  static bool isThreadIdxX(const SCEV *scev, const SymbolIndex &symbols) {
+    if (const SCEVCastExpr *cast = dyn_cast<SCEVCastExpr>(scev))
+      scev = cast->getOperand();
+    const SCEVUnknown *unknown = dyn_cast<SCEVUnknown>(scev);
+    if (!unknown) return false;
+
+    const CallInst *call = dyn_cast<CallInst>(unknown->getValue());
+    const Function *callee = call ? call->getCalledFunction() : NULL;
+    return callee && symbols.is(callee, SymbolThreadIdx) &&
+           symbols.getGridDim(callee) == 0;
+  }
+
+  // Splits the address of a load into base + threadIdx.x * size, where
+  // base is uniform in the block and can be computed at the entry
+  bool splitAddress(const SCEV *ptr, uint64_t size, Function &fun,
+                    ScalarEvolution &SE, const SymbolIndex &symbols,
+                    const SCEV *&base) const {
+    const SCEVAddExpr *add = dyn_cast<SCEVAddExpr>(ptr);
+    if (!add) return false;
+
+    SmallVector<const SCEV *, 4> rest;
+    unsigned threadTerms = 0;
+    for (const SCEV *op : add->operands()) {
+      const SCEVMulExpr *mul = dyn_cast<SCEVMulExpr>(op);
+      const SCEVConstant *scale = mul && mul->getNumOperands() == 2 ?
+        dyn_cast<SCEVConstant>(mul->getOperand(0)) : NULL;
+      if (scale && scale->getValue()->equalsInt(size) &&
+          isThreadIdxX(mul->getOperand(1), symbols)) {
+        ++threadTerms;
+        continue;
+      }
+      if (size == 1 && isThreadIdxX(op, symbols)) {
+        ++threadTerms;
+        continue;
+      }
+      rest.push_back(op);
+    }
+    if (threadTerms != 1) return false;
+    base = SE.getAddExpr(rest);
+
+    // The base must be computable in the entry block
+    FindUnknowns finder;
+    visitAll(base, finder);
+    if (finder.recurrence) return false;
+
+    for (const SCEVUnknown *unknown : finder.unknowns) {
+      const Instruction *inst = dyn_cast<Instruction>(unknown->getValue());
+      if (inst && inst->getParent() != &fun.getEntryBlock()) return false;
+      if (!isUniform(unknown->getValue(), symbols)) return false;
+    }
+    return true;
+  }
+
+  // Whether an instruction of the kernel may write the elements of window
+  bool isWritten(Function &fun, const Window &window) const {
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      if (!it->mayWriteToMemory()) continue;
+
+      for (auto &access : window.loads) {
+        LoadInst *load = access.first;
+        AAMDNodes AAInfo;
+        load->getAAMetadata(AAInfo);
+        AliasAnalysis::Location loc(load->getPointerOperand(),
+                                    AliasAnalysis::UnknownSize, AAInfo);
+        if (AA_->getModRefInfo(&*it, loc) & AliasAnalysis::Mod) return true;
+      }
+    }
+    return false;
+  }
+
+  void collectWindows(Function &fun, const SymbolIndex &symbols,
+                      std::vector<Window> &windows) {
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    PostDominatorTree &PDT = getAnalysis<PostDominatorTree>(fun);
+    BasicBlock *entry = &fun.getEntryBlock();
+
+    for (inst_iterator it = inst_begin(fun), E = inst_end(fun); it != E; ++it) {
+      LoadInst *load = dyn_cast<LoadInst>(&*it);
+      if (!load || !load->isSimple()) continue;
+      if (load->getPointerAddressSpace() != 0 &&
+          load->getPointerAddressSpace() != 1) continue;
+
+      Type *type = load->getType();
+      if (!type->isIntegerTy() && !type->isFloatingPointTy()) continue;
+      if (!PDT.dominates(load->getParent(), entry)) continue;
+
+      uint64_t size = DL_->getTypeAllocSize(type);
+      const SCEV *base;
+      if (!splitAddress(SE.getSCEV(load->getPointerOperand()), size, fun,
+                        SE, symbols, base))
+        continue;
+
+      // Join the window whose base is a whole number of elements away
+      bool joined = false;
+      for (Window &window : windows) {
+        if (window.type != type ||
+            window.base->getType() != base->getType()) continue;
+        const SCEVConstant *diff =
+          dyn_cast<SCEVConstant>(SE.getMinusSCEV(base, window.base));
+        if (!diff) continue;
+
+        int64_t bytes = diff->getValue()->getSExtValue();
+        if (bytes % int64_t(size) != 0) continue;
+        window.loads.push_back(std::make_pair(load, bytes / int64_t(size)));
+        joined = true;
+        break;
+      }
+      if (joined) continue;
+
+      Window window;
+      window.base = base;
+      window.type = type;
+      window.loads.push_back(std::make_pair(load, int64_t(0)));
+      windows.push_back(window);
+    }
+  }
+
+  // A window is worth staging when its elements are read by several
+  // threads, i.e. at more than one offset. The offsets must be contiguous
+  // so that every element of the window is read by some thread.
+  static bool isReused(Window &window) {
+    std::set<int64_t> offsets;
+    for (auto &access : window.loads)
+      offsets.insert(access.second);
+    if (offsets.size() < 2) return false;
+
+    window.first = *offsets.begin();
+    window.last = *offsets.rbegin();
+    return window.last - window.first + 1 == int64_t(offsets.size());
+  }
+
+  static Value *readRegister(IRBuilder<> &B, Intrinsic::ID id) {
+    Module *M = B.GetInsertBlock()->getParent()->getParent();
+    return B.CreateCall(Intrinsic::getDeclaration(M, id));
+  }
+
+  // Loads the window into tile with all the threads of the block:
+  //
+  //   for (i = t; i < n; i += blockDim.x * blockDim.y * blockDim.z)
+  //     tile[i] = base[first + i];
+  //
+  // between tail and a new block, which is returned
+  BasicBlock *emitStaging(BasicBlock *tail, const Window &window,
+                          GlobalVariable *tile, ScalarEvolution &SE,
+                          Value *tid, Value *ntidx, Value *stride) {
+    Function *fun = tail->getParent();
+    LLVMContext &ctx = fun->getContext();
+    uint64_t size = DL_->getTypeAllocSize(window.type);
+
+    BasicBlock *cont = tail->splitBasicBlock(tail->getTerminator(), "tile.done");
+    BasicBlock *body = BasicBlock::Create(ctx, "tile.load", fun, cont);
+
+    const SCEV *first = SE.getAddExpr(window.base,
+      SE.getConstant(window.base->getType(), window.first * int64_t(size)));
+    SCEVExpander expander(SE, "tile");
+    Type *ptrTy = window.loads.front().first->getPointerOperand()->getType();
+    Value *base = expander.expandCodeFor(first, ptrTy, tail->getTerminator());
+
+    IRBuilder<> B(tail->getTerminator());
+    Value *n = B.CreateAdd(ntidx, B.getInt32(window.last - window.first),
+                           "tile.size");
+    tail->getTerminator()->eraseFromParent();
+    B.SetInsertPoint(tail);
+    B.CreateCondBr(B.CreateICmpULT(tid, n), body, cont);
+
+    B.SetInsertPoint(body);
+    PHINode *i = B.CreatePHI(B.getInt32Ty(), 2, "tile.i");
+    i->addIncoming(tid, tail);
+    LoadInst *load = B.CreateLoad(B.CreateInBoundsGEP(base, i));
+    load->setAlignment(window.loads.front().first->getAlignment());
+    Value *idx[] = { B.getInt32(0), i };
+    B.CreateStore(load, B.CreateInBoundsGEP(tile, idx));
+    Value *next = B.CreateAdd(i, stride, "tile.next");
+    i->addIncoming(next, body);
+    B.CreateCondBr(B.CreateICmpULT(next, n), body, cont);
+
+    return cont;
+  }
+
+  bool runOnKernel(Function &fun, const SymbolIndex &symbols) {
+    std::vector<Window> windows;
+    collectWindows(fun, symbols, windows);
+
+    LaunchBounds bounds = getLaunchBounds(fun);
+    uint64_t budget = MaxTileBytes;
+    std::vector<Window> staged;
+    for (Window &window : windows) {
+      if (!isReused(window) || isWritten(fun, window)) continue;
+
+      uint64_t bytes = (bounds.maxBlockDim[0] + window.last - window.first) *
+                       DL_->getTypeAllocSize(window.type);
+      if (bytes > budget) continue;
+      budget -= bytes;
+      staged.push_back(window);
+    }
+    if (staged.empty()) return false;
+
+    // The tiles are loaded before the first staged load of the entry block
+    // and after the values their bases depend on
+    BasicBlock *entry = &fun.getEntryBlock();
+    DenseMap<const Instruction *, unsigned> order;
+    for (Instruction &inst : *entry)
+      order[&inst] = order.size();
+
+    Instruction *splitPt = entry->getTerminator();
+    for (const Window &window : staged) {
+      for (auto &access : window.loads) {
+        if (access.first->getParent() == entry &&
+            order[access.first] < order[splitPt])
+          splitPt = access.first;
+      }
+    }
+
+    std::vector<Window> available;
+    for (const Window &window : staged) {
+      FindUnknowns finder;
+      visitAll(window.base, finder);
+      bool ready = true;
+      for (const SCEVUnknown *unknown : finder.unknowns) {
+        const Instruction *inst = dyn_cast<Instruction>(unknown->getValue());
+        ready = ready && (!inst || order[inst] < order[splitPt]);
+      }
+      if (ready) available.push_back(window);
+    }
+    if (available.empty()) return false;
+
+    Module &M = *fun.getParent();
+    ScalarEvolution &SE = getAnalysis<ScalarEvolution>(fun);
+    BasicBlock *tail = entry;
+    if (splitPt != entry->getTerminator())
+      entry->splitBasicBlock(splitPt, "tile.entry");
+
+    // Thread index in the block and number of threads
+    IRBuilder<> B(tail->getTerminator());
+    Value *tidx = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_tid_x);
+    Value *tidy = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_tid_y);
+    Value *tidz = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_tid_z);
+    Value *ntidx = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_ntid_x);
+    Value *ntidy = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_ntid_y);
+    Value *ntidz = readRegister(B, Intrinsic::nvvm_read_ptx_sreg_ntid_z);
+    Value *tid = B.CreateAdd(tidx, B.CreateMul(ntidx,
+                   B.CreateAdd(tidy, B.CreateMul(ntidy, tidz))), "tile.tid");
+    Value *stride = B.CreateMul(ntidx, B.CreateMul(ntidy, ntidz),
+                                "tile.stride");
+
+    for (const Window &window : available) {
+      uint64_t elems = bounds.maxBlockDim[0] + window.last - window.first;
+      ArrayType *tileTy = ArrayType::get(window.type, elems);
+      GlobalVariable *tile =
+        new GlobalVariable(M, tileTy, false, GlobalValue::InternalLinkage,
+                           UndefValue::get(tileTy), fun.getName() + ".tile",
+                           NULL, GlobalVariable::NotThreadLocal, 3);
+      tile->setAlignment(DL_->getABITypeAlignment(window.type));
+
+      tail = emitStaging(tail, window, tile, SE, tid, ntidx, stride);
+
+      // Thread x reads element x + offset - first of the tile
+      for (auto &access : window.loads) {
+        LoadInst *load = access.first;
+        IRBuilder<> LB(load);
+        Value *idx[] = {
+          LB.getInt32(0),
+          LB.CreateAdd(tidx, LB.getInt32(access.second - window.first))
+        };
+        LoadInst *shared = LB.CreateLoad(LB.CreateInBoundsGEP(tile, idx),
+                                         load->getName());
+        shared->setAlignment(tile->getAlignment());
+        load->replaceAllUsesWith(shared);
+        load->eraseFromParent();
+        ++NumTiledLoads;
+      }
+
+      DEBUG(errs() << "Tile " << tile->getName() << " of " << elems
+                   << " elements for " << *window.base << "\n");
+      ++NumTiles;
+    }
+
+    // The tiles are complete when every thread has done its part
+    B.SetInsertPoint(tail->getTerminator());
+    B.CreateCall(Intrinsic::getDeclaration(&M, Intrinsic::cuda_syncthreads));
+    return true;
+  }
+};
+
+char SharedTiling::ID;
+
+static RegisterPass<SharedTiling>
+X("cudarrays-shared-tiling",
+  "Stage the array windows read by a thread block in shared memory",
+  false, false);
+
+}
+
+// vim: set ts=2 sw=2:
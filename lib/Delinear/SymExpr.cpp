@@ -0,0 +1,260 @@
+#include "SymExpr.h"
+
+#include "CUDArraysSymbols.h"
+
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+// Tokens used by print and parse, indexed by kind
+static const char *KindNames[] = {
+  "c", "p", "d", "tid", "bid", "bsz", "off",
+  "add", "mul", "smax", "umax", "udiv", "rec"
+};
+
+void SymExpr::print(raw_ostream &out) const {
+  switch (kind) {
+  case SymConst:
+    out << "c:" << value;
+    return;
+  case SymParam:
+  case SymDim:
+    out << KindNames[kind] << ":" << arg << ":" << index;
+    return;
+  case SymThreadIdx:
+  case SymBlockIdx:
+  case SymBlockSize:
+  case SymBlockOffset:
+    out << KindNames[kind] << ":" << index;
+    return;
+  default:
+    break;
+  }
+
+  out << "(" << KindNames[kind];
+  for (const SymExpr &op : ops) {
+    out << " ";
+    op.print(out);
+  }
+  out << ")";
+}
+
+static bool parseInt(StringRef &str, int64_t &value) {
+  size_t len = str.find_first_of(":) ");
+  if (str.substr(0, len).getAsInteger(10, value)) return false;
+  str = str.substr(len == StringRef::npos ? str.size() : len);
+  return true;
+}
+
+static bool parseUnsigned(StringRef &str, unsigned &value) {
+  int64_t val;
+  if (!parseInt(str, val) || val < 0) return false;
+  value = unsigned(val);
+  return true;
+}
+
+bool SymExpr::parse(StringRef &str, SymExpr &expr) {
+  str = str.ltrim();
+  expr = SymExpr();
+
+  bool nary = str.startswith("(");
+  if (nary) str = str.substr(1);
+
+  size_t len = str.find_first_of(":) ");
+  StringRef name = str.substr(0, len);
+  str = str.substr(name.size());
+
+  unsigned kind = 0;
+  while (kind <= SymAddRec && name != KindNames[kind]) ++kind;
+  if (kind > SymAddRec) return false;
+  expr.kind = Kind(kind);
+
+  if (nary != !expr.isLeaf()) return false;
+
+  if (expr.isLeaf()) {
+    if (!str.startswith(":")) return false;
+    str = str.substr(1);
+
+    switch (expr.kind) {
+    case SymConst:
+      return parseInt(str, expr.value);
+    case SymParam:
+    case SymDim:
+      if (!parseUnsigned(str, expr.arg)) return false;
+      if (!str.startswith(":")) return false;
+      str = str.substr(1);
+      return parseUnsigned(str, expr.index);
+    default:
+      return parseUnsigned(str, expr.index);
+    }
+  }
+
+  while (true) {
+    str = str.ltrim();
+    if (str.startswith(")")) {
+      str = str.substr(1);
+      break;
+    }
+    if (str.empty()) return false;
+
+    expr.ops.push_back(SymExpr());
+    if (!parse(str, expr.ops.back())) return false;
+  }
+
+  if (expr.kind == SymUDiv && expr.ops.size() != 2) return false;
+  if (expr.kind == SymAddRec && expr.ops.size() != 3) return false;
+  return !expr.ops.empty();
+}
+
+bool SymExprBuilder::lower(const SCEV *scev, SymExpr &expr) const {
+  if (const SCEVConstant *constant = dyn_cast<SCEVConstant>(scev)) {
+    expr = SymExpr::getConst(constant->getValue()->getSExtValue());
+    return true;
+  }
+
+  // Casts are ignored, as in the access strings
+  if (const SCEVCastExpr *cast = dyn_cast<SCEVCastExpr>(scev))
+    return lower(cast->getOperand(), expr);
+
+  if (const SCEVUnknown *unknown = dyn_cast<SCEVUnknown>(scev))
+    return lowerValue(unknown->getValue(), expr);
+
+  std::vector<const SCEV *> ops;
+  if (const SCEVUDivExpr *div = dyn_cast<SCEVUDivExpr>(scev)) {
+    expr = SymExpr(SymExpr::SymUDiv, 0, 0);
+    ops.push_back(div->getLHS());
+    ops.push_back(div->getRHS());
+  } else if (const SCEVAddRecExpr *addrec = dyn_cast<SCEVAddRecExpr>(scev)) {
+    if (!addrec->isAffine()) return false;
+
+    const Loop *loop = addrec->getLoop();
+    const SCEV *count = SE_.getBackedgeTakenCount(loop);
+    if (isa<SCEVCouldNotCompute>(count))
+      count = SE_.getMaxBackedgeTakenCount(loop);
+    if (isa<SCEVCouldNotCompute>(count)) return false;
+
+    expr = SymExpr(SymExpr::SymAddRec, 0, 0);
+    ops.push_back(addrec->getStart());
+    ops.push_back(addrec->getStepRecurrence(SE_));
+    ops.push_back(count);
+  } else if (const SCEVNAryExpr *nary = dyn_cast<SCEVNAryExpr>(scev)) {
+    if (isa<SCEVAddExpr>(nary))
+      expr = SymExpr(SymExpr::SymAdd, 0, 0);
+    else if (isa<SCEVMulExpr>(nary))
+      expr = SymExpr(SymExpr::SymMul, 0, 0);
+    else if (isa<SCEVSMaxExpr>(nary))
+      expr = SymExpr(SymExpr::SymSMax, 0, 0);
+    else if (isa<SCEVUMaxExpr>(nary))
+      expr = SymExpr(SymExpr::SymUMax, 0, 0);
+    else
+      return false;
+    ops.insert(ops.end(), nary->op_begin(), nary->op_end());
+  } else {
+    return false;
+  }
+
+  expr.ops.resize(ops.size());
+  for (unsigned i = 0; i < ops.size(); ++i)
+    if (!lower(ops[i], expr.ops[i])) return false;
+
+  return true;
+}
+
+bool SymExprBuilder::lowerValue(const Value *val, SymExpr &expr) const {
+  if (const Argument *arg = dyn_cast<Argument>(val)) {
+    if (!arg->getType()->isIntegerTy()) return false;
+    expr = SymExpr(SymExpr::SymParam, arg->getArgNo(),
+                   arg->getType()->getIntegerBitWidth());
+    return true;
+  }
+
+  if (const CallInst *call = dyn_cast<CallInst>(val)) {
+    const Function *fun = call->getCalledFunction();
+    if (!fun) return false;
+
+    if (symbols_.is(fun, SymbolThreadIdx)) {
+      expr = SymExpr(SymExpr::SymThreadIdx, 0, symbols_.getGridDim(fun));
+      return true;
+    }
+    if (symbols_.is(fun, SymbolBlockIdx)) {
+      expr = SymExpr(SymExpr::SymBlockIdx, 0, symbols_.getGridDim(fun));
+      return true;
+    }
+    if (symbols_.is(fun, SymbolBlockSize)) {
+      expr = SymExpr(SymExpr::SymBlockSize, 0, symbols_.getGridDim(fun));
+      return true;
+    }
+
+    if (symbols_.is(fun, SymbolDynarrayGetDim)) {
+      const AllocaInst *alloca = findAllocaSource(call->getArgOperand(0));
+      if (!alloca) return false;
+      AllocaToArgMap::const_iterator arg = argMap_.find(alloca);
+      if (arg == argMap_.end()) return false;
+
+      const ConstantInt *dim = dyn_cast<ConstantInt>(call->getArgOperand(1));
+      if (!dim) return false;
+
+      expr = SymExpr(SymExpr::SymDim, arg->second->getArgNo(),
+                     dim->getZExtValue());
+      return true;
+    }
+
+    return false;
+  }
+
+  // Block offset passed as a dim3 'off' argument
+  if (const ExtractValueInst *extract = dyn_cast<ExtractValueInst>(val)) {
+    const Argument *arg = dyn_cast<Argument>(extract->getAggregateOperand());
+    if (!arg || !arg->getName().endswith("off")) return false;
+    if (extract->getNumIndices() != 1) return false;
+
+    expr = SymExpr(SymExpr::SymBlockOffset, 0, extract->getIndices()[0]);
+    return true;
+  }
+
+  const LoadInst *load = dyn_cast<LoadInst>(val);
+  if (!load) return false;
+
+  const Value *ptr = load->getPointerOperand();
+
+  // Scalar argument copied to an alloca that is never written again
+  if (const AllocaInst *alloca = findAllocaSource(ptr)) {
+    AllocaToArgMap::const_iterator arg = argMap_.find(alloca);
+    if (arg == argMap_.end()) return false;
+
+    for (const User *user : alloca->users()) {
+      const StoreInst *store = dyn_cast<StoreInst>(user);
+      if (store && store->getValueOperand() != arg->second) return false;
+    }
+
+    return lowerValue(arg->second, expr);
+  }
+
+  // Block offset stored in the 'offset' global
+  unsigned dim = 0;
+  if (const ConstantExpr *gep = dyn_cast<ConstantExpr>(ptr)) {
+    if (gep->getOpcode() != Instruction::GetElementPtr ||
+        gep->getNumOperands() != 3) return false;
+    const ConstantInt *field = dyn_cast<ConstantInt>(gep->getOperand(2));
+    if (!field) return false;
+    dim = field->getZExtValue();
+    ptr = gep->getOperand(0);
+  }
+
+  const GlobalValue *global = dyn_cast<GlobalValue>(ptr);
+  if (!global || !global->getName().startswith("offset") || dim > 2)
+    return false;
+
+  expr = SymExpr(SymExpr::SymBlockOffset, 0, dim);
+  return true;
+}
+
+}
+
+// vim: set ts=2 sw=2:
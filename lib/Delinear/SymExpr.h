@@ -0,0 +1,105 @@
+#ifndef SYM_EXPR_H
+#define SYM_EXPR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+
+namespace llvm {
+class AllocaInst;
+class Argument;
+class SCEV;
+class ScalarEvolution;
+class Value;
+class raw_ostream;
+}
+
+namespace platonic {
+
+class SymbolIndex;
+
+// Symbolic index expression lowered from a SCEV. It does not refer to the
+// IR, so it can be cached and used by the drivers to emit the evaluators
+// of the array footprints into their own modules.
+struct SymExpr {
+  enum Kind {
+    // 'value'
+    SymConst,
+    // Integer kernel argument 'arg' of 'index' bits
+    SymParam,
+    // Extent 'index' (get_dim order) of the dynarray argument 'arg'
+    SymDim,
+    // CUDA registers in grid dimension 'index'
+    SymThreadIdx,
+    SymBlockIdx,
+    SymBlockSize,
+    // Block offset of the launch in grid dimension 'index'
+    SymBlockOffset,
+    // Operators over 'ops'
+    SymAdd,
+    SymMul,
+    SymSMax,
+    SymUMax,
+    SymUDiv,
+    // Loop recurrence. ops: start, step and backedge-taken count
+    SymAddRec
+  };
+
+  Kind kind;
+  int64_t value;
+  unsigned arg;
+  unsigned index;
+  std::vector<SymExpr> ops;
+
+  SymExpr() : kind(SymConst), value(0), arg(0), index(0) {}
+  SymExpr(Kind kind, unsigned arg, unsigned index) :
+    kind(kind), value(0), arg(arg), index(index) {}
+
+  static SymExpr getConst(int64_t value) {
+    SymExpr expr;
+    expr.value = value;
+    return expr;
+  }
+
+  bool isLeaf() const { return kind < SymAdd; }
+
+  void print(llvm::raw_ostream &out) const;
+  // Parses the output of print and consumes it from str
+  static bool parse(llvm::StringRef &str, SymExpr &expr);
+};
+
+// Layout of the launch vector (int32) passed to the evaluators. Blocks
+// range over [begin, end) in each grid dimension.
+enum LaunchField {
+  LaunchBlockDim    = 0,
+  LaunchBlockBegin  = 3,
+  LaunchBlockEnd    = 6,
+  LaunchBlockOffset = 9,
+  LaunchSize        = 12
+};
+
+using AllocaToArgMap = llvm::DenseMap<const llvm::AllocaInst *, llvm::Argument *>;
+
+// Lowers the SCEVs of the array indices. Fails when the index depends on
+// values that are not known at launch time (e.g. memory contents).
+class SymExprBuilder {
+ public:
+  SymExprBuilder(llvm::ScalarEvolution &SE, const SymbolIndex &symbols,
+                 const AllocaToArgMap &argMap) :
+    SE_(SE), symbols_(symbols), argMap_(argMap) {}
+
+  bool lower(const llvm::SCEV *scev, SymExpr &expr) const;
+
+ private:
+  llvm::ScalarEvolution &SE_;
+  const SymbolIndex &symbols_;
+  const AllocaToArgMap &argMap_;
+
+  bool lowerValue(const llvm::Value *val, SymExpr &expr) const;
+};
+
+}
+
+#endif // SYM_EXPR_H
@@ -0,0 +1,73 @@
+#include "TemporalBlocking.h"
+
+#include "KernelClones.h"
+#include "KernelSummary.h"
+
+namespace platonic {
+
+static bool hasHalo(const ArrayDecomposition &decomp) {
+  for (const DimHalo &halo : decomp.halos)
+    if (halo.lo || halo.hi) return true;
+  return false;
+}
+
+static bool isSplitAlike(const ArrayDecomposition &a,
+                         const ArrayDecomposition &b) {
+  return a.dims == b.dims && a.gridDims == b.gridDims;
+}
+
+// Whether every dimension indexed by the block index is indexed at
+// constant offsets, so that the reach of T steps is T times that of one
+static bool isSplitAtOffsets(const ArraySummary &array,
+                             const ArrayDecomposition &decomp) {
+  unsigned blockDims = 0;
+  for (unsigned mask : array.dimMasks)
+    if (mask) ++blockDims;
+  return decomp.dims.size() == blockDims;
+}
+
+bool getTemporalStencil(const KernelSummary &summary,
+                        TemporalStencil &stencil) {
+  const ArraySummary *in = NULL, *out = NULL;
+  ArrayDecomposition inDecomp, outDecomp;
+
+  for (const ArraySummary &array : summary.arrays) {
+    // Any array the analysis missed may carry state across time steps
+    if (array.status == ArrayFailed || array.status == ArrayUnanalysed)
+      return false;
+
+    ArrayDecomposition decomp;
+    bool split = getArrayDecomposition(array, decomp);
+    if (array.status == ArrayPartitioned &&
+        (!split || !isSplitAtOffsets(array, decomp)))
+      return false;
+
+    if (array.isWritten) {
+      // In place updates read the values of the same time step
+      if (out || array.isRead) return false;
+      if (!split || hasHalo(decomp)) return false;
+      out = &array;
+      outDecomp = decomp;
+    } else if (split && hasHalo(decomp)) {
+      if (in) return false;
+      in = &array;
+      inDecomp = decomp;
+    }
+  }
+
+  if (!in || !out || !isSplitAlike(inDecomp, outDecomp)) return false;
+
+  // Otherwise moving the offset does not move the computed region
+  unsigned offsetDims = getOffsetDims(*summary.fun);
+  for (unsigned gridDim : inDecomp.gridDims)
+    if (!(offsetDims & (1u << gridDim))) return false;
+
+  stencil.inArg = in->argNo;
+  stencil.outArg = out->argNo;
+  stencil.decomp = inDecomp;
+  return true;
+}
+
+}
+
+// vim: set ts=2 sw=2:
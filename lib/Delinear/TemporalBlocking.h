@@ -0,0 +1,50 @@
+#ifndef TEMPORAL_BLOCKING_H
+#define TEMPORAL_BLOCKING_H
+
+#include "PartitionPlanner.h"
+
+namespace platonic {
+
+struct KernelSummary;
+
+// A Jacobi-like stencil: every launch reads a time step from one array and
+// writes the next one to another, which the host swaps between launches.
+//
+// With a halo of T times the reach of one step, a device can run T launches
+// per halo exchange: launch t computes its partition widened by the reach
+// of the T - t - 1 steps still to come, recomputing the edge elements of its
+// neighbours instead of exchanging them.
+//
+// The kernel is not rewritten for the widened launches. Its partition is
+// the range of blocks selected by the block offset, so the runtime launches
+// the unmodified kernel over the wider range. Along every split grid
+// dimension, with halo (lo, hi) of one step and B threads per block,
+// launch t lowers the offset by ceil((T - t - 1) * lo / B) blocks and grows
+// the grid by that plus ceil((T - t - 1) * hi / B) blocks. Blocks are whole,
+// so both arrays need halo storage for ceil((T - 1) * lo / B) * B + lo
+// elements below the partition, and likewise above it. This is T * lo
+// when B divides (T - 1) * lo. Launch t writes the widened part of the
+// out array into that storage, and launch t + 1 reads it from there.
+//
+// B is only known at launch, so the arrays are registered with the halo
+// of one step and the kernel with T, and the runtime sizes the storage.
+struct TemporalStencil {
+  // Arguments holding the current and the next time step
+  unsigned inArg;
+  unsigned outArg;
+  // Decomposition of both arrays, with the halo of one time step
+  ArrayDecomposition decomp;
+};
+
+// The kernel must write a single array, only at the element each thread
+// owns, and read it from a single other array, split along the same
+// dimensions and at constant offsets. Other arrays may only be read at
+// the owned element, as they are the same in every time step. The kernel
+// must read the block offset of every split grid dimension, which is how
+// the runtime widens the launches.
+bool getTemporalStencil(const KernelSummary &summary,
+                        TemporalStencil &stencil);
+
+}
+
+#endif // TEMPORAL_BLOCKING_H
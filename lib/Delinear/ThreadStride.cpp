@@ -0,0 +1,128 @@
+#include "ThreadStride.h"
+
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Operator.h"
+
+#include "CUDArraysSymbols.h"
+
+using namespace llvm;
+
+namespace platonic {
+
+static bool isThreadIdx(const SCEV *scev, unsigned dim,
+                        const SymbolIndex &symbols) {
+  const SCEVUnknown *unknown = dyn_cast<SCEVUnknown>(scev);
+  const CallInst *call = unknown ? dyn_cast<CallInst>(unknown->getValue())
+                                 : NULL;
+  const Function *callee = call ? call->getCalledFunction() : NULL;
+  return callee && symbols.is(callee, SymbolThreadIdx) &&
+         symbols.getGridDim(callee) == dim;
+}
+
+// Whether the opaque value val is the same in all the threads of a block,
+// thread id reads aside: arguments, constants, CUDA registers, reads of
+// constant memory at a fixed address (the block offset) and the dynarray
+// metadata that the accessor lowering reads from the argument copies. Any
+// other load, call or phi may depend on the thread.
+static bool isUniform(const Value *val, const SymbolIndex &symbols) {
+  if (isa<Argument>(val) || isa<Constant>(val)) return true;
+
+  if (const CallInst *call = dyn_cast<CallInst>(val)) {
+    const Function *callee = call->getCalledFunction();
+    return callee && symbols.isCUDARegister(callee);
+  }
+
+  const LoadInst *load = dyn_cast<LoadInst>(val);
+  if (!load || load->isVolatile()) return false;
+
+  const Value *ptr = load->getPointerOperand();
+  if (isa<Constant>(ptr)) return load->getPointerAddressSpace() == 4;
+  if (!load->getMetadata(LLVMContext::MD_invariant_load)) return false;
+
+  while (true) {
+    ptr = ptr->stripPointerCasts();
+    const GEPOperator *gep = dyn_cast<GEPOperator>(ptr);
+    if (!gep || !gep->hasAllConstantIndices()) break;
+    ptr = gep->getPointerOperand();
+  }
+  return findAllocaSource(ptr) != NULL;
+}
+
+namespace {
+
+struct FindThreadIdx {
+  const SymbolIndex &symbols;
+  unsigned dim;
+  bool found;
+  bool opaque;
+  FindThreadIdx(const SymbolIndex &symbols, unsigned dim) :
+    symbols(symbols), dim(dim), found(false), opaque(false) {}
+  bool follow(const SCEV *scev) {
+    found = found || isThreadIdx(scev, dim, symbols);
+    if (const SCEVUnknown *unknown = dyn_cast<SCEVUnknown>(scev))
+      opaque = opaque || (!isThreadIdx(scev, dim, symbols) &&
+                          !isUniform(unknown->getValue(), symbols));
+    return true;
+  }
+  bool isDone() const { return opaque; }
+};
+
+}
+
+static bool dependsOnThreadIdx(const SCEV *expr, unsigned dim,
+                               const SymbolIndex &symbols) {
+  FindThreadIdx finder(symbols, dim);
+  visitAll(expr, finder);
+  return finder.found;
+}
+
+bool getThreadCoefficient(const SCEV *expr, unsigned dim, ScalarEvolution &SE,
+                          const SymbolIndex &symbols, int64_t &coef) {
+  coef = 0;
+  FindThreadIdx finder(symbols, dim);
+  visitAll(expr, finder);
+  if (finder.opaque) return false;
+  if (!finder.found) return true;
+
+  if (isa<SCEVUnknown>(expr)) {
+    coef = 1;
+    return true;
+  }
+  if (const SCEVCastExpr *cast = dyn_cast<SCEVCastExpr>(expr))
+    return getThreadCoefficient(cast->getOperand(), dim, SE, symbols, coef);
+
+  if (const SCEVAddExpr *add = dyn_cast<SCEVAddExpr>(expr)) {
+    for (const SCEV *op : add->operands()) {
+      int64_t term;
+      if (!getThreadCoefficient(op, dim, SE, symbols, term)) return false;
+      coef += term;
+    }
+    return true;
+  }
+
+  if (const SCEVMulExpr *mul = dyn_cast<SCEVMulExpr>(expr)) {
+    const SCEVConstant *scale = dyn_cast<SCEVConstant>(mul->getOperand(0));
+    if (!scale || mul->getNumOperands() != 2 ||
+        !getThreadCoefficient(mul->getOperand(1), dim, SE, symbols, coef))
+      return false;
+    coef *= scale->getValue()->getSExtValue();
+    return true;
+  }
+
+  // Loops that do not step with the thread index, e.g. i = t; i < n; i += 32
+  if (const SCEVAddRecExpr *rec = dyn_cast<SCEVAddRecExpr>(expr)) {
+    return rec->isAffine() &&
+           !dependsOnThreadIdx(rec->getStepRecurrence(SE), dim, symbols) &&
+           getThreadCoefficient(rec->getStart(), dim, SE, symbols, coef);
+  }
+
+  return false;
+}
+
+}
+
+// vim: set ts=2 sw=2:
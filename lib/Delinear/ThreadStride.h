@@ -0,0 +1,27 @@
+#ifndef THREAD_STRIDE_H
+#define THREAD_STRIDE_H
+
+#include <stdint.h>
+
+namespace llvm {
+class SCEV;
+class ScalarEvolution;
+}
+
+namespace platonic {
+
+class SymbolIndex;
+
+// Coefficient of threadIdx along dim (0: x, 1: y, 2: z) in expr, i.e. how
+// much expr grows from a thread to the next one along dim. Returns false
+// when expr is not an affine function of the thread index, or when it
+// depends on values that may differ between threads (loads, calls, phis)
+// other than the thread index. Addresses from the dynarray accessors are
+// such calls, so the callers run after -cudarrays-lower-accessors.
+bool getThreadCoefficient(const llvm::SCEV *expr, unsigned dim,
+                          llvm::ScalarEvolution &SE,
+                          const SymbolIndex &symbols, int64_t &coef);
+
+}
+
+#endif // THREAD_STRIDE_H
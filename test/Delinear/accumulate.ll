@@ -0,0 +1,39 @@
+; An element that a loop reads and writes at a fixed index, as left by the
+; accessor lowering: c[t.x] is kept in a register and stored once after
+; the loop.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+define void @_Z17accumulate_kernelPfPKfi(float* noalias %c, float* noalias %a, i32 %n) {
+entry:
+  %tid = tail call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %idx = sext i32 %tid to i64
+  %cptr = getelementptr inbounds float* %c, i64 %idx
+  %nonempty = icmp sgt i32 %n, 0
+  br i1 %nonempty, label %preheader, label %exit
+
+preheader:
+  br label %loop
+
+loop:
+  %k = phi i32 [ 0, %preheader ], [ %next, %loop ]
+  %kidx = sext i32 %k to i64
+  %aptr = getelementptr inbounds float* %a, i64 %kidx
+  %aval = load float* %aptr, align 4
+  %cval = load float* %cptr, align 4
+  %sum = fadd float %cval, %aval
+  store float %sum, float* %cptr, align 4
+  %next = add nsw i32 %k, 1
+  %done = icmp eq i32 %next, %n
+  br i1 %done, label %loopexit, label %loop
+
+loopexit:
+  br label %exit
+
+exit:
+  ret void
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+
+attributes #0 = { nounwind readnone }
@@ -0,0 +1,37 @@
+; Bounds checks of a dynarray accessor. The first check is not dominated by
+; any guard and must be kept, the second one repeats it and is removed.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+define void @_Z12check_boundsPfi(float* %a, i32 %n) {
+entry:
+  %tid = tail call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ctaid = tail call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %ntid = tail call i32 @llvm.nvvm.read.ptx.sreg.ntid.x()
+  %base = mul i32 %ctaid, %ntid
+  %i = add i32 %base, %tid
+  %guard = icmp slt i32 %i, %n
+  br i1 %guard, label %check, label %trap
+
+check:
+  %inbounds = icmp slt i32 %i, %n
+  br i1 %inbounds, label %body, label %trap
+
+body:
+  %idx = sext i32 %i to i64
+  %ptr = getelementptr inbounds float* %a, i64 %idx
+  store float 0.000000e+00, float* %ptr, align 4
+  ret void
+
+trap:
+  tail call void @abort() #1
+  unreachable
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ntid.x() #0
+declare void @abort() #1
+
+attributes #0 = { nounwind readnone }
+attributes #1 = { noreturn nounwind }
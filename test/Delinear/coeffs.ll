@@ -0,0 +1,71 @@
+; Read-only dynarray of two coefficients that every thread reads at the
+; same indices. It is registered for constant memory and its data pointer
+; becomes a global of the constant address space.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+%struct._ZN9cudarrays6mydim3E = type { i32, i32, i32 }
+%struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE }
+%struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, %struct._ZN9cudarrays11dim_managerIfLj1EEE, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, float* }
+%struct._ZN9cudarrays11dim_managerIfLj1EEE = type { i32, i32, i32, [1 x i32], i32*, [0 x i32] }
+%struct._ZN9cudarrays12host_storageIfEE = type { %struct._ZN9cudarrays12host_storageIfE5stateE* }
+%struct._ZN9cudarrays12host_storageIfE5stateE = type opaque
+%struct._ZN9cudarrays9coherenceE = type { i8, i8 }
+%struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE }
+%struct.dim3 = type { i32, i32, i32 }
+
+@offset = internal addrspace(4) global %struct._ZN9cudarrays6mydim3E zeroinitializer, align 4
+
+define void @_Z12scale_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEEEvNS0_8dynarrayIfLj1ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj1ELb1ELS9_0ESA_EESC_4dim3SD_(%struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramC, %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct.dim3 %off, %struct.dim3 %gSize) {
+  %C = alloca %struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
+  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
+  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
+  store %struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramC, %struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %C, align 8
+  store %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
+  store %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8
+  %1 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %2 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %3 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4
+  %4 = add i32 %2, %3
+  %5 = call i32 @llvm.nvvm.read.ptx.sreg.ntid.x()
+  %6 = mul i32 %4, %5
+  %7 = add i32 %1, %6
+  %call = call float* @_ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %7)
+  %8 = load float* %call, align 4
+  %call1 = call float* @_ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 0)
+  %9 = load float* %call1, align 4
+  %call2 = call float* @_ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 1)
+  %10 = load float* %call2, align 4
+  %11 = fmul float %8, %9
+  %12 = fadd float %11, %10
+  %call3 = call float* @_ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %C, i32 %7)
+  store float %12, float* %call3, align 4
+  ret void
+}
+
+define float* @_ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx) #1 {
+  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj1ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0
+  %call = call float* @_ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj2EEERfiii(%struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 0, i32 %idx)
+  ret float* %call
+}
+
+define float* @_ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEi(%struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx) #1 {
+  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj1ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0
+  %call = call float* @_ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj2EEERfiii(%struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 0, i32 %idx)
+  ret float* %call
+}
+
+define float* @_ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj2EEERfiii(%struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #2 {
+  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj1ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 10
+  %2 = load float** %1, align 8
+  %3 = getelementptr inbounds float* %2, i32 %idx3
+  ret float* %3
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ntid.x() #0
+
+attributes #0 = { nounwind readnone }
+attributes #1 = { noinline }
+attributes #2 = { inlinehint }
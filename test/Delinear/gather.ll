@@ -0,0 +1,34 @@
+; Coalescing of a gather. idx and out are read and written with unit
+; stride and the column of in with a stride of 32 elements; in[idx[i]]
+; depends on a load and is irregular.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+define void @_Z13gather_kernelPfPKfPKi(float* noalias %out, float* noalias %in, i32* noalias %idx) {
+entry:
+  %tid = call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ctaid = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %ntid = call i32 @llvm.nvvm.read.ptx.sreg.ntid.x()
+  %base = mul i32 %ctaid, %ntid
+  %i = add i32 %base, %tid
+  %i64 = sext i32 %i to i64
+  %idxptr = getelementptr inbounds i32* %idx, i64 %i64
+  %j = load i32* %idxptr, align 4
+  %j64 = sext i32 %j to i64
+  %gatherptr = getelementptr inbounds float* %in, i64 %j64
+  %a = load float* %gatherptr, align 4
+  %col = mul i32 %i, 32
+  %col64 = sext i32 %col to i64
+  %colptr = getelementptr inbounds float* %in, i64 %col64
+  %b = load float* %colptr, align 4
+  %sum = fadd float %a, %b
+  %outptr = getelementptr inbounds float* %out, i64 %i64
+  store float %sum, float* %outptr, align 4
+  ret void
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ntid.x() #0
+
+attributes #0 = { nounwind readnone }
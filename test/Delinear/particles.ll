@@ -0,0 +1,36 @@
+; Records of two fields in shared memory, one per thread. The threads of a
+; warp access words 4 apart, and the array becomes an array of fields.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+@particles.cells = internal addrspace(3) global [256 x [4 x float]] zeroinitializer, align 4
+
+define void @_Z16particles_kernelPfPKf(float* noalias %out, float* noalias %in) {
+entry:
+  %tid = call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ctaid = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %base = mul i32 %ctaid, 256
+  %i = add i32 %base, %tid
+  %i64 = sext i32 %i to i64
+  %src = getelementptr inbounds float* %in, i64 %i64
+  %x = load float* %src, align 4
+  %v = fmul float %x, 2.000000e+00
+  %cx = getelementptr inbounds [256 x [4 x float]] addrspace(3)* @particles.cells, i32 0, i32 %tid, i32 0
+  store float %x, float addrspace(3)* %cx, align 4
+  %cv = getelementptr inbounds [256 x [4 x float]] addrspace(3)* @particles.cells, i32 0, i32 %tid, i32 1
+  store float %v, float addrspace(3)* %cv, align 4
+  call void @llvm.cuda.syncthreads()
+  %px = load float addrspace(3)* %cx, align 4
+  %pv = load float addrspace(3)* %cv, align 4
+  %sum = fadd float %px, %pv
+  %dst = getelementptr inbounds float* %out, i64 %i64
+  store float %sum, float* %dst, align 4
+  ret void
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare void @llvm.cuda.syncthreads() #1
+
+attributes #0 = { nounwind readnone }
+attributes #1 = { nounwind }
@@ -0,0 +1,42 @@
+; Block reversal through shared memory, read and written through a generic
+; pointer. Only the reads of in and the writes of out reach global memory.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+@reverse.tile = internal addrspace(3) global [256 x float] zeroinitializer, align 4
+
+define void @_Z14reverse_kernelPfPKf(float* noalias %out, float* noalias %in) {
+entry:
+  %tid = call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ctaid = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %base = mul i32 %ctaid, 256
+  %i = add i32 %base, %tid
+  %i64 = sext i32 %i to i64
+  %src = getelementptr inbounds float* %in, i64 %i64
+  %val = load float* %src, align 4
+  %tile = call float* @llvm.nvvm.ptr.shared.to.gen.p0f32.p3f32(float addrspace(3)* getelementptr inbounds ([256 x float] addrspace(3)* @reverse.tile, i32 0, i32 0))
+  %tid64 = sext i32 %tid to i64
+  %slot = getelementptr inbounds float* %tile, i64 %tid64
+  store float %val, float* %slot, align 4
+  call void @llvm.cuda.syncthreads()
+  %rtid = sub i64 255, %tid64
+  %rslot = getelementptr inbounds float* %tile, i64 %rtid
+  %rval = load float* %rslot, align 4
+  %scaled = fmul float %rval, 2.000000e+00
+  %sum = fadd float %scaled, %val
+  %dst = getelementptr inbounds float* %out, i64 %i64
+  store float %sum, float* %dst, align 4
+  ret void
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare float* @llvm.nvvm.ptr.shared.to.gen.p0f32.p3f32(float addrspace(3)*) #0
+declare void @llvm.cuda.syncthreads() #1
+
+attributes #0 = { nounwind readnone }
+attributes #1 = { nounwind }
+
+!nvvm.annotations = !{!0}
+
+!0 = metadata !{void (float*, float*)* @_Z14reverse_kernelPfPKf, metadata !"kernel", i32 1, metadata !"reqntidx", i32 256, metadata !"reqntidy", i32 1, metadata !"reqntidz", i32 1}
@@ -1,5425 +1,44 @@
-; ModuleID = '/tmp/tmp-transpose.ll'
+; Tile transpose through shared memory. The column reads of tile are 32-way
+; bank conflicts and its rows get padded; flat is indexed past its rows, as
+; InstCombine leaves flattened indices, and keeps its layout.
 target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
 target triple = "nvptx-nvidia-cl.1.0"
 
-%struct._ZN9cudarrays6mydim3E = type { i32, i32, i32 }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, i32, i32, i32, [2 x i32], i8, i8, i8, i8, i32*, [1 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, float* }
-%struct._ZN9cudarrays12host_storageIfEE = type { %struct._ZN9cudarrays12host_storageIfE5stateE* }
-%struct._ZN9cudarrays12host_storageIfE5stateE = type opaque
-%struct._ZN9cudarrays9coherenceE = type { i8, i8 }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct.dim3 = type { i32, i32, i32 }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays11dim_managerIfLj2EEE = type { i32, i32, i32, [2 x i32], i8, i8, i8, i8, i32*, [1 x i32], [4 x i8] }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [2 x i32], [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [2 x i32], [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [2 x i32], [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE }
-%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE = type { i64*, %struct._ZN9cudarrays12host_storageIfEE, %struct._ZN9cudarrays9coherenceE, i8, i8, i8, i8, i8, i8, %struct._ZN9cudarrays11dim_managerIfLj2EEE, float*, [2 x i32], [2 x i32], [2 x i32], [1 x i32], [2 x i32], i8, i8, i8, i8, %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE* }
-%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE17storage_host_infoE = type opaque
-%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE = type { %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE }
-%struct.__SO__N9cudarrays11dim_managerIfLj2EEE = type opaque
-
-@offset = internal addrspace(4) global %struct._ZN9cudarrays6mydim3E zeroinitializer, align 4
-@"_Z25transpose_kernel_originalPfPKf$__cuda_local_var_66953_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-@"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile" = internal addrspace(3) global [32 x [33 x float]] zeroinitializer, align 4
-
-define void @_Z25transpose_kernel_originalPfPKf(float* %B, float* %A) {
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !166
-  %2 = mul i32 %1, 32, !dbg !166
-  %3 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !166
-  %4 = add i32 %2, %3, !dbg !166
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !170
-  %6 = mul i32 %5, 32, !dbg !170
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !170
-  %8 = add i32 %6, %7, !dbg !170
-  %9 = call i32 @llvm.nvvm.read.ptx.sreg.nctaid.x(), !dbg !171
-  %10 = mul i32 %9, 32, !dbg !171
-  br label %11, !dbg !172
-
-; <label>:11                                      ; preds = %27, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %28, %27 ]
-  %12 = icmp slt i32 %j.0, 32, !dbg !172
-  br i1 %12, label %13, label %29, !dbg !172
-
-; <label>:13                                      ; preds = %11
-  %14 = add nsw i32 %8, %j.0, !dbg !175
-  %15 = mul nsw i32 %14, %10, !dbg !175
-  %16 = add nsw i32 %15, %4, !dbg !175
-  %17 = getelementptr inbounds float* %A, i32 %16, !dbg !175
-  %18 = load float* %17, align 4, !dbg !175
-  %19 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !175
-  %20 = add i32 %19, %j.0, !dbg !175
-  %21 = zext i32 %20 to i64, !dbg !175
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z25transpose_kernel_originalPfPKf$__cuda_local_var_66953_35_non_const_tile", i32 0, i32 0), i64 %21, !dbg !175
-  %23 = getelementptr inbounds [33 x float] addrspace(3)* %22, i32 0, i32 0, !dbg !175
-  %24 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !175
-  %25 = zext i32 %24 to i64, !dbg !175
-  %26 = getelementptr inbounds float addrspace(3)* %23, i64 %25, !dbg !175
-  store float %18, float addrspace(3)* %26, align 4, !dbg !175
-  br label %27, !dbg !178
-
-; <label>:27                                      ; preds = %13
-  %28 = add nsw i32 %j.0, 8, !dbg !178
-  br label %11, !dbg !178
-
-; <label>:29                                      ; preds = %11
-  call void @llvm.cuda.syncthreads(), !dbg !179
-  %30 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !180
-  %31 = mul i32 %30, 32, !dbg !180
-  %32 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !180
-  %33 = add i32 %31, %32, !dbg !180
-  %34 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !181
-  %35 = mul i32 %34, 32, !dbg !181
-  %36 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !181
-  %37 = add i32 %35, %36, !dbg !181
-  br label %38, !dbg !182
-
-; <label>:38                                      ; preds = %54, %29
-  %j11.0 = phi i32 [ 0, %29 ], [ %55, %54 ]
-  %39 = icmp slt i32 %j11.0, 32, !dbg !182
-  br i1 %39, label %40, label %56, !dbg !182
-
-; <label>:40                                      ; preds = %38
-  %41 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !185
-  %42 = zext i32 %41 to i64, !dbg !185
-  %43 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z25transpose_kernel_originalPfPKf$__cuda_local_var_66953_35_non_const_tile", i32 0, i32 0), i64 %42, !dbg !185
-  %44 = getelementptr inbounds [33 x float] addrspace(3)* %43, i32 0, i32 0, !dbg !185
-  %45 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !185
-  %46 = add i32 %45, %j11.0, !dbg !185
-  %47 = zext i32 %46 to i64, !dbg !185
-  %48 = getelementptr inbounds float addrspace(3)* %44, i64 %47, !dbg !185
-  %49 = load float addrspace(3)* %48, align 4, !dbg !185
-  %50 = add nsw i32 %37, %j11.0, !dbg !185
-  %51 = mul nsw i32 %50, %10, !dbg !185
-  %52 = add nsw i32 %51, %33, !dbg !185
-  %53 = getelementptr inbounds float* %B, i32 %52, !dbg !185
-  store float %49, float* %53, align 4, !dbg !185
-  br label %54, !dbg !188
-
-; <label>:54                                      ; preds = %40
-  %55 = add nsw i32 %j11.0, 8, !dbg !188
-  br label %38, !dbg !188
-
-; <label>:56                                      ; preds = %38
-  ret void, !dbg !189
+@transpose.tile = internal addrspace(3) global [32 x [32 x float]] zeroinitializer, align 4
+@transpose.flat = internal addrspace(3) global [32 x [32 x float]] zeroinitializer, align 4
+
+define void @_Z16transpose_kernelPfPKf(float* noalias %out, float* noalias %in) {
+entry:
+  %tx = call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ty = call i32 @llvm.nvvm.read.ptx.sreg.tid.y()
+  %rowoff = mul i32 %ty, 32
+  %idx = add i32 %rowoff, %tx
+  %idx64 = zext i32 %idx to i64
+  %src = getelementptr inbounds float* %in, i64 %idx64
+  %val = load float* %src, align 4
+  %row = getelementptr inbounds [32 x [32 x float]] addrspace(3)* @transpose.tile, i32 0, i32 %ty, i32 %tx
+  store float %val, float addrspace(3)* %row, align 4
+  %flatoff = mul i32 %tx, 32
+  %flatidx = add i32 %flatoff, %ty
+  %flatptr = getelementptr inbounds [32 x [32 x float]] addrspace(3)* @transpose.flat, i32 0, i32 0, i32 %flatidx
+  store float %val, float addrspace(3)* %flatptr, align 4
+  call void @llvm.cuda.syncthreads()
+  %col = getelementptr inbounds [32 x [32 x float]] addrspace(3)* @transpose.tile, i32 0, i32 %tx, i32 %ty
+  %a = load float addrspace(3)* %col, align 4
+  %b = load float addrspace(3)* %flatptr, align 4
+  %sum = fadd float %a, %b
+  %dst = getelementptr inbounds float* %out, i64 %idx64
+  store float %sum, float* %dst, align 4
+  ret void
 }
 
-; Function Attrs: nounwind readnone
-declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
-
-; Function Attrs: nounwind readnone
 declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
-
-; Function Attrs: nounwind readnone
-declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.y() #0
-
-; Function Attrs: nounwind readnone
 declare i32 @llvm.nvvm.read.ptx.sreg.tid.y() #0
-
-; Function Attrs: nounwind readnone
-declare i32 @llvm.nvvm.read.ptx.sreg.nctaid.x() #0
-
-; Function Attrs: nounwind
 declare void @llvm.cuda.syncthreads() #1
 
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !190
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !192
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !192
-  %3 = add i32 %1, %2, !dbg !192
-  %4 = mul i32 %3, 32, !dbg !192
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !192
-  %6 = add i32 %4, %5, !dbg !192
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !195
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !195
-  %9 = add i32 %7, %8, !dbg !195
-  %10 = mul i32 %9, 32, !dbg !195
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !195
-  %12 = add i32 %10, %11, !dbg !195
-  br label %13, !dbg !196
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !196
-  br i1 %14, label %15, label %28, !dbg !196
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !199
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !202
-  %17 = load float* %call, align 4, !dbg !202
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !202
-  %19 = add i32 %18, %j.0, !dbg !202
-  %20 = zext i32 %19 to i64, !dbg !202
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !202
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !202
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !202
-  %24 = zext i32 %23 to i64, !dbg !202
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !202
-  store float %17, float addrspace(3)* %25, align 4, !dbg !202
-  br label %26, !dbg !203
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !203
-  br label %13, !dbg !203
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !204
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !205
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !205
-  %31 = add i32 %29, %30, !dbg !205
-  %32 = mul i32 %31, 32, !dbg !205
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !205
-  %34 = add i32 %32, %33, !dbg !205
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !206
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !206
-  %37 = add i32 %35, %36, !dbg !206
-  %38 = mul i32 %37, 32, !dbg !206
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !206
-  %40 = add i32 %38, %39, !dbg !206
-  br label %41, !dbg !207
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !207
-  br i1 %42, label %43, label %56, !dbg !207
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !210
-  %45 = zext i32 %44 to i64, !dbg !210
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !210
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !210
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !210
-  %49 = add i32 %48, %j10.0, !dbg !210
-  %50 = zext i32 %49 to i64, !dbg !210
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !210
-  %52 = load float addrspace(3)* %51, align 4, !dbg !210
-  %53 = add nsw i32 %40, %j10.0, !dbg !210
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !213
-  store float %52, float* %call13, align 4, !dbg !213
-  br label %54, !dbg !214
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !214
-  br label %41, !dbg !214
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !215
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !216
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !220
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !221
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !222
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !223
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !224
-  ret float* %call4, !dbg !224
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !225
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !229
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !230
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !231
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !232
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !233
-  ret float* %call4, !dbg !233
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !234
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !236
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !236
-  %3 = add i32 %1, %2, !dbg !236
-  %4 = mul i32 %3, 32, !dbg !236
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !236
-  %6 = add i32 %4, %5, !dbg !236
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !239
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !239
-  %9 = add i32 %7, %8, !dbg !239
-  %10 = mul i32 %9, 32, !dbg !239
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !239
-  %12 = add i32 %10, %11, !dbg !239
-  br label %13, !dbg !240
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !240
-  br i1 %14, label %15, label %28, !dbg !240
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !243
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !246
-  %17 = load float* %call, align 4, !dbg !246
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !246
-  %19 = add i32 %18, %j.0, !dbg !246
-  %20 = zext i32 %19 to i64, !dbg !246
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !246
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !246
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !246
-  %24 = zext i32 %23 to i64, !dbg !246
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !246
-  store float %17, float addrspace(3)* %25, align 4, !dbg !246
-  br label %26, !dbg !247
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !247
-  br label %13, !dbg !247
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !248
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !249
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !249
-  %31 = add i32 %29, %30, !dbg !249
-  %32 = mul i32 %31, 32, !dbg !249
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !249
-  %34 = add i32 %32, %33, !dbg !249
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !250
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !250
-  %37 = add i32 %35, %36, !dbg !250
-  %38 = mul i32 %37, 32, !dbg !250
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !250
-  %40 = add i32 %38, %39, !dbg !250
-  br label %41, !dbg !251
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !251
-  br i1 %42, label %43, label %56, !dbg !251
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !254
-  %45 = zext i32 %44 to i64, !dbg !254
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !254
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !254
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !254
-  %49 = add i32 %48, %j10.0, !dbg !254
-  %50 = zext i32 %49 to i64, !dbg !254
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !254
-  %52 = load float addrspace(3)* %51, align 4, !dbg !254
-  %53 = add nsw i32 %40, %j10.0, !dbg !254
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !257
-  store float %52, float* %call13, align 4, !dbg !257
-  br label %54, !dbg !258
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !258
-  br label %41, !dbg !258
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !259
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !260
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !264
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !265
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !266
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !267
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !268
-  ret float* %call4, !dbg !268
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !269
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !273
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !274
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !275
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !276
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !277
-  ret float* %call4, !dbg !277
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !278
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !280
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !280
-  %3 = add i32 %1, %2, !dbg !280
-  %4 = mul i32 %3, 32, !dbg !280
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !280
-  %6 = add i32 %4, %5, !dbg !280
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !283
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !283
-  %9 = add i32 %7, %8, !dbg !283
-  %10 = mul i32 %9, 32, !dbg !283
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !283
-  %12 = add i32 %10, %11, !dbg !283
-  br label %13, !dbg !284
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !284
-  br i1 %14, label %15, label %28, !dbg !284
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !287
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !290
-  %17 = load float* %call, align 4, !dbg !290
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !290
-  %19 = add i32 %18, %j.0, !dbg !290
-  %20 = zext i32 %19 to i64, !dbg !290
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !290
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !290
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !290
-  %24 = zext i32 %23 to i64, !dbg !290
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !290
-  store float %17, float addrspace(3)* %25, align 4, !dbg !290
-  br label %26, !dbg !291
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !291
-  br label %13, !dbg !291
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !292
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !293
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !293
-  %31 = add i32 %29, %30, !dbg !293
-  %32 = mul i32 %31, 32, !dbg !293
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !293
-  %34 = add i32 %32, %33, !dbg !293
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !294
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !294
-  %37 = add i32 %35, %36, !dbg !294
-  %38 = mul i32 %37, 32, !dbg !294
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !294
-  %40 = add i32 %38, %39, !dbg !294
-  br label %41, !dbg !295
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !295
-  br i1 %42, label %43, label %56, !dbg !295
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !298
-  %45 = zext i32 %44 to i64, !dbg !298
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !298
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !298
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !298
-  %49 = add i32 %48, %j10.0, !dbg !298
-  %50 = zext i32 %49 to i64, !dbg !298
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !298
-  %52 = load float addrspace(3)* %51, align 4, !dbg !298
-  %53 = add nsw i32 %40, %j10.0, !dbg !298
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !301
-  store float %52, float* %call13, align 4, !dbg !301
-  br label %54, !dbg !302
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !302
-  br label %41, !dbg !302
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !303
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !304
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !308
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !309
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !310
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !311
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !312
-  ret float* %call4, !dbg !312
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !313
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !317
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !318
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !319
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !320
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !321
-  ret float* %call4, !dbg !321
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !322
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !324
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !324
-  %3 = add i32 %1, %2, !dbg !324
-  %4 = mul i32 %3, 32, !dbg !324
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !324
-  %6 = add i32 %4, %5, !dbg !324
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !327
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !327
-  %9 = add i32 %7, %8, !dbg !327
-  %10 = mul i32 %9, 32, !dbg !327
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !327
-  %12 = add i32 %10, %11, !dbg !327
-  br label %13, !dbg !328
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !328
-  br i1 %14, label %15, label %28, !dbg !328
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !331
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !334
-  %17 = load float* %call, align 4, !dbg !334
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !334
-  %19 = add i32 %18, %j.0, !dbg !334
-  %20 = zext i32 %19 to i64, !dbg !334
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !334
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !334
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !334
-  %24 = zext i32 %23 to i64, !dbg !334
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !334
-  store float %17, float addrspace(3)* %25, align 4, !dbg !334
-  br label %26, !dbg !335
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !335
-  br label %13, !dbg !335
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !336
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !337
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !337
-  %31 = add i32 %29, %30, !dbg !337
-  %32 = mul i32 %31, 32, !dbg !337
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !337
-  %34 = add i32 %32, %33, !dbg !337
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !338
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !338
-  %37 = add i32 %35, %36, !dbg !338
-  %38 = mul i32 %37, 32, !dbg !338
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !338
-  %40 = add i32 %38, %39, !dbg !338
-  br label %41, !dbg !339
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !339
-  br i1 %42, label %43, label %56, !dbg !339
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !342
-  %45 = zext i32 %44 to i64, !dbg !342
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !342
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !342
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !342
-  %49 = add i32 %48, %j10.0, !dbg !342
-  %50 = zext i32 %49 to i64, !dbg !342
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !342
-  %52 = load float addrspace(3)* %51, align 4, !dbg !342
-  %53 = add nsw i32 %40, %j10.0, !dbg !342
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !345
-  store float %52, float* %call13, align 4, !dbg !345
-  br label %54, !dbg !346
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !346
-  br label %41, !dbg !346
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !347
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !348
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !352
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !353
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !354
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !355
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !356
-  ret float* %call4, !dbg !356
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !357
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !361
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !362
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !363
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !364
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !365
-  ret float* %call4, !dbg !365
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !366
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !368
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !368
-  %3 = add i32 %1, %2, !dbg !368
-  %4 = mul i32 %3, 32, !dbg !368
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !368
-  %6 = add i32 %4, %5, !dbg !368
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !371
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !371
-  %9 = add i32 %7, %8, !dbg !371
-  %10 = mul i32 %9, 32, !dbg !371
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !371
-  %12 = add i32 %10, %11, !dbg !371
-  br label %13, !dbg !372
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !372
-  br i1 %14, label %15, label %28, !dbg !372
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !375
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !378
-  %17 = load float* %call, align 4, !dbg !378
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !378
-  %19 = add i32 %18, %j.0, !dbg !378
-  %20 = zext i32 %19 to i64, !dbg !378
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !378
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !378
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !378
-  %24 = zext i32 %23 to i64, !dbg !378
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !378
-  store float %17, float addrspace(3)* %25, align 4, !dbg !378
-  br label %26, !dbg !379
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !379
-  br label %13, !dbg !379
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !380
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !381
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !381
-  %31 = add i32 %29, %30, !dbg !381
-  %32 = mul i32 %31, 32, !dbg !381
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !381
-  %34 = add i32 %32, %33, !dbg !381
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !382
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !382
-  %37 = add i32 %35, %36, !dbg !382
-  %38 = mul i32 %37, 32, !dbg !382
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !382
-  %40 = add i32 %38, %39, !dbg !382
-  br label %41, !dbg !383
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !383
-  br i1 %42, label %43, label %56, !dbg !383
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !386
-  %45 = zext i32 %44 to i64, !dbg !386
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !386
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !386
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !386
-  %49 = add i32 %48, %j10.0, !dbg !386
-  %50 = zext i32 %49 to i64, !dbg !386
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !386
-  %52 = load float addrspace(3)* %51, align 4, !dbg !386
-  %53 = add nsw i32 %40, %j10.0, !dbg !386
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !389
-  store float %52, float* %call13, align 4, !dbg !389
-  br label %54, !dbg !390
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !390
-  br label %41, !dbg !390
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !391
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !392
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !396
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !397
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !398
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !399
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !400
-  ret float* %call4, !dbg !400
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !401
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !405
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !406
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !407
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !408
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !409
-  ret float* %call4, !dbg !409
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !410
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !412
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !412
-  %3 = add i32 %1, %2, !dbg !412
-  %4 = mul i32 %3, 32, !dbg !412
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !412
-  %6 = add i32 %4, %5, !dbg !412
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !415
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !415
-  %9 = add i32 %7, %8, !dbg !415
-  %10 = mul i32 %9, 32, !dbg !415
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !415
-  %12 = add i32 %10, %11, !dbg !415
-  br label %13, !dbg !416
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !416
-  br i1 %14, label %15, label %28, !dbg !416
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !419
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !422
-  %17 = load float* %call, align 4, !dbg !422
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !422
-  %19 = add i32 %18, %j.0, !dbg !422
-  %20 = zext i32 %19 to i64, !dbg !422
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !422
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !422
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !422
-  %24 = zext i32 %23 to i64, !dbg !422
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !422
-  store float %17, float addrspace(3)* %25, align 4, !dbg !422
-  br label %26, !dbg !423
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !423
-  br label %13, !dbg !423
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !424
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !425
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !425
-  %31 = add i32 %29, %30, !dbg !425
-  %32 = mul i32 %31, 32, !dbg !425
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !425
-  %34 = add i32 %32, %33, !dbg !425
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !426
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !426
-  %37 = add i32 %35, %36, !dbg !426
-  %38 = mul i32 %37, 32, !dbg !426
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !426
-  %40 = add i32 %38, %39, !dbg !426
-  br label %41, !dbg !427
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !427
-  br i1 %42, label %43, label %56, !dbg !427
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !430
-  %45 = zext i32 %44 to i64, !dbg !430
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !430
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !430
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !430
-  %49 = add i32 %48, %j10.0, !dbg !430
-  %50 = zext i32 %49 to i64, !dbg !430
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !430
-  %52 = load float addrspace(3)* %51, align 4, !dbg !430
-  %53 = add nsw i32 %40, %j10.0, !dbg !430
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !433
-  store float %52, float* %call13, align 4, !dbg !433
-  br label %54, !dbg !434
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !434
-  br label %41, !dbg !434
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !435
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !436
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !440
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !441
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !442
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !443
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !444
-  ret float* %call4, !dbg !444
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !445
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !449
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !450
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !451
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !452
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !453
-  ret float* %call4, !dbg !453
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !454
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !456
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !456
-  %3 = add i32 %1, %2, !dbg !456
-  %4 = mul i32 %3, 32, !dbg !456
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !456
-  %6 = add i32 %4, %5, !dbg !456
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !459
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !459
-  %9 = add i32 %7, %8, !dbg !459
-  %10 = mul i32 %9, 32, !dbg !459
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !459
-  %12 = add i32 %10, %11, !dbg !459
-  br label %13, !dbg !460
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !460
-  br i1 %14, label %15, label %28, !dbg !460
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !463
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !466
-  %17 = load float* %call, align 4, !dbg !466
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !466
-  %19 = add i32 %18, %j.0, !dbg !466
-  %20 = zext i32 %19 to i64, !dbg !466
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !466
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !466
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !466
-  %24 = zext i32 %23 to i64, !dbg !466
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !466
-  store float %17, float addrspace(3)* %25, align 4, !dbg !466
-  br label %26, !dbg !467
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !467
-  br label %13, !dbg !467
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !468
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !469
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !469
-  %31 = add i32 %29, %30, !dbg !469
-  %32 = mul i32 %31, 32, !dbg !469
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !469
-  %34 = add i32 %32, %33, !dbg !469
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !470
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !470
-  %37 = add i32 %35, %36, !dbg !470
-  %38 = mul i32 %37, 32, !dbg !470
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !470
-  %40 = add i32 %38, %39, !dbg !470
-  br label %41, !dbg !471
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !471
-  br i1 %42, label %43, label %56, !dbg !471
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !474
-  %45 = zext i32 %44 to i64, !dbg !474
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !474
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !474
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !474
-  %49 = add i32 %48, %j10.0, !dbg !474
-  %50 = zext i32 %49 to i64, !dbg !474
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !474
-  %52 = load float addrspace(3)* %51, align 4, !dbg !474
-  %53 = add nsw i32 %40, %j10.0, !dbg !474
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !477
-  store float %52, float* %call13, align 4, !dbg !477
-  br label %54, !dbg !478
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !478
-  br label %41, !dbg !478
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !479
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !480
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !484
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !485
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !486
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !487
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !488
-  ret float* %call4, !dbg !488
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !489
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !493
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !494
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !495
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !496
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !497
-  ret float* %call4, !dbg !497
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !498
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !500
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !500
-  %3 = add i32 %1, %2, !dbg !500
-  %4 = mul i32 %3, 32, !dbg !500
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !500
-  %6 = add i32 %4, %5, !dbg !500
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !503
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !503
-  %9 = add i32 %7, %8, !dbg !503
-  %10 = mul i32 %9, 32, !dbg !503
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !503
-  %12 = add i32 %10, %11, !dbg !503
-  br label %13, !dbg !504
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !504
-  br i1 %14, label %15, label %28, !dbg !504
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !507
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !510
-  %17 = load float* %call, align 4, !dbg !510
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !510
-  %19 = add i32 %18, %j.0, !dbg !510
-  %20 = zext i32 %19 to i64, !dbg !510
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !510
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !510
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !510
-  %24 = zext i32 %23 to i64, !dbg !510
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !510
-  store float %17, float addrspace(3)* %25, align 4, !dbg !510
-  br label %26, !dbg !511
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !511
-  br label %13, !dbg !511
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !512
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !513
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !513
-  %31 = add i32 %29, %30, !dbg !513
-  %32 = mul i32 %31, 32, !dbg !513
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !513
-  %34 = add i32 %32, %33, !dbg !513
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !514
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !514
-  %37 = add i32 %35, %36, !dbg !514
-  %38 = mul i32 %37, 32, !dbg !514
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !514
-  %40 = add i32 %38, %39, !dbg !514
-  br label %41, !dbg !515
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !515
-  br i1 %42, label %43, label %56, !dbg !515
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !518
-  %45 = zext i32 %44 to i64, !dbg !518
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !518
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !518
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !518
-  %49 = add i32 %48, %j10.0, !dbg !518
-  %50 = zext i32 %49 to i64, !dbg !518
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !518
-  %52 = load float addrspace(3)* %51, align 4, !dbg !518
-  %53 = add nsw i32 %40, %j10.0, !dbg !518
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !521
-  store float %52, float* %call13, align 4, !dbg !521
-  br label %54, !dbg !522
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !522
-  br label %41, !dbg !522
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !523
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !524
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !528
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !529
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !530
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !531
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !532
-  ret float* %call4, !dbg !532
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !533
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !537
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !538
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !539
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !540
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !541
-  ret float* %call4, !dbg !541
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !542
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !544
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !544
-  %3 = add i32 %1, %2, !dbg !544
-  %4 = mul i32 %3, 32, !dbg !544
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !544
-  %6 = add i32 %4, %5, !dbg !544
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !547
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !547
-  %9 = add i32 %7, %8, !dbg !547
-  %10 = mul i32 %9, 32, !dbg !547
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !547
-  %12 = add i32 %10, %11, !dbg !547
-  br label %13, !dbg !548
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !548
-  br i1 %14, label %15, label %28, !dbg !548
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !551
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !554
-  %17 = load float* %call, align 4, !dbg !554
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !554
-  %19 = add i32 %18, %j.0, !dbg !554
-  %20 = zext i32 %19 to i64, !dbg !554
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !554
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !554
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !554
-  %24 = zext i32 %23 to i64, !dbg !554
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !554
-  store float %17, float addrspace(3)* %25, align 4, !dbg !554
-  br label %26, !dbg !555
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !555
-  br label %13, !dbg !555
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !556
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !557
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !557
-  %31 = add i32 %29, %30, !dbg !557
-  %32 = mul i32 %31, 32, !dbg !557
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !557
-  %34 = add i32 %32, %33, !dbg !557
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !558
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !558
-  %37 = add i32 %35, %36, !dbg !558
-  %38 = mul i32 %37, 32, !dbg !558
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !558
-  %40 = add i32 %38, %39, !dbg !558
-  br label %41, !dbg !559
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !559
-  br i1 %42, label %43, label %56, !dbg !559
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !562
-  %45 = zext i32 %44 to i64, !dbg !562
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !562
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !562
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !562
-  %49 = add i32 %48, %j10.0, !dbg !562
-  %50 = zext i32 %49 to i64, !dbg !562
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !562
-  %52 = load float addrspace(3)* %51, align 4, !dbg !562
-  %53 = add nsw i32 %40, %j10.0, !dbg !562
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !565
-  store float %52, float* %call13, align 4, !dbg !565
-  br label %54, !dbg !566
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !566
-  br label %41, !dbg !566
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !567
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !568
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !572
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !573
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !574
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !575
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !576
-  ret float* %call4, !dbg !576
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !577
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !581
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !582
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !583
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !584
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !585
-  ret float* %call4, !dbg !585
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !586
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !588
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !588
-  %3 = add i32 %1, %2, !dbg !588
-  %4 = mul i32 %3, 32, !dbg !588
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !588
-  %6 = add i32 %4, %5, !dbg !588
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !591
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !591
-  %9 = add i32 %7, %8, !dbg !591
-  %10 = mul i32 %9, 32, !dbg !591
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !591
-  %12 = add i32 %10, %11, !dbg !591
-  br label %13, !dbg !592
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !592
-  br i1 %14, label %15, label %28, !dbg !592
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !595
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !598
-  %17 = load float* %call, align 4, !dbg !598
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !598
-  %19 = add i32 %18, %j.0, !dbg !598
-  %20 = zext i32 %19 to i64, !dbg !598
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !598
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !598
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !598
-  %24 = zext i32 %23 to i64, !dbg !598
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !598
-  store float %17, float addrspace(3)* %25, align 4, !dbg !598
-  br label %26, !dbg !599
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !599
-  br label %13, !dbg !599
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !600
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !601
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !601
-  %31 = add i32 %29, %30, !dbg !601
-  %32 = mul i32 %31, 32, !dbg !601
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !601
-  %34 = add i32 %32, %33, !dbg !601
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !602
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !602
-  %37 = add i32 %35, %36, !dbg !602
-  %38 = mul i32 %37, 32, !dbg !602
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !602
-  %40 = add i32 %38, %39, !dbg !602
-  br label %41, !dbg !603
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !603
-  br i1 %42, label %43, label %56, !dbg !603
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !606
-  %45 = zext i32 %44 to i64, !dbg !606
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !606
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !606
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !606
-  %49 = add i32 %48, %j10.0, !dbg !606
-  %50 = zext i32 %49 to i64, !dbg !606
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !606
-  %52 = load float addrspace(3)* %51, align 4, !dbg !606
-  %53 = add nsw i32 %40, %j10.0, !dbg !606
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !609
-  store float %52, float* %call13, align 4, !dbg !609
-  br label %54, !dbg !610
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !610
-  br label %41, !dbg !610
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !611
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !612
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !616
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !617
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !618
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !619
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !620
-  ret float* %call4, !dbg !620
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !621
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !625
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !626
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !627
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !628
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !629
-  ret float* %call4, !dbg !629
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !630
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !632
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !632
-  %3 = add i32 %1, %2, !dbg !632
-  %4 = mul i32 %3, 32, !dbg !632
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !632
-  %6 = add i32 %4, %5, !dbg !632
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !635
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !635
-  %9 = add i32 %7, %8, !dbg !635
-  %10 = mul i32 %9, 32, !dbg !635
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !635
-  %12 = add i32 %10, %11, !dbg !635
-  br label %13, !dbg !636
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !636
-  br i1 %14, label %15, label %28, !dbg !636
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !639
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !642
-  %17 = load float* %call, align 4, !dbg !642
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !642
-  %19 = add i32 %18, %j.0, !dbg !642
-  %20 = zext i32 %19 to i64, !dbg !642
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !642
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !642
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !642
-  %24 = zext i32 %23 to i64, !dbg !642
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !642
-  store float %17, float addrspace(3)* %25, align 4, !dbg !642
-  br label %26, !dbg !643
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !643
-  br label %13, !dbg !643
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !644
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !645
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !645
-  %31 = add i32 %29, %30, !dbg !645
-  %32 = mul i32 %31, 32, !dbg !645
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !645
-  %34 = add i32 %32, %33, !dbg !645
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !646
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !646
-  %37 = add i32 %35, %36, !dbg !646
-  %38 = mul i32 %37, 32, !dbg !646
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !646
-  %40 = add i32 %38, %39, !dbg !646
-  br label %41, !dbg !647
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !647
-  br i1 %42, label %43, label %56, !dbg !647
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !650
-  %45 = zext i32 %44 to i64, !dbg !650
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !650
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !650
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !650
-  %49 = add i32 %48, %j10.0, !dbg !650
-  %50 = zext i32 %49 to i64, !dbg !650
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !650
-  %52 = load float addrspace(3)* %51, align 4, !dbg !650
-  %53 = add nsw i32 %40, %j10.0, !dbg !650
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !653
-  store float %52, float* %call13, align 4, !dbg !653
-  br label %54, !dbg !654
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !654
-  br label %41, !dbg !654
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !655
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !656
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !660
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !661
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !662
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !663
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !664
-  ret float* %call4, !dbg !664
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !665
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !669
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !670
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !671
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !672
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !673
-  ret float* %call4, !dbg !673
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !674
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !676
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !676
-  %3 = add i32 %1, %2, !dbg !676
-  %4 = mul i32 %3, 32, !dbg !676
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !676
-  %6 = add i32 %4, %5, !dbg !676
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !679
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !679
-  %9 = add i32 %7, %8, !dbg !679
-  %10 = mul i32 %9, 32, !dbg !679
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !679
-  %12 = add i32 %10, %11, !dbg !679
-  br label %13, !dbg !680
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !680
-  br i1 %14, label %15, label %28, !dbg !680
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !683
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !686
-  %17 = load float* %call, align 4, !dbg !686
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !686
-  %19 = add i32 %18, %j.0, !dbg !686
-  %20 = zext i32 %19 to i64, !dbg !686
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !686
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !686
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !686
-  %24 = zext i32 %23 to i64, !dbg !686
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !686
-  store float %17, float addrspace(3)* %25, align 4, !dbg !686
-  br label %26, !dbg !687
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !687
-  br label %13, !dbg !687
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !688
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !689
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !689
-  %31 = add i32 %29, %30, !dbg !689
-  %32 = mul i32 %31, 32, !dbg !689
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !689
-  %34 = add i32 %32, %33, !dbg !689
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !690
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !690
-  %37 = add i32 %35, %36, !dbg !690
-  %38 = mul i32 %37, 32, !dbg !690
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !690
-  %40 = add i32 %38, %39, !dbg !690
-  br label %41, !dbg !691
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !691
-  br i1 %42, label %43, label %56, !dbg !691
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !694
-  %45 = zext i32 %44 to i64, !dbg !694
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !694
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !694
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !694
-  %49 = add i32 %48, %j10.0, !dbg !694
-  %50 = zext i32 %49 to i64, !dbg !694
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !694
-  %52 = load float addrspace(3)* %51, align 4, !dbg !694
-  %53 = add nsw i32 %40, %j10.0, !dbg !694
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !697
-  store float %52, float* %call13, align 4, !dbg !697
-  br label %54, !dbg !698
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !698
-  br label %41, !dbg !698
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !699
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !700
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !704
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !705
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !706
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !707
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !708
-  ret float* %call4, !dbg !708
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !709
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !713
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !714
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !715
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !716
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !717
-  ret float* %call4, !dbg !717
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !718
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !720
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !720
-  %3 = add i32 %1, %2, !dbg !720
-  %4 = mul i32 %3, 32, !dbg !720
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !720
-  %6 = add i32 %4, %5, !dbg !720
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !723
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !723
-  %9 = add i32 %7, %8, !dbg !723
-  %10 = mul i32 %9, 32, !dbg !723
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !723
-  %12 = add i32 %10, %11, !dbg !723
-  br label %13, !dbg !724
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !724
-  br i1 %14, label %15, label %28, !dbg !724
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !727
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !730
-  %17 = load float* %call, align 4, !dbg !730
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !730
-  %19 = add i32 %18, %j.0, !dbg !730
-  %20 = zext i32 %19 to i64, !dbg !730
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !730
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !730
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !730
-  %24 = zext i32 %23 to i64, !dbg !730
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !730
-  store float %17, float addrspace(3)* %25, align 4, !dbg !730
-  br label %26, !dbg !731
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !731
-  br label %13, !dbg !731
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !732
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !733
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !733
-  %31 = add i32 %29, %30, !dbg !733
-  %32 = mul i32 %31, 32, !dbg !733
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !733
-  %34 = add i32 %32, %33, !dbg !733
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !734
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !734
-  %37 = add i32 %35, %36, !dbg !734
-  %38 = mul i32 %37, 32, !dbg !734
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !734
-  %40 = add i32 %38, %39, !dbg !734
-  br label %41, !dbg !735
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !735
-  br i1 %42, label %43, label %56, !dbg !735
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !738
-  %45 = zext i32 %44 to i64, !dbg !738
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !738
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !738
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !738
-  %49 = add i32 %48, %j10.0, !dbg !738
-  %50 = zext i32 %49 to i64, !dbg !738
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !738
-  %52 = load float addrspace(3)* %51, align 4, !dbg !738
-  %53 = add nsw i32 %40, %j10.0, !dbg !738
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !741
-  store float %52, float* %call13, align 4, !dbg !741
-  br label %54, !dbg !742
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !742
-  br label %41, !dbg !742
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !743
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !744
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !748
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !749
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !750
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !751
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !752
-  ret float* %call4, !dbg !752
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !753
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !757
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !758
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !759
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !760
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !761
-  ret float* %call4, !dbg !761
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !762
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !764
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !764
-  %3 = add i32 %1, %2, !dbg !764
-  %4 = mul i32 %3, 32, !dbg !764
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !764
-  %6 = add i32 %4, %5, !dbg !764
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !767
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !767
-  %9 = add i32 %7, %8, !dbg !767
-  %10 = mul i32 %9, 32, !dbg !767
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !767
-  %12 = add i32 %10, %11, !dbg !767
-  br label %13, !dbg !768
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !768
-  br i1 %14, label %15, label %28, !dbg !768
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !771
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !774
-  %17 = load float* %call, align 4, !dbg !774
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !774
-  %19 = add i32 %18, %j.0, !dbg !774
-  %20 = zext i32 %19 to i64, !dbg !774
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !774
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !774
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !774
-  %24 = zext i32 %23 to i64, !dbg !774
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !774
-  store float %17, float addrspace(3)* %25, align 4, !dbg !774
-  br label %26, !dbg !775
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !775
-  br label %13, !dbg !775
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !776
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !777
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !777
-  %31 = add i32 %29, %30, !dbg !777
-  %32 = mul i32 %31, 32, !dbg !777
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !777
-  %34 = add i32 %32, %33, !dbg !777
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !778
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !778
-  %37 = add i32 %35, %36, !dbg !778
-  %38 = mul i32 %37, 32, !dbg !778
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !778
-  %40 = add i32 %38, %39, !dbg !778
-  br label %41, !dbg !779
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !779
-  br i1 %42, label %43, label %56, !dbg !779
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !782
-  %45 = zext i32 %44 to i64, !dbg !782
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !782
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !782
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !782
-  %49 = add i32 %48, %j10.0, !dbg !782
-  %50 = zext i32 %49 to i64, !dbg !782
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !782
-  %52 = load float addrspace(3)* %51, align 4, !dbg !782
-  %53 = add nsw i32 %40, %j10.0, !dbg !782
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !785
-  store float %52, float* %call13, align 4, !dbg !785
-  br label %54, !dbg !786
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !786
-  br label %41, !dbg !786
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !787
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !788
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !792
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !793
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !794
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !795
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !796
-  ret float* %call4, !dbg !796
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !797
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !801
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !802
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !803
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !804
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !805
-  ret float* %call4, !dbg !805
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !806
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !808
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !808
-  %3 = add i32 %1, %2, !dbg !808
-  %4 = mul i32 %3, 32, !dbg !808
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !808
-  %6 = add i32 %4, %5, !dbg !808
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !811
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !811
-  %9 = add i32 %7, %8, !dbg !811
-  %10 = mul i32 %9, 32, !dbg !811
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !811
-  %12 = add i32 %10, %11, !dbg !811
-  br label %13, !dbg !812
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !812
-  br i1 %14, label %15, label %28, !dbg !812
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !815
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !818
-  %17 = load float* %call, align 4, !dbg !818
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !818
-  %19 = add i32 %18, %j.0, !dbg !818
-  %20 = zext i32 %19 to i64, !dbg !818
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !818
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !818
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !818
-  %24 = zext i32 %23 to i64, !dbg !818
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !818
-  store float %17, float addrspace(3)* %25, align 4, !dbg !818
-  br label %26, !dbg !819
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !819
-  br label %13, !dbg !819
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !820
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !821
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !821
-  %31 = add i32 %29, %30, !dbg !821
-  %32 = mul i32 %31, 32, !dbg !821
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !821
-  %34 = add i32 %32, %33, !dbg !821
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !822
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !822
-  %37 = add i32 %35, %36, !dbg !822
-  %38 = mul i32 %37, 32, !dbg !822
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !822
-  %40 = add i32 %38, %39, !dbg !822
-  br label %41, !dbg !823
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !823
-  br i1 %42, label %43, label %56, !dbg !823
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !826
-  %45 = zext i32 %44 to i64, !dbg !826
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !826
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !826
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !826
-  %49 = add i32 %48, %j10.0, !dbg !826
-  %50 = zext i32 %49 to i64, !dbg !826
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !826
-  %52 = load float addrspace(3)* %51, align 4, !dbg !826
-  %53 = add nsw i32 %40, %j10.0, !dbg !826
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !829
-  store float %52, float* %call13, align 4, !dbg !829
-  br label %54, !dbg !830
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !830
-  br label %41, !dbg !830
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !831
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !832
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !836
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !837
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !838
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !839
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !840
-  ret float* %call4, !dbg !840
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !841
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !845
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !846
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !847
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !848
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !849
-  ret float* %call4, !dbg !849
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !850
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !852
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !852
-  %3 = add i32 %1, %2, !dbg !852
-  %4 = mul i32 %3, 32, !dbg !852
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !852
-  %6 = add i32 %4, %5, !dbg !852
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !855
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !855
-  %9 = add i32 %7, %8, !dbg !855
-  %10 = mul i32 %9, 32, !dbg !855
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !855
-  %12 = add i32 %10, %11, !dbg !855
-  br label %13, !dbg !856
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !856
-  br i1 %14, label %15, label %28, !dbg !856
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !859
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !862
-  %17 = load float* %call, align 4, !dbg !862
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !862
-  %19 = add i32 %18, %j.0, !dbg !862
-  %20 = zext i32 %19 to i64, !dbg !862
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !862
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !862
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !862
-  %24 = zext i32 %23 to i64, !dbg !862
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !862
-  store float %17, float addrspace(3)* %25, align 4, !dbg !862
-  br label %26, !dbg !863
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !863
-  br label %13, !dbg !863
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !864
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !865
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !865
-  %31 = add i32 %29, %30, !dbg !865
-  %32 = mul i32 %31, 32, !dbg !865
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !865
-  %34 = add i32 %32, %33, !dbg !865
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !866
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !866
-  %37 = add i32 %35, %36, !dbg !866
-  %38 = mul i32 %37, 32, !dbg !866
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !866
-  %40 = add i32 %38, %39, !dbg !866
-  br label %41, !dbg !867
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !867
-  br i1 %42, label %43, label %56, !dbg !867
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !870
-  %45 = zext i32 %44 to i64, !dbg !870
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !870
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !870
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !870
-  %49 = add i32 %48, %j10.0, !dbg !870
-  %50 = zext i32 %49 to i64, !dbg !870
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !870
-  %52 = load float addrspace(3)* %51, align 4, !dbg !870
-  %53 = add nsw i32 %40, %j10.0, !dbg !870
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !873
-  store float %52, float* %call13, align 4, !dbg !873
-  br label %54, !dbg !874
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !874
-  br label %41, !dbg !874
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !875
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !876
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !880
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !881
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !882
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !883
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !884
-  ret float* %call4, !dbg !884
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !885
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !889
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !890
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !891
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !892
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !893
-  ret float* %call4, !dbg !893
-}
-
-define void @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct.dim3 %off, %struct.dim3 %gSize) {
-  %B = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  %A = alloca %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, align 8
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramB, %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, align 8, !dbg !894
-  store %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE %__val_paramA, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, align 8
-  %1 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !896
-  %2 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !896
-  %3 = add i32 %1, %2, !dbg !896
-  %4 = mul i32 %3, 32, !dbg !896
-  %5 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !896
-  %6 = add i32 %4, %5, !dbg !896
-  %7 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !899
-  %8 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !899
-  %9 = add i32 %7, %8, !dbg !899
-  %10 = mul i32 %9, 32, !dbg !899
-  %11 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !899
-  %12 = add i32 %10, %11, !dbg !899
-  br label %13, !dbg !900
-
-; <label>:13                                      ; preds = %26, %0
-  %j.0 = phi i32 [ 0, %0 ], [ %27, %26 ]
-  %14 = icmp slt i32 %j.0, 32, !dbg !900
-  br i1 %14, label %15, label %28, !dbg !900
-
-; <label>:15                                      ; preds = %13
-  %16 = add nsw i32 %12, %j.0, !dbg !903
-  %call = call float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %A, i32 %16, i32 %6), !dbg !906
-  %17 = load float* %call, align 4, !dbg !906
-  %18 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !906
-  %19 = add i32 %18, %j.0, !dbg !906
-  %20 = zext i32 %19 to i64, !dbg !906
-  %21 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %20, !dbg !906
-  %22 = getelementptr inbounds [33 x float] addrspace(3)* %21, i32 0, i32 0, !dbg !906
-  %23 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !906
-  %24 = zext i32 %23 to i64, !dbg !906
-  %25 = getelementptr inbounds float addrspace(3)* %22, i64 %24, !dbg !906
-  store float %17, float addrspace(3)* %25, align 4, !dbg !906
-  br label %26, !dbg !907
-
-; <label>:26                                      ; preds = %15
-  %27 = add nsw i32 %j.0, 8, !dbg !907
-  br label %13, !dbg !907
-
-; <label>:28                                      ; preds = %13
-  call void @llvm.cuda.syncthreads(), !dbg !908
-  %29 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.y(), !dbg !909
-  %30 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 1), align 4, !dbg !909
-  %31 = add i32 %29, %30, !dbg !909
-  %32 = mul i32 %31, 32, !dbg !909
-  %33 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !909
-  %34 = add i32 %32, %33, !dbg !909
-  %35 = call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x(), !dbg !910
-  %36 = load i32 addrspace(4)* getelementptr inbounds (%struct._ZN9cudarrays6mydim3E addrspace(4)* @offset, i32 0, i32 0), align 4, !dbg !910
-  %37 = add i32 %35, %36, !dbg !910
-  %38 = mul i32 %37, 32, !dbg !910
-  %39 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !910
-  %40 = add i32 %38, %39, !dbg !910
-  br label %41, !dbg !911
-
-; <label>:41                                      ; preds = %54, %28
-  %j10.0 = phi i32 [ 0, %28 ], [ %55, %54 ]
-  %42 = icmp slt i32 %j10.0, 32, !dbg !911
-  br i1 %42, label %43, label %56, !dbg !911
-
-; <label>:43                                      ; preds = %41
-  %44 = call i32 @llvm.nvvm.read.ptx.sreg.tid.x(), !dbg !914
-  %45 = zext i32 %44 to i64, !dbg !914
-  %46 = getelementptr inbounds [33 x float] addrspace(3)* getelementptr inbounds ([32 x [33 x float]] addrspace(3)* @"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_$__cuda_local_var_66930_35_non_const_tile", i32 0, i32 0), i64 %45, !dbg !914
-  %47 = getelementptr inbounds [33 x float] addrspace(3)* %46, i32 0, i32 0, !dbg !914
-  %48 = call i32 @llvm.nvvm.read.ptx.sreg.tid.y(), !dbg !914
-  %49 = add i32 %48, %j10.0, !dbg !914
-  %50 = zext i32 %49 to i64, !dbg !914
-  %51 = getelementptr inbounds float addrspace(3)* %47, i64 %50, !dbg !914
-  %52 = load float addrspace(3)* %51, align 4, !dbg !914
-  %53 = add nsw i32 %40, %j10.0, !dbg !914
-  %call13 = call float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %B, i32 %53, i32 %34), !dbg !917
-  store float %52, float* %call13, align 4, !dbg !917
-  br label %54, !dbg !918
-
-; <label>:54                                      ; preds = %43
-  %55 = add nsw i32 %j10.0, 8, !dbg !918
-  br label %41, !dbg !918
-
-; <label>:56                                      ; preds = %41
-  ret void, !dbg !919
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !920
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !924
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !925
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !926
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !927
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !928
-  ret float* %call4, !dbg !928
-}
-
-; Function Attrs: noinline
-define float* @_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii(%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 %idx1, i32 %idx2) #2 {
-  %call = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !929
-  %call1 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %idx1, i32 %idx2), !dbg !933
-  %call2 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !934
-  %call3 = call i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 0, i32 %call, i32 %call1), !dbg !935
-  %1 = getelementptr inbounds %struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE* %this, i32 0, i32 0, !dbg !936
-  %call4 = call float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %1, i32 0, i32 %call2, i32 %call3), !dbg !937
-  ret float* %call4, !dbg !937
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %idx1.addr = alloca i32, align 4
-  %idx2.addr = alloca i32, align 4
-  %idx3.addr = alloca i32, align 4
-  store i32 %idx1, i32* %idx1.addr, align 4
-  store i32 %idx2, i32* %idx2.addr, align 4
-  store i32 %idx3, i32* %idx3.addr, align 4
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 1, !dbg !938
-  %2 = bitcast i32* %1 to %struct.__SO__N9cudarrays11dim_managerIfLj2EEE*, !dbg !938
-  %3 = bitcast %struct.__SO__N9cudarrays11dim_managerIfLj2EEE* %2 to %struct._ZN9cudarrays11dim_managerIfLj2EEE*, !dbg !938
-  %4 = getelementptr inbounds %struct._ZN9cudarrays11dim_managerIfLj2EEE* %3, i32 0, i32 9, !dbg !938
-  %5 = getelementptr inbounds [1 x i32]* %4, i32 0, i32 0, !dbg !938
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %5, i32* %idx1.addr, i32* %idx2.addr, i32* %idx3.addr), !dbg !942
-  %6 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 23, !dbg !943
-  %7 = load float** %6, align 8, !dbg !943
-  %8 = getelementptr inbounds float* %7, i32 %call, !dbg !943
-  ret float* %8, !dbg !943
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %idx1, i32* %idx2, i32* %idx3) #3 {
-  br i1 false, label %1, label %7, !dbg !944
-
-; <label>:1                                       ; preds = %0
-  %2 = getelementptr inbounds i32* %offs, i64 4294967295, !dbg !949
-  %3 = load i32* %2, align 4, !dbg !949
-  %4 = load i32* %idx1, align 4, !dbg !949
-  %5 = mul i32 %3, %4, !dbg !949
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %idx1, i32* %idx2, i32* %idx3), !dbg !951
-  %6 = add i32 %5, %call, !dbg !951
-  br label %16, !dbg !951
-
-; <label>:7                                       ; preds = %0
-  br i1 true, label %8, label %15, !dbg !952
-
-; <label>:8                                       ; preds = %7
-  %9 = getelementptr inbounds i32* %offs, i64 0, !dbg !955
-  %10 = load i32* %9, align 4, !dbg !955
-  %11 = load i32* %idx2, align 4, !dbg !955
-  %12 = mul i32 %10, %11, !dbg !955
-  %13 = load i32* %idx3, align 4, !dbg !955
-  %14 = add i32 %12, %13, !dbg !955
-  br label %16, !dbg !955
-
-; <label>:15                                      ; preds = %7
-  br label %16, !dbg !957
-
-; <label>:16                                      ; preds = %15, %8, %1
-  %retval.0 = phi i32 [ %6, %1 ], [ %14, %8 ], [ -1, %15 ]
-  ret i32 %retval.0, !dbg !957
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii(i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  br i1 false, label %1, label %2, !dbg !959
-
-; <label>:1                                       ; preds = %0
-  br label %5, !dbg !964
-
-; <label>:2                                       ; preds = %0
-  br i1 true, label %3, label %4, !dbg !966
-
-; <label>:3                                       ; preds = %2
-  br label %5, !dbg !969
-
-; <label>:4                                       ; preds = %2
-  br label %5, !dbg !971
-
-; <label>:5                                       ; preds = %4, %3, %1
-  %retval.0 = phi i32 [ %idx1, %1 ], [ %idx2, %3 ], [ %idx3, %4 ]
-  ret i32 %retval.0, !dbg !971
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii(i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  br i1 false, label %1, label %2, !dbg !973
-
-; <label>:1                                       ; preds = %0
-  br label %5, !dbg !978
-
-; <label>:2                                       ; preds = %0
-  br i1 false, label %3, label %4, !dbg !980
-
-; <label>:3                                       ; preds = %2
-  br label %5, !dbg !983
-
-; <label>:4                                       ; preds = %2
-  br label %5, !dbg !985
-
-; <label>:5                                       ; preds = %4, %3, %1
-  %retval.0 = phi i32 [ %idx1, %1 ], [ %idx2, %3 ], [ %idx3, %4 ]
-  ret i32 %retval.0, !dbg !985
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %idx1.addr = alloca i32, align 4
-  %idx2.addr = alloca i32, align 4
-  %idx3.addr = alloca i32, align 4
-  store i32 %idx1, i32* %idx1.addr, align 4
-  store i32 %idx2, i32* %idx2.addr, align 4
-  store i32 %idx3, i32* %idx3.addr, align 4
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 9, !dbg !987
-  %2 = getelementptr inbounds %struct._ZN9cudarrays11dim_managerIfLj2EEE* %1, i32 0, i32 9, !dbg !987
-  %3 = getelementptr inbounds [1 x i32]* %2, i32 0, i32 0, !dbg !987
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %3, i32* %idx1.addr, i32* %idx2.addr, i32* %idx3.addr), !dbg !991
-  %4 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 10, !dbg !992
-  %5 = load float** %4, align 8, !dbg !992
-  %6 = getelementptr inbounds float* %5, i32 %call, !dbg !993
-  ret float* %6, !dbg !993
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %idx1.addr = alloca i32, align 4
-  %idx2.addr = alloca i32, align 4
-  %idx3.addr = alloca i32, align 4
-  store i32 %idx1, i32* %idx1.addr, align 4
-  store i32 %idx2, i32* %idx2.addr, align 4
-  store i32 %idx3, i32* %idx3.addr, align 4
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 9, !dbg !994
-  %2 = getelementptr inbounds %struct._ZN9cudarrays11dim_managerIfLj2EEE* %1, i32 0, i32 9, !dbg !994
-  %3 = getelementptr inbounds [1 x i32]* %2, i32 0, i32 0, !dbg !994
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %3, i32* %idx1.addr, i32* %idx2.addr, i32* %idx3.addr), !dbg !998
-  %4 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 10, !dbg !999
-  %5 = load float** %4, align 8, !dbg !999
-  %6 = getelementptr inbounds float* %5, i32 %call, !dbg !1000
-  ret float* %6, !dbg !1000
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %idx1.addr = alloca i32, align 4
-  %idx2.addr = alloca i32, align 4
-  %idx3.addr = alloca i32, align 4
-  store i32 %idx1, i32* %idx1.addr, align 4
-  store i32 %idx2, i32* %idx2.addr, align 4
-  store i32 %idx3, i32* %idx3.addr, align 4
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 9, !dbg !1001
-  %2 = getelementptr inbounds %struct._ZN9cudarrays11dim_managerIfLj2EEE* %1, i32 0, i32 9, !dbg !1001
-  %3 = getelementptr inbounds [1 x i32]* %2, i32 0, i32 0, !dbg !1001
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %3, i32* %idx1.addr, i32* %idx2.addr, i32* %idx3.addr), !dbg !1005
-  %4 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 10, !dbg !1006
-  %5 = load float** %4, align 8, !dbg !1006
-  %6 = getelementptr inbounds float* %5, i32 %call, !dbg !1007
-  ret float* %6, !dbg !1007
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %idx1.addr = alloca i32, align 4
-  %idx2.addr = alloca i32, align 4
-  %idx3.addr = alloca i32, align 4
-  store i32 %idx1, i32* %idx1.addr, align 4
-  store i32 %idx2, i32* %idx2.addr, align 4
-  store i32 %idx3, i32* %idx3.addr, align 4
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 9, !dbg !1008
-  %2 = getelementptr inbounds %struct._ZN9cudarrays11dim_managerIfLj2EEE* %1, i32 0, i32 9, !dbg !1008
-  %3 = getelementptr inbounds [1 x i32]* %2, i32 0, i32 0, !dbg !1008
-  %call = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %3, i32* %idx1.addr, i32* %idx2.addr, i32* %idx3.addr), !dbg !1012
-  %4 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 10, !dbg !1013
-  %5 = load float** %4, align 8, !dbg !1013
-  %6 = getelementptr inbounds float* %5, i32 %call, !dbg !1014
-  ret float* %6, !dbg !1014
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 12, !dbg !1015
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1015
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 11, !dbg !1015
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1015
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 13, !dbg !1015
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1015
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1019
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 10, !dbg !1020
-  %8 = load float** %7, align 8, !dbg !1020
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1020
-  ret float* %9, !dbg !1020
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %elems, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T20 = alloca i32, align 4
-  %__T21 = alloca i32, align 4
-  %__T22 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1021
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1025
-  store i32 %call, i32* %__T20, align 4, !dbg !1025
-  %2 = getelementptr inbounds i32* %elems, i64 0, !dbg !1025
-  %call1 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T21, align 4
-  %3 = getelementptr inbounds i32* %elems, i64 1
-  %call2 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T22, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T20, i32* %__T21, i32* %__T22), !dbg !1026
-  %4 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1027
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1027
-  %call4 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1028
-  %6 = getelementptr inbounds i32* %elems, i64 0, !dbg !1028
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1028
-  %call5 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1029
-  %8 = add nsw i32 %call4, %call5, !dbg !1029
-  %9 = getelementptr inbounds i32* %elems, i64 1, !dbg !1029
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1029
-  %call6 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1030
-  ret i32 %12, !dbg !1030
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1031
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1036
-  %3 = urem i32 %idx, %2, !dbg !1036
-  br label %5, !dbg !1036
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1038
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1038
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1040
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1045
-  %3 = udiv i32 %idx, %2, !dbg !1045
-  %4 = load i32* %elemsChunk, align 4, !dbg !1045
-  %5 = mul i32 %3, %4, !dbg !1045
-  br label %7, !dbg !1045
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1047
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1047
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 12, !dbg !1049
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1049
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 11, !dbg !1049
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1049
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 13, !dbg !1049
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1049
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1053
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 10, !dbg !1054
-  %8 = load float** %7, align 8, !dbg !1054
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1054
-  ret float* %9, !dbg !1054
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %elems, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T26 = alloca i32, align 4
-  %__T27 = alloca i32, align 4
-  %__T28 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1055
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1059
-  store i32 %call, i32* %__T26, align 4, !dbg !1059
-  %2 = getelementptr inbounds i32* %elems, i64 0, !dbg !1059
-  %call1 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T27, align 4
-  %3 = getelementptr inbounds i32* %elems, i64 1
-  %call2 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T28, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T26, i32* %__T27, i32* %__T28), !dbg !1060
-  %4 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1061
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1061
-  %call4 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1062
-  %6 = getelementptr inbounds i32* %elems, i64 0, !dbg !1062
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1062
-  %call5 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1063
-  %8 = add nsw i32 %call4, %call5, !dbg !1063
-  %9 = getelementptr inbounds i32* %elems, i64 1, !dbg !1063
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1063
-  %call6 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1064
-  ret i32 %12, !dbg !1064
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 12, !dbg !1065
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1065
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 11, !dbg !1065
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1065
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 13, !dbg !1065
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1065
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1069
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 10, !dbg !1070
-  %8 = load float** %7, align 8, !dbg !1070
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1070
-  ret float* %9, !dbg !1070
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %elems, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T23 = alloca i32, align 4
-  %__T24 = alloca i32, align 4
-  %__T25 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1071
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1075
-  store i32 %call, i32* %__T23, align 4, !dbg !1075
-  %2 = getelementptr inbounds i32* %elems, i64 0, !dbg !1075
-  %call1 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T24, align 4
-  %3 = getelementptr inbounds i32* %elems, i64 1
-  %call2 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T25, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T23, i32* %__T24, i32* %__T25), !dbg !1076
-  %4 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1077
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1077
-  %call4 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1078
-  %6 = getelementptr inbounds i32* %elems, i64 0, !dbg !1078
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1078
-  %call5 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1079
-  %8 = add nsw i32 %call4, %call5, !dbg !1079
-  %9 = getelementptr inbounds i32* %elems, i64 1, !dbg !1079
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1079
-  %call6 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1080
-  ret i32 %12, !dbg !1080
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1081
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1086
-  %3 = urem i32 %idx, %2, !dbg !1086
-  br label %5, !dbg !1086
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1088
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1088
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1090
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1095
-  %3 = urem i32 %idx, %2, !dbg !1095
-  br label %5, !dbg !1095
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1097
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1097
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1099
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1104
-  %3 = udiv i32 %idx, %2, !dbg !1104
-  %4 = load i32* %elemsChunk, align 4, !dbg !1104
-  %5 = mul i32 %3, %4, !dbg !1104
-  br label %7, !dbg !1104
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1106
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1106
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1108
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1113
-  %3 = udiv i32 %idx, %2, !dbg !1113
-  %4 = load i32* %elemsChunk, align 4, !dbg !1113
-  %5 = mul i32 %3, %4, !dbg !1113
-  br label %7, !dbg !1113
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1115
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1115
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1117
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1122
-  %3 = urem i32 %idx, %2, !dbg !1122
-  br label %5, !dbg !1122
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1124
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1124
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1126
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1131
-  %3 = urem i32 %idx, %2, !dbg !1131
-  br label %5, !dbg !1131
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1133
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1133
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1135
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1140
-  %3 = udiv i32 %idx, %2, !dbg !1140
-  %4 = load i32* %elemsChunk, align 4, !dbg !1140
-  %5 = mul i32 %3, %4, !dbg !1140
-  br label %7, !dbg !1140
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1142
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1142
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1144
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1149
-  %3 = udiv i32 %idx, %2, !dbg !1149
-  %4 = load i32* %elemsChunk, align 4, !dbg !1149
-  %5 = mul i32 %3, %4, !dbg !1149
-  br label %7, !dbg !1149
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1151
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1151
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 12, !dbg !1153
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1153
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 11, !dbg !1153
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1153
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 13, !dbg !1153
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1153
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1157
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 10, !dbg !1158
-  %8 = load float** %7, align 8, !dbg !1158
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1158
-  ret float* %9, !dbg !1158
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %elems, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T29 = alloca i32, align 4
-  %__T210 = alloca i32, align 4
-  %__T211 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1159
-  %call = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1163
-  store i32 %call, i32* %__T29, align 4, !dbg !1163
-  %2 = getelementptr inbounds i32* %elems, i64 0, !dbg !1163
-  %call1 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T210, align 4
-  %3 = getelementptr inbounds i32* %elems, i64 1
-  %call2 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T211, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T29, i32* %__T210, i32* %__T211), !dbg !1164
-  %4 = getelementptr inbounds i32* %elems, i64 4294967295, !dbg !1165
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1165
-  %call4 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1166
-  %6 = getelementptr inbounds i32* %elems, i64 0, !dbg !1166
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1166
-  %call5 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1167
-  %8 = add nsw i32 %call4, %call5, !dbg !1167
-  %9 = getelementptr inbounds i32* %elems, i64 1, !dbg !1167
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1167
-  %call6 = call i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1168
-  ret i32 %12, !dbg !1168
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1169
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1174
-  %3 = urem i32 %idx, %2, !dbg !1174
-  br label %5, !dbg !1174
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1176
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1176
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %elemsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1178
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1183
-  %3 = urem i32 %idx, %2, !dbg !1183
-  br label %5, !dbg !1183
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1185
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1185
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1187
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1192
-  %3 = udiv i32 %idx, %2, !dbg !1192
-  %4 = load i32* %elemsChunk, align 4, !dbg !1192
-  %5 = mul i32 %3, %4, !dbg !1192
-  br label %7, !dbg !1192
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1194
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1194
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %elemsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1196
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %elemsDim, align 4, !dbg !1201
-  %3 = udiv i32 %idx, %2, !dbg !1201
-  %4 = load i32* %elemsChunk, align 4, !dbg !1201
-  %5 = mul i32 %3, %4, !dbg !1201
-  br label %7, !dbg !1201
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1203
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1203
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 12, !dbg !1205
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1205
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 11, !dbg !1205
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1205
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 13, !dbg !1205
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1205
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1209
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 10, !dbg !1210
-  %8 = load float** %7, align 8, !dbg !1210
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1210
-  ret float* %9, !dbg !1210
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T212 = alloca i32, align 4
-  %__T213 = alloca i32, align 4
-  %__T214 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1211
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1215
-  store i32 %call, i32* %__T212, align 4, !dbg !1215
-  %2 = getelementptr inbounds i32* %procs, i64 0, !dbg !1215
-  %call1 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T213, align 4
-  %3 = getelementptr inbounds i32* %procs, i64 1
-  %call2 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T214, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T212, i32* %__T213, i32* %__T214), !dbg !1216
-  %4 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1217
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1217
-  %call4 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1218
-  %6 = getelementptr inbounds i32* %procs, i64 0, !dbg !1218
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1218
-  %call5 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1219
-  %8 = add nsw i32 %call4, %call5, !dbg !1219
-  %9 = getelementptr inbounds i32* %procs, i64 1, !dbg !1219
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1219
-  %call6 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1220
-  ret i32 %12, !dbg !1220
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1221
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1226
-  %3 = udiv i32 %idx, %2, !dbg !1226
-  br label %5, !dbg !1226
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1228
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1228
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1230
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1235
-  %3 = urem i32 %idx, %2, !dbg !1235
-  %4 = load i32* %elemsChunk, align 4, !dbg !1235
-  %5 = mul i32 %3, %4, !dbg !1235
-  br label %7, !dbg !1235
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1237
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1237
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 12, !dbg !1239
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1239
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 11, !dbg !1239
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1239
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 13, !dbg !1239
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1239
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1243
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 10, !dbg !1244
-  %8 = load float** %7, align 8, !dbg !1244
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1244
-  ret float* %9, !dbg !1244
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T218 = alloca i32, align 4
-  %__T219 = alloca i32, align 4
-  %__T220 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1245
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1249
-  store i32 %call, i32* %__T218, align 4, !dbg !1249
-  %2 = getelementptr inbounds i32* %procs, i64 0, !dbg !1249
-  %call1 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T219, align 4
-  %3 = getelementptr inbounds i32* %procs, i64 1
-  %call2 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T220, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T218, i32* %__T219, i32* %__T220), !dbg !1250
-  %4 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1251
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1251
-  %call4 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1252
-  %6 = getelementptr inbounds i32* %procs, i64 0, !dbg !1252
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1252
-  %call5 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1253
-  %8 = add nsw i32 %call4, %call5, !dbg !1253
-  %9 = getelementptr inbounds i32* %procs, i64 1, !dbg !1253
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1253
-  %call6 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1254
-  ret i32 %12, !dbg !1254
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 12, !dbg !1255
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1255
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 11, !dbg !1255
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1255
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 13, !dbg !1255
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1255
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1259
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 10, !dbg !1260
-  %8 = load float** %7, align 8, !dbg !1260
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1260
-  ret float* %9, !dbg !1260
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T215 = alloca i32, align 4
-  %__T216 = alloca i32, align 4
-  %__T217 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1261
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1265
-  store i32 %call, i32* %__T215, align 4, !dbg !1265
-  %2 = getelementptr inbounds i32* %procs, i64 0, !dbg !1265
-  %call1 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T216, align 4
-  %3 = getelementptr inbounds i32* %procs, i64 1
-  %call2 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T217, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T215, i32* %__T216, i32* %__T217), !dbg !1266
-  %4 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1267
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1267
-  %call4 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1268
-  %6 = getelementptr inbounds i32* %procs, i64 0, !dbg !1268
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1268
-  %call5 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1269
-  %8 = add nsw i32 %call4, %call5, !dbg !1269
-  %9 = getelementptr inbounds i32* %procs, i64 1, !dbg !1269
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1269
-  %call6 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1270
-  ret i32 %12, !dbg !1270
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1271
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1276
-  %3 = udiv i32 %idx, %2, !dbg !1276
-  br label %5, !dbg !1276
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1278
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1278
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1280
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1285
-  %3 = udiv i32 %idx, %2, !dbg !1285
-  br label %5, !dbg !1285
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1287
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1287
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1289
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1294
-  %3 = urem i32 %idx, %2, !dbg !1294
-  %4 = load i32* %elemsChunk, align 4, !dbg !1294
-  %5 = mul i32 %3, %4, !dbg !1294
-  br label %7, !dbg !1294
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1296
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1296
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1298
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1303
-  %3 = urem i32 %idx, %2, !dbg !1303
-  %4 = load i32* %elemsChunk, align 4, !dbg !1303
-  %5 = mul i32 %3, %4, !dbg !1303
-  br label %7, !dbg !1303
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1305
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1305
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1307
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1312
-  %3 = udiv i32 %idx, %2, !dbg !1312
-  br label %5, !dbg !1312
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1314
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1314
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1316
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1321
-  %3 = udiv i32 %idx, %2, !dbg !1321
-  br label %5, !dbg !1321
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1323
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1323
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1325
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1330
-  %3 = urem i32 %idx, %2, !dbg !1330
-  %4 = load i32* %elemsChunk, align 4, !dbg !1330
-  %5 = mul i32 %3, %4, !dbg !1330
-  br label %7, !dbg !1330
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1332
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1332
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1334
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1339
-  %3 = urem i32 %idx, %2, !dbg !1339
-  %4 = load i32* %elemsChunk, align 4, !dbg !1339
-  %5 = mul i32 %3, %4, !dbg !1339
-  br label %7, !dbg !1339
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1341
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1341
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 12, !dbg !1343
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1343
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 11, !dbg !1343
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1343
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 13, !dbg !1343
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1343
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii(i32* %2, i32* %4, i32* %6, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1347
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 10, !dbg !1348
-  %8 = load float** %7, align 8, !dbg !1348
-  %9 = getelementptr inbounds float* %8, i32 %call, !dbg !1348
-  ret float* %9, !dbg !1348
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii(i32* %offs, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T221 = alloca i32, align 4
-  %__T222 = alloca i32, align 4
-  %__T223 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1349
-  %call = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1353
-  store i32 %call, i32* %__T221, align 4, !dbg !1353
-  %2 = getelementptr inbounds i32* %procs, i64 0, !dbg !1353
-  %call1 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T222, align 4
-  %3 = getelementptr inbounds i32* %procs, i64 1
-  %call2 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T223, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T221, i32* %__T222, i32* %__T223), !dbg !1354
-  %4 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1355
-  %5 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1355
-  %call4 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1356
-  %6 = getelementptr inbounds i32* %procs, i64 0, !dbg !1356
-  %7 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1356
-  %call5 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7), !dbg !1357
-  %8 = add nsw i32 %call4, %call5, !dbg !1357
-  %9 = getelementptr inbounds i32* %procs, i64 1, !dbg !1357
-  %10 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1357
-  %call6 = call i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx3, i32* %9, i32* %10)
-  %11 = add nsw i32 %8, %call6
-  %12 = add nsw i32 %call3, %11, !dbg !1358
-  ret i32 %12, !dbg !1358
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1359
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1364
-  %3 = udiv i32 %idx, %2, !dbg !1364
-  br label %5, !dbg !1364
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1366
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1366
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj(i32 %idx, i32* %procsDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1368
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1373
-  %3 = udiv i32 %idx, %2, !dbg !1373
-  br label %5, !dbg !1373
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1375
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1375
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %6, !dbg !1377
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1382
-  %3 = urem i32 %idx, %2, !dbg !1382
-  %4 = load i32* %elemsChunk, align 4, !dbg !1382
-  %5 = mul i32 %3, %4, !dbg !1382
-  br label %7, !dbg !1382
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1384
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1384
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_(i32 %idx, i32* %procsDim, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %6, !dbg !1386
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %procsDim, align 4, !dbg !1391
-  %3 = urem i32 %idx, %2, !dbg !1391
-  %4 = load i32* %elemsChunk, align 4, !dbg !1391
-  %5 = mul i32 %3, %4, !dbg !1391
-  br label %7, !dbg !1391
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1393
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1393
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 14, !dbg !1395
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1395
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 12, !dbg !1395
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1395
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 13, !dbg !1395
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1395
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 11, !dbg !1395
-  %8 = getelementptr inbounds [2 x i32]* %7, i32 0, i32 0, !dbg !1395
-  %9 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 15, !dbg !1395
-  %10 = getelementptr inbounds [2 x i32]* %9, i32 0, i32 0, !dbg !1395
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %2, i32* %4, i32* %6, i32* %8, i32* %10, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1399
-  %11 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEEE* %this, i32 0, i32 10, !dbg !1400
-  %12 = load float** %11, align 8, !dbg !1400
-  %13 = getelementptr inbounds float* %12, i32 %call, !dbg !1400
-  ret float* %13, !dbg !1400
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %offs, i32* %blocks, i32* %blockDims, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T224 = alloca i32, align 4
-  %__T225 = alloca i32, align 4
-  %__T226 = alloca i32, align 4
-  %__T227 = alloca i32, align 4
-  %__T228 = alloca i32, align 4
-  %__T229 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1401
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1405
-  store i32 %call, i32* %__T224, align 4, !dbg !1405
-  %2 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1405
-  %call1 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T225, align 4
-  %3 = getelementptr inbounds i32* %blockDims, i64 1
-  %call2 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T226, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T224, i32* %__T225, i32* %__T226), !dbg !1406
-  %4 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1407
-  %5 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1407
-  %call4 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1408
-  store i32 %call4, i32* %__T227, align 4, !dbg !1408
-  %6 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1408
-  %7 = getelementptr inbounds i32* %procs, i64 0, !dbg !1408
-  %call5 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7)
-  store i32 %call5, i32* %__T228, align 4
-  %8 = getelementptr inbounds i32* %blockDims, i64 1
-  %9 = getelementptr inbounds i32* %procs, i64 1
-  %call6 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx3, i32* %8, i32* %9)
-  store i32 %call6, i32* %__T229, align 4
-  %call7 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T227, i32* %__T228, i32* %__T229), !dbg !1409
-  %10 = getelementptr inbounds i32* %blocks, i64 4294967295, !dbg !1410
-  %11 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1410
-  %12 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1410
-  %call8 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx1, i32* %10, i32* %11, i32* %12), !dbg !1411
-  %13 = getelementptr inbounds i32* %blocks, i64 0, !dbg !1411
-  %14 = getelementptr inbounds i32* %procs, i64 0, !dbg !1411
-  %15 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1411
-  %call9 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx2, i32* %13, i32* %14, i32* %15), !dbg !1412
-  %16 = add nsw i32 %call8, %call9, !dbg !1412
-  %17 = getelementptr inbounds i32* %blocks, i64 1, !dbg !1412
-  %18 = getelementptr inbounds i32* %procs, i64 1, !dbg !1412
-  %19 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1412
-  %call10 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx3, i32* %17, i32* %18, i32* %19)
-  %20 = add nsw i32 %16, %call10
-  %21 = add nsw i32 %call3, %call7, !dbg !1413
-  %22 = add nsw i32 %21, %20, !dbg !1413
-  ret i32 %22, !dbg !1413
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1414
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1419
-  %3 = urem i32 %idx, %2, !dbg !1419
-  br label %5, !dbg !1419
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1421
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1421
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 false, label %1, label %6, !dbg !1423
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1428
-  %3 = load i32* %procs, align 4, !dbg !1428
-  %4 = mul i32 %2, %3, !dbg !1428
-  %5 = udiv i32 %idx, %4, !dbg !1428
-  br label %7, !dbg !1428
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1430
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1430
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %8, !dbg !1432
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1437
-  %3 = udiv i32 %idx, %2, !dbg !1437
-  %4 = load i32* %procs, align 4, !dbg !1437
-  %5 = urem i32 %3, %4, !dbg !1437
-  %6 = load i32* %elemsChunk, align 4, !dbg !1437
-  %7 = mul i32 %5, %6, !dbg !1437
-  br label %9, !dbg !1437
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1439
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1439
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 14, !dbg !1441
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1441
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 12, !dbg !1441
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1441
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 13, !dbg !1441
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1441
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 11, !dbg !1441
-  %8 = getelementptr inbounds [2 x i32]* %7, i32 0, i32 0, !dbg !1441
-  %9 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 15, !dbg !1441
-  %10 = getelementptr inbounds [2 x i32]* %9, i32 0, i32 0, !dbg !1441
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %2, i32* %4, i32* %6, i32* %8, i32* %10, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1445
-  %11 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEEE* %this, i32 0, i32 10, !dbg !1446
-  %12 = load float** %11, align 8, !dbg !1446
-  %13 = getelementptr inbounds float* %12, i32 %call, !dbg !1446
-  ret float* %13, !dbg !1446
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %offs, i32* %blocks, i32* %blockDims, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T236 = alloca i32, align 4
-  %__T237 = alloca i32, align 4
-  %__T238 = alloca i32, align 4
-  %__T239 = alloca i32, align 4
-  %__T240 = alloca i32, align 4
-  %__T241 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1447
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1451
-  store i32 %call, i32* %__T236, align 4, !dbg !1451
-  %2 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1451
-  %call1 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T237, align 4
-  %3 = getelementptr inbounds i32* %blockDims, i64 1
-  %call2 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T238, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T236, i32* %__T237, i32* %__T238), !dbg !1452
-  %4 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1453
-  %5 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1453
-  %call4 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1454
-  store i32 %call4, i32* %__T239, align 4, !dbg !1454
-  %6 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1454
-  %7 = getelementptr inbounds i32* %procs, i64 0, !dbg !1454
-  %call5 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7)
-  store i32 %call5, i32* %__T240, align 4
-  %8 = getelementptr inbounds i32* %blockDims, i64 1
-  %9 = getelementptr inbounds i32* %procs, i64 1
-  %call6 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx3, i32* %8, i32* %9)
-  store i32 %call6, i32* %__T241, align 4
-  %call7 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T239, i32* %__T240, i32* %__T241), !dbg !1455
-  %10 = getelementptr inbounds i32* %blocks, i64 4294967295, !dbg !1456
-  %11 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1456
-  %12 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1456
-  %call8 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx1, i32* %10, i32* %11, i32* %12), !dbg !1457
-  %13 = getelementptr inbounds i32* %blocks, i64 0, !dbg !1457
-  %14 = getelementptr inbounds i32* %procs, i64 0, !dbg !1457
-  %15 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1457
-  %call9 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx2, i32* %13, i32* %14, i32* %15), !dbg !1458
-  %16 = add nsw i32 %call8, %call9, !dbg !1458
-  %17 = getelementptr inbounds i32* %blocks, i64 1, !dbg !1458
-  %18 = getelementptr inbounds i32* %procs, i64 1, !dbg !1458
-  %19 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1458
-  %call10 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx3, i32* %17, i32* %18, i32* %19)
-  %20 = add nsw i32 %16, %call10
-  %21 = add nsw i32 %call3, %call7, !dbg !1459
-  %22 = add nsw i32 %21, %20, !dbg !1459
-  ret i32 %22, !dbg !1459
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 14, !dbg !1460
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1460
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 12, !dbg !1460
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1460
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 13, !dbg !1460
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1460
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 11, !dbg !1460
-  %8 = getelementptr inbounds [2 x i32]* %7, i32 0, i32 0, !dbg !1460
-  %9 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 15, !dbg !1460
-  %10 = getelementptr inbounds [2 x i32]* %9, i32 0, i32 0, !dbg !1460
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %2, i32* %4, i32* %6, i32* %8, i32* %10, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1464
-  %11 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEEE* %this, i32 0, i32 10, !dbg !1465
-  %12 = load float** %11, align 8, !dbg !1465
-  %13 = getelementptr inbounds float* %12, i32 %call, !dbg !1465
-  ret float* %13, !dbg !1465
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %offs, i32* %blocks, i32* %blockDims, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T230 = alloca i32, align 4
-  %__T231 = alloca i32, align 4
-  %__T232 = alloca i32, align 4
-  %__T233 = alloca i32, align 4
-  %__T234 = alloca i32, align 4
-  %__T235 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1466
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1470
-  store i32 %call, i32* %__T230, align 4, !dbg !1470
-  %2 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1470
-  %call1 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T231, align 4
-  %3 = getelementptr inbounds i32* %blockDims, i64 1
-  %call2 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T232, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T230, i32* %__T231, i32* %__T232), !dbg !1471
-  %4 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1472
-  %5 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1472
-  %call4 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1473
-  store i32 %call4, i32* %__T233, align 4, !dbg !1473
-  %6 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1473
-  %7 = getelementptr inbounds i32* %procs, i64 0, !dbg !1473
-  %call5 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7)
-  store i32 %call5, i32* %__T234, align 4
-  %8 = getelementptr inbounds i32* %blockDims, i64 1
-  %9 = getelementptr inbounds i32* %procs, i64 1
-  %call6 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx3, i32* %8, i32* %9)
-  store i32 %call6, i32* %__T235, align 4
-  %call7 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T233, i32* %__T234, i32* %__T235), !dbg !1474
-  %10 = getelementptr inbounds i32* %blocks, i64 4294967295, !dbg !1475
-  %11 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1475
-  %12 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1475
-  %call8 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx1, i32* %10, i32* %11, i32* %12), !dbg !1476
-  %13 = getelementptr inbounds i32* %blocks, i64 0, !dbg !1476
-  %14 = getelementptr inbounds i32* %procs, i64 0, !dbg !1476
-  %15 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1476
-  %call9 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx2, i32* %13, i32* %14, i32* %15), !dbg !1477
-  %16 = add nsw i32 %call8, %call9, !dbg !1477
-  %17 = getelementptr inbounds i32* %blocks, i64 1, !dbg !1477
-  %18 = getelementptr inbounds i32* %procs, i64 1, !dbg !1477
-  %19 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1477
-  %call10 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx3, i32* %17, i32* %18, i32* %19)
-  %20 = add nsw i32 %16, %call10
-  %21 = add nsw i32 %call3, %call7, !dbg !1478
-  %22 = add nsw i32 %21, %20, !dbg !1478
-  ret i32 %22, !dbg !1478
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1479
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1484
-  %3 = urem i32 %idx, %2, !dbg !1484
-  br label %5, !dbg !1484
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1486
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1486
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1488
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1493
-  %3 = urem i32 %idx, %2, !dbg !1493
-  br label %5, !dbg !1493
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1495
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1495
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 false, label %1, label %6, !dbg !1497
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1502
-  %3 = load i32* %procs, align 4, !dbg !1502
-  %4 = mul i32 %2, %3, !dbg !1502
-  %5 = udiv i32 %idx, %4, !dbg !1502
-  br label %7, !dbg !1502
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1504
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1504
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 true, label %1, label %6, !dbg !1506
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1511
-  %3 = load i32* %procs, align 4, !dbg !1511
-  %4 = mul i32 %2, %3, !dbg !1511
-  %5 = udiv i32 %idx, %4, !dbg !1511
-  br label %7, !dbg !1511
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1513
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1513
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %8, !dbg !1515
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1520
-  %3 = udiv i32 %idx, %2, !dbg !1520
-  %4 = load i32* %procs, align 4, !dbg !1520
-  %5 = urem i32 %3, %4, !dbg !1520
-  %6 = load i32* %elemsChunk, align 4, !dbg !1520
-  %7 = mul i32 %5, %6, !dbg !1520
-  br label %9, !dbg !1520
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1522
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1522
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %8, !dbg !1524
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1529
-  %3 = udiv i32 %idx, %2, !dbg !1529
-  %4 = load i32* %procs, align 4, !dbg !1529
-  %5 = urem i32 %3, %4, !dbg !1529
-  %6 = load i32* %elemsChunk, align 4, !dbg !1529
-  %7 = mul i32 %5, %6, !dbg !1529
-  br label %9, !dbg !1529
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1531
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1531
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1533
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1538
-  %3 = urem i32 %idx, %2, !dbg !1538
-  br label %5, !dbg !1538
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1540
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1540
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1542
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1547
-  %3 = urem i32 %idx, %2, !dbg !1547
-  br label %5, !dbg !1547
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1549
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1549
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 false, label %1, label %6, !dbg !1551
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1556
-  %3 = load i32* %procs, align 4, !dbg !1556
-  %4 = mul i32 %2, %3, !dbg !1556
-  %5 = udiv i32 %idx, %4, !dbg !1556
-  br label %7, !dbg !1556
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1558
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1558
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 true, label %1, label %6, !dbg !1560
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1565
-  %3 = load i32* %procs, align 4, !dbg !1565
-  %4 = mul i32 %2, %3, !dbg !1565
-  %5 = udiv i32 %idx, %4, !dbg !1565
-  br label %7, !dbg !1565
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1567
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1567
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %8, !dbg !1569
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1574
-  %3 = udiv i32 %idx, %2, !dbg !1574
-  %4 = load i32* %procs, align 4, !dbg !1574
-  %5 = urem i32 %3, %4, !dbg !1574
-  %6 = load i32* %elemsChunk, align 4, !dbg !1574
-  %7 = mul i32 %5, %6, !dbg !1574
-  br label %9, !dbg !1574
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1576
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1576
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %8, !dbg !1578
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1583
-  %3 = udiv i32 %idx, %2, !dbg !1583
-  %4 = load i32* %procs, align 4, !dbg !1583
-  %5 = urem i32 %3, %4, !dbg !1583
-  %6 = load i32* %elemsChunk, align 4, !dbg !1583
-  %7 = mul i32 %5, %6, !dbg !1583
-  br label %9, !dbg !1583
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1585
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1585
-}
-
-; Function Attrs: inlinehint
-define float* @_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii(%struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %1 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 14, !dbg !1587
-  %2 = getelementptr inbounds [1 x i32]* %1, i32 0, i32 0, !dbg !1587
-  %3 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 12, !dbg !1587
-  %4 = getelementptr inbounds [2 x i32]* %3, i32 0, i32 0, !dbg !1587
-  %5 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 13, !dbg !1587
-  %6 = getelementptr inbounds [2 x i32]* %5, i32 0, i32 0, !dbg !1587
-  %7 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 11, !dbg !1587
-  %8 = getelementptr inbounds [2 x i32]* %7, i32 0, i32 0, !dbg !1587
-  %9 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 15, !dbg !1587
-  %10 = getelementptr inbounds [2 x i32]* %9, i32 0, i32 0, !dbg !1587
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %2, i32* %4, i32* %6, i32* %8, i32* %10, i32 %idx1, i32 %idx2, i32 %idx3), !dbg !1591
-  %11 = getelementptr inbounds %struct._ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEEE* %this, i32 0, i32 10, !dbg !1592
-  %12 = load float** %11, align 8, !dbg !1592
-  %13 = getelementptr inbounds float* %12, i32 %call, !dbg !1592
-  ret float* %13, !dbg !1592
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii(i32* %offs, i32* %blocks, i32* %blockDims, i32* %procs, i32* %offsProcs, i32 %idx1, i32 %idx2, i32 %idx3) #3 {
-  %__T242 = alloca i32, align 4
-  %__T243 = alloca i32, align 4
-  %__T244 = alloca i32, align 4
-  %__T245 = alloca i32, align 4
-  %__T246 = alloca i32, align 4
-  %__T247 = alloca i32, align 4
-  %1 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1593
-  %call = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx1, i32* %1), !dbg !1597
-  store i32 %call, i32* %__T242, align 4, !dbg !1597
-  %2 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1597
-  %call1 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx2, i32* %2)
-  store i32 %call1, i32* %__T243, align 4
-  %3 = getelementptr inbounds i32* %blockDims, i64 1
-  %call2 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx3, i32* %3)
-  store i32 %call2, i32* %__T244, align 4
-  %call3 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T242, i32* %__T243, i32* %__T244), !dbg !1598
-  %4 = getelementptr inbounds i32* %blockDims, i64 4294967295, !dbg !1599
-  %5 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1599
-  %call4 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx1, i32* %4, i32* %5), !dbg !1600
-  store i32 %call4, i32* %__T245, align 4, !dbg !1600
-  %6 = getelementptr inbounds i32* %blockDims, i64 0, !dbg !1600
-  %7 = getelementptr inbounds i32* %procs, i64 0, !dbg !1600
-  %call5 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx2, i32* %6, i32* %7)
-  store i32 %call5, i32* %__T246, align 4
-  %8 = getelementptr inbounds i32* %blockDims, i64 1
-  %9 = getelementptr inbounds i32* %procs, i64 1
-  %call6 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx3, i32* %8, i32* %9)
-  store i32 %call6, i32* %__T247, align 4
-  %call7 = call i32 @_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_(i32* %offs, i32* %__T245, i32* %__T246, i32* %__T247), !dbg !1601
-  %10 = getelementptr inbounds i32* %blocks, i64 4294967295, !dbg !1602
-  %11 = getelementptr inbounds i32* %procs, i64 4294967295, !dbg !1602
-  %12 = getelementptr inbounds i32* %offsProcs, i64 4294967295, !dbg !1602
-  %call8 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx1, i32* %10, i32* %11, i32* %12), !dbg !1603
-  %13 = getelementptr inbounds i32* %blocks, i64 0, !dbg !1603
-  %14 = getelementptr inbounds i32* %procs, i64 0, !dbg !1603
-  %15 = getelementptr inbounds i32* %offsProcs, i64 0, !dbg !1603
-  %call9 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx2, i32* %13, i32* %14, i32* %15), !dbg !1604
-  %16 = add nsw i32 %call8, %call9, !dbg !1604
-  %17 = getelementptr inbounds i32* %blocks, i64 1, !dbg !1604
-  %18 = getelementptr inbounds i32* %procs, i64 1, !dbg !1604
-  %19 = getelementptr inbounds i32* %offsProcs, i64 1, !dbg !1604
-  %call10 = call i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx3, i32* %17, i32* %18, i32* %19)
-  %20 = add nsw i32 %16, %call10
-  %21 = add nsw i32 %call3, %call7, !dbg !1605
-  %22 = add nsw i32 %21, %20, !dbg !1605
-  ret i32 %22, !dbg !1605
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb0EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 false, label %1, label %4, !dbg !1606
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1611
-  %3 = urem i32 %idx, %2, !dbg !1611
-  br label %5, !dbg !1611
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1613
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1613
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj(i32 %idx, i32* %blockDim) #3 {
-  br i1 true, label %1, label %4, !dbg !1615
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1620
-  %3 = urem i32 %idx, %2, !dbg !1620
-  br label %5, !dbg !1620
-
-; <label>:4                                       ; preds = %0
-  br label %5, !dbg !1622
-
-; <label>:5                                       ; preds = %4, %1
-  %retval.0 = phi i32 [ %3, %1 ], [ %idx, %4 ]
-  ret i32 %retval.0, !dbg !1622
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 false, label %1, label %6, !dbg !1624
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1629
-  %3 = load i32* %procs, align 4, !dbg !1629
-  %4 = mul i32 %2, %3, !dbg !1629
-  %5 = udiv i32 %idx, %4, !dbg !1629
-  br label %7, !dbg !1629
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1631
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1631
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_(i32 %idx, i32* %blockDim, i32* %procs) #3 {
-  br i1 true, label %1, label %6, !dbg !1633
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1638
-  %3 = load i32* %procs, align 4, !dbg !1638
-  %4 = mul i32 %2, %3, !dbg !1638
-  %5 = udiv i32 %idx, %4, !dbg !1638
-  br label %7, !dbg !1638
-
-; <label>:6                                       ; preds = %0
-  br label %7, !dbg !1640
-
-; <label>:7                                       ; preds = %6, %1
-  %retval.0 = phi i32 [ %5, %1 ], [ 0, %6 ]
-  ret i32 %retval.0, !dbg !1640
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 false, label %1, label %8, !dbg !1642
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1647
-  %3 = udiv i32 %idx, %2, !dbg !1647
-  %4 = load i32* %procs, align 4, !dbg !1647
-  %5 = urem i32 %3, %4, !dbg !1647
-  %6 = load i32* %elemsChunk, align 4, !dbg !1647
-  %7 = mul i32 %5, %6, !dbg !1647
-  br label %9, !dbg !1647
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1649
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1649
-}
-
-; Function Attrs: inlinehint
-define i32 @_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_(i32 %idx, i32* %blockDim, i32* %procs, i32* %elemsChunk) #3 {
-  br i1 true, label %1, label %8, !dbg !1651
-
-; <label>:1                                       ; preds = %0
-  %2 = load i32* %blockDim, align 4, !dbg !1656
-  %3 = udiv i32 %idx, %2, !dbg !1656
-  %4 = load i32* %procs, align 4, !dbg !1656
-  %5 = urem i32 %3, %4, !dbg !1656
-  %6 = load i32* %elemsChunk, align 4, !dbg !1656
-  %7 = mul i32 %5, %6, !dbg !1656
-  br label %9, !dbg !1656
-
-; <label>:8                                       ; preds = %0
-  br label %9, !dbg !1658
-
-; <label>:9                                       ; preds = %8, %1
-  %retval.0 = phi i32 [ %7, %1 ], [ 0, %8 ]
-  ret i32 %retval.0, !dbg !1658
-}
-
 attributes #0 = { nounwind readnone }
 attributes #1 = { nounwind }
-attributes #2 = { noinline }
-attributes #3 = { inlinehint }
 
-!llvm.dbg.cu = !{!0}
-!nvvm.annotations = !{!148, !149, !150, !151, !152, !153, !154, !155, !156, !157, !158, !159, !160, !161, !162, !163, !164, !165}
+!nvvm.annotations = !{!0}
 
-!0 = metadata !{i32 720913, i32 0, i32 4, metadata !"transpose.cu", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", metadata !"lgenfe: EDG 4.1", i1 true, i1 false, metadata !"", i32 0, metadata !1, metadata !1, metadata !3, metadata !1}
-!1 = metadata !{metadata !2}
-!2 = metadata !{i32 0}
-!3 = metadata !{metadata !4}
-!4 = metadata !{metadata !5, metadata !9, metadata !10, metadata !11, metadata !12, metadata !13, metadata !14, metadata !15, metadata !16, metadata !17, metadata !18, metadata !19, metadata !20, metadata !21, metadata !22, metadata !23, metadata !24, metadata !25, metadata !26, metadata !28, metadata !30, metadata !31, metadata !32, metadata !33, metadata !35, metadata !37, metadata !38, metadata !39, metadata !40, metadata !41, metadata !42, metadata !43, metadata !44, metadata !45, metadata !46, metadata !47, metadata !48, metadata !50, metadata !51, metadata !52, metadata !53, metadata !54, metadata !55, metadata !56, metadata !57, metadata !58, metadata !59, metadata !60, metadata !61, metadata !62, metadata !63, metadata !64, metadata !65, metadata !66, metadata !67, metadata !68, metadata !69, metadata !70, metadata !71, metadata !72, metadata !73, metadata !74, metadata !75, metadata !76, metadata !77, metadata !78, metadata !79, metadata !81, metadata !82, metadata !83, metadata !84, metadata !85, metadata !86, metadata !87, metadata !88, metadata !89, metadata !90, metadata !91, metadata !92, metadata !93, metadata !94, metadata !95, metadata !96, metadata !97, metadata !98, metadata !99, metadata !100, metadata !101, metadata !102, metadata !103, metadata !104, metadata !105, metadata !106, metadata !107, metadata !108, metadata !109, metadata !110, metadata !112, metadata !113, metadata !114, metadata !115, metadata !116, metadata !117, metadata !118, metadata !119, metadata !120, metadata !121, metadata !122, metadata !123, metadata !124, metadata !125, metadata !126, metadata !127, metadata !128, metadata !129, metadata !130, metadata !131, metadata !132, metadata !133, metadata !134, metadata !135, metadata !136, metadata !137, metadata !138, metadata !139, metadata !140, metadata !141, metadata !142, metadata !143, metadata !144, metadata !145, metadata !146, metadata !147}
-!5 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z25transpose_kernel_originalPfPKf", metadata !"_Z25transpose_kernel_originalPfPKf", metadata !"_Z25transpose_kernel_originalPfPKf", metadata !6, i32 35, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!6 = metadata !{i32 720937, metadata !"../kernels/transpose.cuh", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!7 = metadata !{metadata !8}
-!8 = metadata !{i32 720932}
-!9 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!10 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!11 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!12 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!13 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!14 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!15 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!16 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!17 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!18 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!19 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!20 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!21 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!22 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!23 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!24 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!25 = metadata !{i32 720942, i32 0, metadata !6, metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !"_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_", metadata !6, i32 11, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!26 = metadata !{i32 720942, i32 0, metadata !27, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !27, i32 1117, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!27 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/storage.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!28 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!29 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/dynarray.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!30 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!31 = metadata !{i32 720942, i32 0, metadata !27, metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii", metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii", metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj1EEEiiii", metadata !27, i32 88, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!32 = metadata !{i32 720942, i32 0, metadata !27, metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii", metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii", metadata !"_ZN9cudarrays20storage_reorder_confILj0ELj1ELj2EE13permute_indexILj2EEEiiii", metadata !27, i32 88, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!33 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_", metadata !"_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_", metadata !"_ZN9cudarrays10linearizerIfLj2ELj1EE10access_posEPKjRKiS5_S5_", metadata !34, i32 41, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!34 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/indexing.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!35 = metadata !{i32 720942, i32 0, metadata !36, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !36, i32 572, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!36 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/dist_storage_vm.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!37 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!38 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!39 = metadata !{i32 720942, i32 0, metadata !36, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !36, i32 572, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!40 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!41 = metadata !{i32 720942, i32 0, metadata !36, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !36, i32 572, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!42 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!43 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!44 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!45 = metadata !{i32 720942, i32 0, metadata !36, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !36, i32 572, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!46 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!47 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!48 = metadata !{i32 720942, i32 0, metadata !49, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !49, i32 431, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!49 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/dist_storage_reshape-block.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!50 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!51 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!52 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 84, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!53 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!54 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!55 = metadata !{i32 720942, i32 0, metadata !49, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !49, i32 431, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!56 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!57 = metadata !{i32 720942, i32 0, metadata !49, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !49, i32 431, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!58 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!59 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 84, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!60 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!61 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!62 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!63 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!64 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 84, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!65 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!66 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!67 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!68 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!69 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!70 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!71 = metadata !{i32 720942, i32 0, metadata !49, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !49, i32 431, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!72 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!73 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!74 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 84, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!75 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!76 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 69, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!77 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!78 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays11index_blockIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 77, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!79 = metadata !{i32 720942, i32 0, metadata !80, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !80, i32 502, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!80 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/dist_storage_reshape-cyclic.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!81 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!82 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!83 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 127, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!84 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!85 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!86 = metadata !{i32 720942, i32 0, metadata !80, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !80, i32 502, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!87 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!88 = metadata !{i32 720942, i32 0, metadata !80, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !80, i32 502, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!89 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!90 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 127, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!91 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!92 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!93 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!94 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!95 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 127, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!96 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!97 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!98 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!99 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!100 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!101 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!102 = metadata !{i32 720942, i32 0, metadata !80, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !80, i32 502, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!103 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!104 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!105 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posEPKjS5_S5_iii", metadata !34, i32 127, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!106 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb0EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!107 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE9local_idxILb1EEEiiRKj", metadata !34, i32 112, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!108 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb0EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!109 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays12index_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEEE8proc_offILb1EEEiiRKjS6_", metadata !34, i32 120, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!110 = metadata !{i32 720942, i32 0, metadata !111, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEEE10access_posILj1EEERfiii", metadata !111, i32 576, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!111 = metadata !{i32 720937, metadata !"/home/jcabezas/cudarrays/install/include/cudarrays/dist_storage_reshape-block_cyclic.hpp", metadata !"/home/jcabezas/data_partitioning/benchmarks/llvm_ir", null}
-!112 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!113 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!114 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !34, i32 179, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!115 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!116 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!117 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!118 = metadata !{i32 720942, i32 0, metadata !111, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEEE10access_posILj1EEERfiii", metadata !111, i32 576, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!119 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!120 = metadata !{i32 720942, i32 0, metadata !111, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEEE10access_posILj1EEERfiii", metadata !111, i32 576, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!121 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!122 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !34, i32 179, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!123 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb0EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!124 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9local_idxILb1EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!125 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!126 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!127 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!128 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb0EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!129 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !34, i32 179, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!130 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!131 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!132 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!133 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!134 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!135 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb0ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!136 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!137 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!138 = metadata !{i32 720942, i32 0, metadata !111, metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !"_ZN9cudarrays13array_storageIfLj2ELNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEEE10access_posILj1EEERfiii", metadata !111, i32 576, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!139 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!140 = metadata !{i32 720942, i32 0, metadata !29, metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !"_ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEclEii", metadata !29, i32 135, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!141 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE10access_posEPKjS5_S5_S5_S5_iii", metadata !34, i32 179, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!142 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb0EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!143 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9local_idxILb1EEEiiRKj", metadata !34, i32 155, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!144 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb0EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!145 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE9block_idxILb1EEEiiRKjS6_", metadata !34, i32 171, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!146 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb0EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!147 = metadata !{i32 720942, i32 0, metadata !34, metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !"_ZN9cudarrays18index_block_cyclicIfLj2ELj1ENS_17storage_part_confILb0ELb1ELb1EEELj1EE8proc_offILb1EEEiiRKjS6_S6_", metadata !34, i32 163, null, i1 false, i1 true, i32 0, i32 0, i32 0, i32 0, i1 false, null, null, null, metadata !7}
-!148 = metadata !{void (float*, float*)* @_Z25transpose_kernel_originalPfPKf, metadata !"kernel", i32 1}
-!149 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE1ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE1ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!150 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!151 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!152 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_5ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!153 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE5ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE5ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!154 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!155 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!156 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_2ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!157 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE2ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE2ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!158 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!159 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!160 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_3ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!161 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE3ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE3ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!162 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!163 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb0ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb1ELb0EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!164 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb0EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb0ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb0EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEENS1_ILS2_4ENS3_ILb0ELb0ELb1EEES6_EEEvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENSA_IfLj2ELb1ELSB_0ET0_EE4dim3SG_, metadata !"kernel", i32 1}
-!165 = metadata !{void (%struct._ZN9cudarrays8dynarrayIfLj2ELb0ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct._ZN9cudarrays8dynarrayIfLj2ELb1ELNS_12storage_typeE0ENS_12storage_confILNS_12storage_implE4ENS_17storage_part_confILb0ELb1ELb1EEENS_20storage_reorder_confILj0ELj1ELj2EEEEEEE, %struct.dim3, %struct.dim3)* @_Z16transpose_kernelIN9cudarrays12storage_confILNS0_12storage_implE4ENS0_17storage_part_confILb0ELb1ELb1EEENS0_20storage_reorder_confILj0ELj1ELj2EEEEES7_EvNS0_8dynarrayIfLj2ELb0ELNS0_12storage_typeE0ET_EENS8_IfLj2ELb1ELS9_0ET0_EE4dim3SE_, metadata !"kernel", i32 1}
-!166 = metadata !{i32 40, i32 1, metadata !167, null}
-!167 = metadata !{i32 720907, metadata !168, i32 37, i32 1, metadata !6, i32 2} ; [ DW_TAG_lexical_block ] [/]
-!168 = metadata !{i32 720907, metadata !169, i32 36, i32 1, metadata !6, i32 1} ; [ DW_TAG_lexical_block ] [/]
-!169 = metadata !{i32 720907, metadata !5, i32 36, i32 16, metadata !6, i32 0} ; [ DW_TAG_lexical_block ] [/]
-!170 = metadata !{i32 41, i32 1, metadata !167, null}
-!171 = metadata !{i32 42, i32 1, metadata !167, null}
-!172 = metadata !{i32 44, i32 1, metadata !173, null}
-!173 = metadata !{i32 720907, metadata !174, i32 44, i32 1, metadata !6, i32 4} ; [ DW_TAG_lexical_block ] [/]
-!174 = metadata !{i32 720907, metadata !167, i32 42, i32 1, metadata !6, i32 3} ; [ DW_TAG_lexical_block ] [/]
-!175 = metadata !{i32 45, i32 1, metadata !176, null}
-!176 = metadata !{i32 720907, metadata !177, i32 44, i32 1, metadata !6, i32 6} ; [ DW_TAG_lexical_block ] [/]
-!177 = metadata !{i32 720907, metadata !173, i32 44, i32 1, metadata !6, i32 5} ; [ DW_TAG_lexical_block ] [/]
-!178 = metadata !{i32 44, i32 18, metadata !177, null}
-!179 = metadata !{i32 47, i32 1, metadata !167, null}
-!180 = metadata !{i32 49, i32 1, metadata !167, null}
-!181 = metadata !{i32 50, i32 1, metadata !167, null}
-!182 = metadata !{i32 52, i32 1, metadata !183, null}
-!183 = metadata !{i32 720907, metadata !184, i32 52, i32 1, metadata !6, i32 8} ; [ DW_TAG_lexical_block ] [/]
-!184 = metadata !{i32 720907, metadata !167, i32 50, i32 1, metadata !6, i32 7} ; [ DW_TAG_lexical_block ] [/]
-!185 = metadata !{i32 53, i32 1, metadata !186, null}
-!186 = metadata !{i32 720907, metadata !187, i32 52, i32 1, metadata !6, i32 10} ; [ DW_TAG_lexical_block ] [/]
-!187 = metadata !{i32 720907, metadata !183, i32 52, i32 1, metadata !6, i32 9} ; [ DW_TAG_lexical_block ] [/]
-!188 = metadata !{i32 52, i32 18, metadata !187, null}
-!189 = metadata !{i32 54, i32 2, metadata !169, null}
-!190 = metadata !{i32 13, i32 203, metadata !191, null}
-!191 = metadata !{i32 720907, metadata !9, i32 13, i32 19, metadata !6, i32 11} ; [ DW_TAG_lexical_block ] [/]
-!192 = metadata !{i32 17, i32 1, metadata !193, null}
-!193 = metadata !{i32 720907, metadata !194, i32 14, i32 1, metadata !6, i32 13} ; [ DW_TAG_lexical_block ] [/]
-!194 = metadata !{i32 720907, metadata !191, i32 13, i32 1, metadata !6, i32 12} ; [ DW_TAG_lexical_block ] [/]
-!195 = metadata !{i32 18, i32 1, metadata !193, null}
-!196 = metadata !{i32 20, i32 1, metadata !197, null}
-!197 = metadata !{i32 720907, metadata !198, i32 20, i32 1, metadata !6, i32 15} ; [ DW_TAG_lexical_block ] [/]
-!198 = metadata !{i32 720907, metadata !193, i32 18, i32 1, metadata !6, i32 14} ; [ DW_TAG_lexical_block ] [/]
-!199 = metadata !{i32 21, i32 1, metadata !200, null}
-!200 = metadata !{i32 720907, metadata !201, i32 20, i32 1, metadata !6, i32 17} ; [ DW_TAG_lexical_block ] [/]
-!201 = metadata !{i32 720907, metadata !197, i32 20, i32 1, metadata !6, i32 16} ; [ DW_TAG_lexical_block ] [/]
-!202 = metadata !{i32 21, i32 103, metadata !200, null}
-!203 = metadata !{i32 20, i32 18, metadata !201, null}
-!204 = metadata !{i32 23, i32 1, metadata !193, null}
-!205 = metadata !{i32 25, i32 1, metadata !193, null}
-!206 = metadata !{i32 26, i32 1, metadata !193, null}
-!207 = metadata !{i32 28, i32 1, metadata !208, null}
-!208 = metadata !{i32 720907, metadata !209, i32 28, i32 1, metadata !6, i32 19} ; [ DW_TAG_lexical_block ] [/]
-!209 = metadata !{i32 720907, metadata !193, i32 26, i32 1, metadata !6, i32 18} ; [ DW_TAG_lexical_block ] [/]
-!210 = metadata !{i32 29, i32 1, metadata !211, null}
-!211 = metadata !{i32 720907, metadata !212, i32 28, i32 1, metadata !6, i32 21} ; [ DW_TAG_lexical_block ] [/]
-!212 = metadata !{i32 720907, metadata !208, i32 28, i32 1, metadata !6, i32 20} ; [ DW_TAG_lexical_block ] [/]
-!213 = metadata !{i32 29, i32 4, metadata !211, null}
-!214 = metadata !{i32 28, i32 18, metadata !212, null}
-!215 = metadata !{i32 30, i32 2, metadata !191, null}
-!216 = metadata !{i32 137, i32 43, metadata !217, null}
-!217 = metadata !{i32 720907, metadata !218, i32 136, i32 1, metadata !29, i32 206} ; [ DW_TAG_lexical_block ] [/]
-!218 = metadata !{i32 720907, metadata !219, i32 135, i32 1, metadata !29, i32 205} ; [ DW_TAG_lexical_block ] [/]
-!219 = metadata !{i32 720907, metadata !30, i32 135, i32 36, metadata !29, i32 204} ; [ DW_TAG_lexical_block ] [/]
-!220 = metadata !{i32 138, i32 43, metadata !217, null}
-!221 = metadata !{i32 140, i32 43, metadata !217, null}
-!222 = metadata !{i32 141, i32 43, metadata !217, null}
-!223 = metadata !{i32 143, i32 1, metadata !217, null}
-!224 = metadata !{i32 143, i32 8, metadata !217, null}
-!225 = metadata !{i32 137, i32 43, metadata !226, null}
-!226 = metadata !{i32 720907, metadata !227, i32 136, i32 1, metadata !29, i32 203} ; [ DW_TAG_lexical_block ] [/]
-!227 = metadata !{i32 720907, metadata !228, i32 135, i32 1, metadata !29, i32 202} ; [ DW_TAG_lexical_block ] [/]
-!228 = metadata !{i32 720907, metadata !28, i32 135, i32 36, metadata !29, i32 201} ; [ DW_TAG_lexical_block ] [/]
-!229 = metadata !{i32 138, i32 43, metadata !226, null}
-!230 = metadata !{i32 140, i32 43, metadata !226, null}
-!231 = metadata !{i32 141, i32 43, metadata !226, null}
-!232 = metadata !{i32 143, i32 1, metadata !226, null}
-!233 = metadata !{i32 143, i32 8, metadata !226, null}
-!234 = metadata !{i32 13, i32 203, metadata !235, null}
-!235 = metadata !{i32 720907, metadata !10, i32 13, i32 19, metadata !6, i32 22} ; [ DW_TAG_lexical_block ] [/]
-!236 = metadata !{i32 17, i32 1, metadata !237, null}
-!237 = metadata !{i32 720907, metadata !238, i32 14, i32 1, metadata !6, i32 24} ; [ DW_TAG_lexical_block ] [/]
-!238 = metadata !{i32 720907, metadata !235, i32 13, i32 1, metadata !6, i32 23} ; [ DW_TAG_lexical_block ] [/]
-!239 = metadata !{i32 18, i32 1, metadata !237, null}
-!240 = metadata !{i32 20, i32 1, metadata !241, null}
-!241 = metadata !{i32 720907, metadata !242, i32 20, i32 1, metadata !6, i32 26} ; [ DW_TAG_lexical_block ] [/]
-!242 = metadata !{i32 720907, metadata !237, i32 18, i32 1, metadata !6, i32 25} ; [ DW_TAG_lexical_block ] [/]
-!243 = metadata !{i32 21, i32 1, metadata !244, null}
-!244 = metadata !{i32 720907, metadata !245, i32 20, i32 1, metadata !6, i32 28} ; [ DW_TAG_lexical_block ] [/]
-!245 = metadata !{i32 720907, metadata !241, i32 20, i32 1, metadata !6, i32 27} ; [ DW_TAG_lexical_block ] [/]
-!246 = metadata !{i32 21, i32 103, metadata !244, null}
-!247 = metadata !{i32 20, i32 18, metadata !245, null}
-!248 = metadata !{i32 23, i32 1, metadata !237, null}
-!249 = metadata !{i32 25, i32 1, metadata !237, null}
-!250 = metadata !{i32 26, i32 1, metadata !237, null}
-!251 = metadata !{i32 28, i32 1, metadata !252, null}
-!252 = metadata !{i32 720907, metadata !253, i32 28, i32 1, metadata !6, i32 30} ; [ DW_TAG_lexical_block ] [/]
-!253 = metadata !{i32 720907, metadata !237, i32 26, i32 1, metadata !6, i32 29} ; [ DW_TAG_lexical_block ] [/]
-!254 = metadata !{i32 29, i32 1, metadata !255, null}
-!255 = metadata !{i32 720907, metadata !256, i32 28, i32 1, metadata !6, i32 32} ; [ DW_TAG_lexical_block ] [/]
-!256 = metadata !{i32 720907, metadata !252, i32 28, i32 1, metadata !6, i32 31} ; [ DW_TAG_lexical_block ] [/]
-!257 = metadata !{i32 29, i32 4, metadata !255, null}
-!258 = metadata !{i32 28, i32 18, metadata !256, null}
-!259 = metadata !{i32 30, i32 2, metadata !235, null}
-!260 = metadata !{i32 137, i32 43, metadata !261, null}
-!261 = metadata !{i32 720907, metadata !262, i32 136, i32 1, metadata !29, i32 242} ; [ DW_TAG_lexical_block ] [/]
-!262 = metadata !{i32 720907, metadata !263, i32 135, i32 1, metadata !29, i32 241} ; [ DW_TAG_lexical_block ] [/]
-!263 = metadata !{i32 720907, metadata !38, i32 135, i32 36, metadata !29, i32 240} ; [ DW_TAG_lexical_block ] [/]
-!264 = metadata !{i32 138, i32 43, metadata !261, null}
-!265 = metadata !{i32 140, i32 43, metadata !261, null}
-!266 = metadata !{i32 141, i32 43, metadata !261, null}
-!267 = metadata !{i32 143, i32 1, metadata !261, null}
-!268 = metadata !{i32 143, i32 8, metadata !261, null}
-!269 = metadata !{i32 137, i32 43, metadata !270, null}
-!270 = metadata !{i32 720907, metadata !271, i32 136, i32 1, metadata !29, i32 239} ; [ DW_TAG_lexical_block ] [/]
-!271 = metadata !{i32 720907, metadata !272, i32 135, i32 1, metadata !29, i32 238} ; [ DW_TAG_lexical_block ] [/]
-!272 = metadata !{i32 720907, metadata !37, i32 135, i32 36, metadata !29, i32 237} ; [ DW_TAG_lexical_block ] [/]
-!273 = metadata !{i32 138, i32 43, metadata !270, null}
-!274 = metadata !{i32 140, i32 43, metadata !270, null}
-!275 = metadata !{i32 141, i32 43, metadata !270, null}
-!276 = metadata !{i32 143, i32 1, metadata !270, null}
-!277 = metadata !{i32 143, i32 8, metadata !270, null}
-!278 = metadata !{i32 13, i32 203, metadata !279, null}
-!279 = metadata !{i32 720907, metadata !11, i32 13, i32 19, metadata !6, i32 33} ; [ DW_TAG_lexical_block ] [/]
-!280 = metadata !{i32 17, i32 1, metadata !281, null}
-!281 = metadata !{i32 720907, metadata !282, i32 14, i32 1, metadata !6, i32 35} ; [ DW_TAG_lexical_block ] [/]
-!282 = metadata !{i32 720907, metadata !279, i32 13, i32 1, metadata !6, i32 34} ; [ DW_TAG_lexical_block ] [/]
-!283 = metadata !{i32 18, i32 1, metadata !281, null}
-!284 = metadata !{i32 20, i32 1, metadata !285, null}
-!285 = metadata !{i32 720907, metadata !286, i32 20, i32 1, metadata !6, i32 37} ; [ DW_TAG_lexical_block ] [/]
-!286 = metadata !{i32 720907, metadata !281, i32 18, i32 1, metadata !6, i32 36} ; [ DW_TAG_lexical_block ] [/]
-!287 = metadata !{i32 21, i32 1, metadata !288, null}
-!288 = metadata !{i32 720907, metadata !289, i32 20, i32 1, metadata !6, i32 39} ; [ DW_TAG_lexical_block ] [/]
-!289 = metadata !{i32 720907, metadata !285, i32 20, i32 1, metadata !6, i32 38} ; [ DW_TAG_lexical_block ] [/]
-!290 = metadata !{i32 21, i32 103, metadata !288, null}
-!291 = metadata !{i32 20, i32 18, metadata !289, null}
-!292 = metadata !{i32 23, i32 1, metadata !281, null}
-!293 = metadata !{i32 25, i32 1, metadata !281, null}
-!294 = metadata !{i32 26, i32 1, metadata !281, null}
-!295 = metadata !{i32 28, i32 1, metadata !296, null}
-!296 = metadata !{i32 720907, metadata !297, i32 28, i32 1, metadata !6, i32 41} ; [ DW_TAG_lexical_block ] [/]
-!297 = metadata !{i32 720907, metadata !281, i32 26, i32 1, metadata !6, i32 40} ; [ DW_TAG_lexical_block ] [/]
-!298 = metadata !{i32 29, i32 1, metadata !299, null}
-!299 = metadata !{i32 720907, metadata !300, i32 28, i32 1, metadata !6, i32 43} ; [ DW_TAG_lexical_block ] [/]
-!300 = metadata !{i32 720907, metadata !296, i32 28, i32 1, metadata !6, i32 42} ; [ DW_TAG_lexical_block ] [/]
-!301 = metadata !{i32 29, i32 4, metadata !299, null}
-!302 = metadata !{i32 28, i32 18, metadata !300, null}
-!303 = metadata !{i32 30, i32 2, metadata !279, null}
-!304 = metadata !{i32 137, i32 43, metadata !305, null}
-!305 = metadata !{i32 720907, metadata !306, i32 136, i32 1, metadata !29, i32 254} ; [ DW_TAG_lexical_block ] [/]
-!306 = metadata !{i32 720907, metadata !307, i32 135, i32 1, metadata !29, i32 253} ; [ DW_TAG_lexical_block ] [/]
-!307 = metadata !{i32 720907, metadata !42, i32 135, i32 36, metadata !29, i32 252} ; [ DW_TAG_lexical_block ] [/]
-!308 = metadata !{i32 138, i32 43, metadata !305, null}
-!309 = metadata !{i32 140, i32 43, metadata !305, null}
-!310 = metadata !{i32 141, i32 43, metadata !305, null}
-!311 = metadata !{i32 143, i32 1, metadata !305, null}
-!312 = metadata !{i32 143, i32 8, metadata !305, null}
-!313 = metadata !{i32 137, i32 43, metadata !314, null}
-!314 = metadata !{i32 720907, metadata !315, i32 136, i32 1, metadata !29, i32 248} ; [ DW_TAG_lexical_block ] [/]
-!315 = metadata !{i32 720907, metadata !316, i32 135, i32 1, metadata !29, i32 247} ; [ DW_TAG_lexical_block ] [/]
-!316 = metadata !{i32 720907, metadata !40, i32 135, i32 36, metadata !29, i32 246} ; [ DW_TAG_lexical_block ] [/]
-!317 = metadata !{i32 138, i32 43, metadata !314, null}
-!318 = metadata !{i32 140, i32 43, metadata !314, null}
-!319 = metadata !{i32 141, i32 43, metadata !314, null}
-!320 = metadata !{i32 143, i32 1, metadata !314, null}
-!321 = metadata !{i32 143, i32 8, metadata !314, null}
-!322 = metadata !{i32 13, i32 203, metadata !323, null}
-!323 = metadata !{i32 720907, metadata !12, i32 13, i32 19, metadata !6, i32 44} ; [ DW_TAG_lexical_block ] [/]
-!324 = metadata !{i32 17, i32 1, metadata !325, null}
-!325 = metadata !{i32 720907, metadata !326, i32 14, i32 1, metadata !6, i32 46} ; [ DW_TAG_lexical_block ] [/]
-!326 = metadata !{i32 720907, metadata !323, i32 13, i32 1, metadata !6, i32 45} ; [ DW_TAG_lexical_block ] [/]
-!327 = metadata !{i32 18, i32 1, metadata !325, null}
-!328 = metadata !{i32 20, i32 1, metadata !329, null}
-!329 = metadata !{i32 720907, metadata !330, i32 20, i32 1, metadata !6, i32 48} ; [ DW_TAG_lexical_block ] [/]
-!330 = metadata !{i32 720907, metadata !325, i32 18, i32 1, metadata !6, i32 47} ; [ DW_TAG_lexical_block ] [/]
-!331 = metadata !{i32 21, i32 1, metadata !332, null}
-!332 = metadata !{i32 720907, metadata !333, i32 20, i32 1, metadata !6, i32 50} ; [ DW_TAG_lexical_block ] [/]
-!333 = metadata !{i32 720907, metadata !329, i32 20, i32 1, metadata !6, i32 49} ; [ DW_TAG_lexical_block ] [/]
-!334 = metadata !{i32 21, i32 103, metadata !332, null}
-!335 = metadata !{i32 20, i32 18, metadata !333, null}
-!336 = metadata !{i32 23, i32 1, metadata !325, null}
-!337 = metadata !{i32 25, i32 1, metadata !325, null}
-!338 = metadata !{i32 26, i32 1, metadata !325, null}
-!339 = metadata !{i32 28, i32 1, metadata !340, null}
-!340 = metadata !{i32 720907, metadata !341, i32 28, i32 1, metadata !6, i32 52} ; [ DW_TAG_lexical_block ] [/]
-!341 = metadata !{i32 720907, metadata !325, i32 26, i32 1, metadata !6, i32 51} ; [ DW_TAG_lexical_block ] [/]
-!342 = metadata !{i32 29, i32 1, metadata !343, null}
-!343 = metadata !{i32 720907, metadata !344, i32 28, i32 1, metadata !6, i32 54} ; [ DW_TAG_lexical_block ] [/]
-!344 = metadata !{i32 720907, metadata !340, i32 28, i32 1, metadata !6, i32 53} ; [ DW_TAG_lexical_block ] [/]
-!345 = metadata !{i32 29, i32 4, metadata !343, null}
-!346 = metadata !{i32 28, i32 18, metadata !344, null}
-!347 = metadata !{i32 30, i32 2, metadata !323, null}
-!348 = metadata !{i32 137, i32 43, metadata !349, null}
-!349 = metadata !{i32 720907, metadata !350, i32 136, i32 1, metadata !29, i32 260} ; [ DW_TAG_lexical_block ] [/]
-!350 = metadata !{i32 720907, metadata !351, i32 135, i32 1, metadata !29, i32 259} ; [ DW_TAG_lexical_block ] [/]
-!351 = metadata !{i32 720907, metadata !44, i32 135, i32 36, metadata !29, i32 258} ; [ DW_TAG_lexical_block ] [/]
-!352 = metadata !{i32 138, i32 43, metadata !349, null}
-!353 = metadata !{i32 140, i32 43, metadata !349, null}
-!354 = metadata !{i32 141, i32 43, metadata !349, null}
-!355 = metadata !{i32 143, i32 1, metadata !349, null}
-!356 = metadata !{i32 143, i32 8, metadata !349, null}
-!357 = metadata !{i32 137, i32 43, metadata !358, null}
-!358 = metadata !{i32 720907, metadata !359, i32 136, i32 1, metadata !29, i32 257} ; [ DW_TAG_lexical_block ] [/]
-!359 = metadata !{i32 720907, metadata !360, i32 135, i32 1, metadata !29, i32 256} ; [ DW_TAG_lexical_block ] [/]
-!360 = metadata !{i32 720907, metadata !43, i32 135, i32 36, metadata !29, i32 255} ; [ DW_TAG_lexical_block ] [/]
-!361 = metadata !{i32 138, i32 43, metadata !358, null}
-!362 = metadata !{i32 140, i32 43, metadata !358, null}
-!363 = metadata !{i32 141, i32 43, metadata !358, null}
-!364 = metadata !{i32 143, i32 1, metadata !358, null}
-!365 = metadata !{i32 143, i32 8, metadata !358, null}
-!366 = metadata !{i32 13, i32 203, metadata !367, null}
-!367 = metadata !{i32 720907, metadata !13, i32 13, i32 19, metadata !6, i32 55} ; [ DW_TAG_lexical_block ] [/]
-!368 = metadata !{i32 17, i32 1, metadata !369, null}
-!369 = metadata !{i32 720907, metadata !370, i32 14, i32 1, metadata !6, i32 57} ; [ DW_TAG_lexical_block ] [/]
-!370 = metadata !{i32 720907, metadata !367, i32 13, i32 1, metadata !6, i32 56} ; [ DW_TAG_lexical_block ] [/]
-!371 = metadata !{i32 18, i32 1, metadata !369, null}
-!372 = metadata !{i32 20, i32 1, metadata !373, null}
-!373 = metadata !{i32 720907, metadata !374, i32 20, i32 1, metadata !6, i32 59} ; [ DW_TAG_lexical_block ] [/]
-!374 = metadata !{i32 720907, metadata !369, i32 18, i32 1, metadata !6, i32 58} ; [ DW_TAG_lexical_block ] [/]
-!375 = metadata !{i32 21, i32 1, metadata !376, null}
-!376 = metadata !{i32 720907, metadata !377, i32 20, i32 1, metadata !6, i32 61} ; [ DW_TAG_lexical_block ] [/]
-!377 = metadata !{i32 720907, metadata !373, i32 20, i32 1, metadata !6, i32 60} ; [ DW_TAG_lexical_block ] [/]
-!378 = metadata !{i32 21, i32 103, metadata !376, null}
-!379 = metadata !{i32 20, i32 18, metadata !377, null}
-!380 = metadata !{i32 23, i32 1, metadata !369, null}
-!381 = metadata !{i32 25, i32 1, metadata !369, null}
-!382 = metadata !{i32 26, i32 1, metadata !369, null}
-!383 = metadata !{i32 28, i32 1, metadata !384, null}
-!384 = metadata !{i32 720907, metadata !385, i32 28, i32 1, metadata !6, i32 63} ; [ DW_TAG_lexical_block ] [/]
-!385 = metadata !{i32 720907, metadata !369, i32 26, i32 1, metadata !6, i32 62} ; [ DW_TAG_lexical_block ] [/]
-!386 = metadata !{i32 29, i32 1, metadata !387, null}
-!387 = metadata !{i32 720907, metadata !388, i32 28, i32 1, metadata !6, i32 65} ; [ DW_TAG_lexical_block ] [/]
-!388 = metadata !{i32 720907, metadata !384, i32 28, i32 1, metadata !6, i32 64} ; [ DW_TAG_lexical_block ] [/]
-!389 = metadata !{i32 29, i32 4, metadata !387, null}
-!390 = metadata !{i32 28, i32 18, metadata !388, null}
-!391 = metadata !{i32 30, i32 2, metadata !367, null}
-!392 = metadata !{i32 137, i32 43, metadata !393, null}
-!393 = metadata !{i32 720907, metadata !394, i32 136, i32 1, metadata !29, i32 269} ; [ DW_TAG_lexical_block ] [/]
-!394 = metadata !{i32 720907, metadata !395, i32 135, i32 1, metadata !29, i32 268} ; [ DW_TAG_lexical_block ] [/]
-!395 = metadata !{i32 720907, metadata !47, i32 135, i32 36, metadata !29, i32 267} ; [ DW_TAG_lexical_block ] [/]
-!396 = metadata !{i32 138, i32 43, metadata !393, null}
-!397 = metadata !{i32 140, i32 43, metadata !393, null}
-!398 = metadata !{i32 141, i32 43, metadata !393, null}
-!399 = metadata !{i32 143, i32 1, metadata !393, null}
-!400 = metadata !{i32 143, i32 8, metadata !393, null}
-!401 = metadata !{i32 137, i32 43, metadata !402, null}
-!402 = metadata !{i32 720907, metadata !403, i32 136, i32 1, metadata !29, i32 266} ; [ DW_TAG_lexical_block ] [/]
-!403 = metadata !{i32 720907, metadata !404, i32 135, i32 1, metadata !29, i32 265} ; [ DW_TAG_lexical_block ] [/]
-!404 = metadata !{i32 720907, metadata !46, i32 135, i32 36, metadata !29, i32 264} ; [ DW_TAG_lexical_block ] [/]
-!405 = metadata !{i32 138, i32 43, metadata !402, null}
-!406 = metadata !{i32 140, i32 43, metadata !402, null}
-!407 = metadata !{i32 141, i32 43, metadata !402, null}
-!408 = metadata !{i32 143, i32 1, metadata !402, null}
-!409 = metadata !{i32 143, i32 8, metadata !402, null}
-!410 = metadata !{i32 13, i32 203, metadata !411, null}
-!411 = metadata !{i32 720907, metadata !14, i32 13, i32 19, metadata !6, i32 66} ; [ DW_TAG_lexical_block ] [/]
-!412 = metadata !{i32 17, i32 1, metadata !413, null}
-!413 = metadata !{i32 720907, metadata !414, i32 14, i32 1, metadata !6, i32 68} ; [ DW_TAG_lexical_block ] [/]
-!414 = metadata !{i32 720907, metadata !411, i32 13, i32 1, metadata !6, i32 67} ; [ DW_TAG_lexical_block ] [/]
-!415 = metadata !{i32 18, i32 1, metadata !413, null}
-!416 = metadata !{i32 20, i32 1, metadata !417, null}
-!417 = metadata !{i32 720907, metadata !418, i32 20, i32 1, metadata !6, i32 70} ; [ DW_TAG_lexical_block ] [/]
-!418 = metadata !{i32 720907, metadata !413, i32 18, i32 1, metadata !6, i32 69} ; [ DW_TAG_lexical_block ] [/]
-!419 = metadata !{i32 21, i32 1, metadata !420, null}
-!420 = metadata !{i32 720907, metadata !421, i32 20, i32 1, metadata !6, i32 72} ; [ DW_TAG_lexical_block ] [/]
-!421 = metadata !{i32 720907, metadata !417, i32 20, i32 1, metadata !6, i32 71} ; [ DW_TAG_lexical_block ] [/]
-!422 = metadata !{i32 21, i32 103, metadata !420, null}
-!423 = metadata !{i32 20, i32 18, metadata !421, null}
-!424 = metadata !{i32 23, i32 1, metadata !413, null}
-!425 = metadata !{i32 25, i32 1, metadata !413, null}
-!426 = metadata !{i32 26, i32 1, metadata !413, null}
-!427 = metadata !{i32 28, i32 1, metadata !428, null}
-!428 = metadata !{i32 720907, metadata !429, i32 28, i32 1, metadata !6, i32 74} ; [ DW_TAG_lexical_block ] [/]
-!429 = metadata !{i32 720907, metadata !413, i32 26, i32 1, metadata !6, i32 73} ; [ DW_TAG_lexical_block ] [/]
-!430 = metadata !{i32 29, i32 1, metadata !431, null}
-!431 = metadata !{i32 720907, metadata !432, i32 28, i32 1, metadata !6, i32 76} ; [ DW_TAG_lexical_block ] [/]
-!432 = metadata !{i32 720907, metadata !428, i32 28, i32 1, metadata !6, i32 75} ; [ DW_TAG_lexical_block ] [/]
-!433 = metadata !{i32 29, i32 4, metadata !431, null}
-!434 = metadata !{i32 28, i32 18, metadata !432, null}
-!435 = metadata !{i32 30, i32 2, metadata !411, null}
-!436 = metadata !{i32 137, i32 43, metadata !437, null}
-!437 = metadata !{i32 720907, metadata !438, i32 136, i32 1, metadata !29, i32 278} ; [ DW_TAG_lexical_block ] [/]
-!438 = metadata !{i32 720907, metadata !439, i32 135, i32 1, metadata !29, i32 277} ; [ DW_TAG_lexical_block ] [/]
-!439 = metadata !{i32 720907, metadata !51, i32 135, i32 36, metadata !29, i32 276} ; [ DW_TAG_lexical_block ] [/]
-!440 = metadata !{i32 138, i32 43, metadata !437, null}
-!441 = metadata !{i32 140, i32 43, metadata !437, null}
-!442 = metadata !{i32 141, i32 43, metadata !437, null}
-!443 = metadata !{i32 143, i32 1, metadata !437, null}
-!444 = metadata !{i32 143, i32 8, metadata !437, null}
-!445 = metadata !{i32 137, i32 43, metadata !446, null}
-!446 = metadata !{i32 720907, metadata !447, i32 136, i32 1, metadata !29, i32 275} ; [ DW_TAG_lexical_block ] [/]
-!447 = metadata !{i32 720907, metadata !448, i32 135, i32 1, metadata !29, i32 274} ; [ DW_TAG_lexical_block ] [/]
-!448 = metadata !{i32 720907, metadata !50, i32 135, i32 36, metadata !29, i32 273} ; [ DW_TAG_lexical_block ] [/]
-!449 = metadata !{i32 138, i32 43, metadata !446, null}
-!450 = metadata !{i32 140, i32 43, metadata !446, null}
-!451 = metadata !{i32 141, i32 43, metadata !446, null}
-!452 = metadata !{i32 143, i32 1, metadata !446, null}
-!453 = metadata !{i32 143, i32 8, metadata !446, null}
-!454 = metadata !{i32 13, i32 203, metadata !455, null}
-!455 = metadata !{i32 720907, metadata !15, i32 13, i32 19, metadata !6, i32 77} ; [ DW_TAG_lexical_block ] [/]
-!456 = metadata !{i32 17, i32 1, metadata !457, null}
-!457 = metadata !{i32 720907, metadata !458, i32 14, i32 1, metadata !6, i32 79} ; [ DW_TAG_lexical_block ] [/]
-!458 = metadata !{i32 720907, metadata !455, i32 13, i32 1, metadata !6, i32 78} ; [ DW_TAG_lexical_block ] [/]
-!459 = metadata !{i32 18, i32 1, metadata !457, null}
-!460 = metadata !{i32 20, i32 1, metadata !461, null}
-!461 = metadata !{i32 720907, metadata !462, i32 20, i32 1, metadata !6, i32 81} ; [ DW_TAG_lexical_block ] [/]
-!462 = metadata !{i32 720907, metadata !457, i32 18, i32 1, metadata !6, i32 80} ; [ DW_TAG_lexical_block ] [/]
-!463 = metadata !{i32 21, i32 1, metadata !464, null}
-!464 = metadata !{i32 720907, metadata !465, i32 20, i32 1, metadata !6, i32 83} ; [ DW_TAG_lexical_block ] [/]
-!465 = metadata !{i32 720907, metadata !461, i32 20, i32 1, metadata !6, i32 82} ; [ DW_TAG_lexical_block ] [/]
-!466 = metadata !{i32 21, i32 103, metadata !464, null}
-!467 = metadata !{i32 20, i32 18, metadata !465, null}
-!468 = metadata !{i32 23, i32 1, metadata !457, null}
-!469 = metadata !{i32 25, i32 1, metadata !457, null}
-!470 = metadata !{i32 26, i32 1, metadata !457, null}
-!471 = metadata !{i32 28, i32 1, metadata !472, null}
-!472 = metadata !{i32 720907, metadata !473, i32 28, i32 1, metadata !6, i32 85} ; [ DW_TAG_lexical_block ] [/]
-!473 = metadata !{i32 720907, metadata !457, i32 26, i32 1, metadata !6, i32 84} ; [ DW_TAG_lexical_block ] [/]
-!474 = metadata !{i32 29, i32 1, metadata !475, null}
-!475 = metadata !{i32 720907, metadata !476, i32 28, i32 1, metadata !6, i32 87} ; [ DW_TAG_lexical_block ] [/]
-!476 = metadata !{i32 720907, metadata !472, i32 28, i32 1, metadata !6, i32 86} ; [ DW_TAG_lexical_block ] [/]
-!477 = metadata !{i32 29, i32 4, metadata !475, null}
-!478 = metadata !{i32 28, i32 18, metadata !476, null}
-!479 = metadata !{i32 30, i32 2, metadata !455, null}
-!480 = metadata !{i32 137, i32 43, metadata !481, null}
-!481 = metadata !{i32 720907, metadata !482, i32 136, i32 1, metadata !29, i32 305} ; [ DW_TAG_lexical_block ] [/]
-!482 = metadata !{i32 720907, metadata !483, i32 135, i32 1, metadata !29, i32 304} ; [ DW_TAG_lexical_block ] [/]
-!483 = metadata !{i32 720907, metadata !58, i32 135, i32 36, metadata !29, i32 303} ; [ DW_TAG_lexical_block ] [/]
-!484 = metadata !{i32 138, i32 43, metadata !481, null}
-!485 = metadata !{i32 140, i32 43, metadata !481, null}
-!486 = metadata !{i32 141, i32 43, metadata !481, null}
-!487 = metadata !{i32 143, i32 1, metadata !481, null}
-!488 = metadata !{i32 143, i32 8, metadata !481, null}
-!489 = metadata !{i32 137, i32 43, metadata !490, null}
-!490 = metadata !{i32 720907, metadata !491, i32 136, i32 1, metadata !29, i32 299} ; [ DW_TAG_lexical_block ] [/]
-!491 = metadata !{i32 720907, metadata !492, i32 135, i32 1, metadata !29, i32 298} ; [ DW_TAG_lexical_block ] [/]
-!492 = metadata !{i32 720907, metadata !56, i32 135, i32 36, metadata !29, i32 297} ; [ DW_TAG_lexical_block ] [/]
-!493 = metadata !{i32 138, i32 43, metadata !490, null}
-!494 = metadata !{i32 140, i32 43, metadata !490, null}
-!495 = metadata !{i32 141, i32 43, metadata !490, null}
-!496 = metadata !{i32 143, i32 1, metadata !490, null}
-!497 = metadata !{i32 143, i32 8, metadata !490, null}
-!498 = metadata !{i32 13, i32 203, metadata !499, null}
-!499 = metadata !{i32 720907, metadata !16, i32 13, i32 19, metadata !6, i32 88} ; [ DW_TAG_lexical_block ] [/]
-!500 = metadata !{i32 17, i32 1, metadata !501, null}
-!501 = metadata !{i32 720907, metadata !502, i32 14, i32 1, metadata !6, i32 90} ; [ DW_TAG_lexical_block ] [/]
-!502 = metadata !{i32 720907, metadata !499, i32 13, i32 1, metadata !6, i32 89} ; [ DW_TAG_lexical_block ] [/]
-!503 = metadata !{i32 18, i32 1, metadata !501, null}
-!504 = metadata !{i32 20, i32 1, metadata !505, null}
-!505 = metadata !{i32 720907, metadata !506, i32 20, i32 1, metadata !6, i32 92} ; [ DW_TAG_lexical_block ] [/]
-!506 = metadata !{i32 720907, metadata !501, i32 18, i32 1, metadata !6, i32 91} ; [ DW_TAG_lexical_block ] [/]
-!507 = metadata !{i32 21, i32 1, metadata !508, null}
-!508 = metadata !{i32 720907, metadata !509, i32 20, i32 1, metadata !6, i32 94} ; [ DW_TAG_lexical_block ] [/]
-!509 = metadata !{i32 720907, metadata !505, i32 20, i32 1, metadata !6, i32 93} ; [ DW_TAG_lexical_block ] [/]
-!510 = metadata !{i32 21, i32 103, metadata !508, null}
-!511 = metadata !{i32 20, i32 18, metadata !509, null}
-!512 = metadata !{i32 23, i32 1, metadata !501, null}
-!513 = metadata !{i32 25, i32 1, metadata !501, null}
-!514 = metadata !{i32 26, i32 1, metadata !501, null}
-!515 = metadata !{i32 28, i32 1, metadata !516, null}
-!516 = metadata !{i32 720907, metadata !517, i32 28, i32 1, metadata !6, i32 96} ; [ DW_TAG_lexical_block ] [/]
-!517 = metadata !{i32 720907, metadata !501, i32 26, i32 1, metadata !6, i32 95} ; [ DW_TAG_lexical_block ] [/]
-!518 = metadata !{i32 29, i32 1, metadata !519, null}
-!519 = metadata !{i32 720907, metadata !520, i32 28, i32 1, metadata !6, i32 98} ; [ DW_TAG_lexical_block ] [/]
-!520 = metadata !{i32 720907, metadata !516, i32 28, i32 1, metadata !6, i32 97} ; [ DW_TAG_lexical_block ] [/]
-!521 = metadata !{i32 29, i32 4, metadata !519, null}
-!522 = metadata !{i32 28, i32 18, metadata !520, null}
-!523 = metadata !{i32 30, i32 2, metadata !499, null}
-!524 = metadata !{i32 137, i32 43, metadata !525, null}
-!525 = metadata !{i32 720907, metadata !526, i32 136, i32 1, metadata !29, i32 365} ; [ DW_TAG_lexical_block ] [/]
-!526 = metadata !{i32 720907, metadata !527, i32 135, i32 1, metadata !29, i32 364} ; [ DW_TAG_lexical_block ] [/]
-!527 = metadata !{i32 720907, metadata !70, i32 135, i32 36, metadata !29, i32 363} ; [ DW_TAG_lexical_block ] [/]
-!528 = metadata !{i32 138, i32 43, metadata !525, null}
-!529 = metadata !{i32 140, i32 43, metadata !525, null}
-!530 = metadata !{i32 141, i32 43, metadata !525, null}
-!531 = metadata !{i32 143, i32 1, metadata !525, null}
-!532 = metadata !{i32 143, i32 8, metadata !525, null}
-!533 = metadata !{i32 137, i32 43, metadata !534, null}
-!534 = metadata !{i32 720907, metadata !535, i32 136, i32 1, metadata !29, i32 362} ; [ DW_TAG_lexical_block ] [/]
-!535 = metadata !{i32 720907, metadata !536, i32 135, i32 1, metadata !29, i32 361} ; [ DW_TAG_lexical_block ] [/]
-!536 = metadata !{i32 720907, metadata !69, i32 135, i32 36, metadata !29, i32 360} ; [ DW_TAG_lexical_block ] [/]
-!537 = metadata !{i32 138, i32 43, metadata !534, null}
-!538 = metadata !{i32 140, i32 43, metadata !534, null}
-!539 = metadata !{i32 141, i32 43, metadata !534, null}
-!540 = metadata !{i32 143, i32 1, metadata !534, null}
-!541 = metadata !{i32 143, i32 8, metadata !534, null}
-!542 = metadata !{i32 13, i32 203, metadata !543, null}
-!543 = metadata !{i32 720907, metadata !17, i32 13, i32 19, metadata !6, i32 99} ; [ DW_TAG_lexical_block ] [/]
-!544 = metadata !{i32 17, i32 1, metadata !545, null}
-!545 = metadata !{i32 720907, metadata !546, i32 14, i32 1, metadata !6, i32 101} ; [ DW_TAG_lexical_block ] [/]
-!546 = metadata !{i32 720907, metadata !543, i32 13, i32 1, metadata !6, i32 100} ; [ DW_TAG_lexical_block ] [/]
-!547 = metadata !{i32 18, i32 1, metadata !545, null}
-!548 = metadata !{i32 20, i32 1, metadata !549, null}
-!549 = metadata !{i32 720907, metadata !550, i32 20, i32 1, metadata !6, i32 103} ; [ DW_TAG_lexical_block ] [/]
-!550 = metadata !{i32 720907, metadata !545, i32 18, i32 1, metadata !6, i32 102} ; [ DW_TAG_lexical_block ] [/]
-!551 = metadata !{i32 21, i32 1, metadata !552, null}
-!552 = metadata !{i32 720907, metadata !553, i32 20, i32 1, metadata !6, i32 105} ; [ DW_TAG_lexical_block ] [/]
-!553 = metadata !{i32 720907, metadata !549, i32 20, i32 1, metadata !6, i32 104} ; [ DW_TAG_lexical_block ] [/]
-!554 = metadata !{i32 21, i32 103, metadata !552, null}
-!555 = metadata !{i32 20, i32 18, metadata !553, null}
-!556 = metadata !{i32 23, i32 1, metadata !545, null}
-!557 = metadata !{i32 25, i32 1, metadata !545, null}
-!558 = metadata !{i32 26, i32 1, metadata !545, null}
-!559 = metadata !{i32 28, i32 1, metadata !560, null}
-!560 = metadata !{i32 720907, metadata !561, i32 28, i32 1, metadata !6, i32 107} ; [ DW_TAG_lexical_block ] [/]
-!561 = metadata !{i32 720907, metadata !545, i32 26, i32 1, metadata !6, i32 106} ; [ DW_TAG_lexical_block ] [/]
-!562 = metadata !{i32 29, i32 1, metadata !563, null}
-!563 = metadata !{i32 720907, metadata !564, i32 28, i32 1, metadata !6, i32 109} ; [ DW_TAG_lexical_block ] [/]
-!564 = metadata !{i32 720907, metadata !560, i32 28, i32 1, metadata !6, i32 108} ; [ DW_TAG_lexical_block ] [/]
-!565 = metadata !{i32 29, i32 4, metadata !563, null}
-!566 = metadata !{i32 28, i32 18, metadata !564, null}
-!567 = metadata !{i32 30, i32 2, metadata !543, null}
-!568 = metadata !{i32 137, i32 43, metadata !569, null}
-!569 = metadata !{i32 720907, metadata !570, i32 136, i32 1, metadata !29, i32 374} ; [ DW_TAG_lexical_block ] [/]
-!570 = metadata !{i32 720907, metadata !571, i32 135, i32 1, metadata !29, i32 373} ; [ DW_TAG_lexical_block ] [/]
-!571 = metadata !{i32 720907, metadata !73, i32 135, i32 36, metadata !29, i32 372} ; [ DW_TAG_lexical_block ] [/]
-!572 = metadata !{i32 138, i32 43, metadata !569, null}
-!573 = metadata !{i32 140, i32 43, metadata !569, null}
-!574 = metadata !{i32 141, i32 43, metadata !569, null}
-!575 = metadata !{i32 143, i32 1, metadata !569, null}
-!576 = metadata !{i32 143, i32 8, metadata !569, null}
-!577 = metadata !{i32 137, i32 43, metadata !578, null}
-!578 = metadata !{i32 720907, metadata !579, i32 136, i32 1, metadata !29, i32 371} ; [ DW_TAG_lexical_block ] [/]
-!579 = metadata !{i32 720907, metadata !580, i32 135, i32 1, metadata !29, i32 370} ; [ DW_TAG_lexical_block ] [/]
-!580 = metadata !{i32 720907, metadata !72, i32 135, i32 36, metadata !29, i32 369} ; [ DW_TAG_lexical_block ] [/]
-!581 = metadata !{i32 138, i32 43, metadata !578, null}
-!582 = metadata !{i32 140, i32 43, metadata !578, null}
-!583 = metadata !{i32 141, i32 43, metadata !578, null}
-!584 = metadata !{i32 143, i32 1, metadata !578, null}
-!585 = metadata !{i32 143, i32 8, metadata !578, null}
-!586 = metadata !{i32 13, i32 203, metadata !587, null}
-!587 = metadata !{i32 720907, metadata !18, i32 13, i32 19, metadata !6, i32 110} ; [ DW_TAG_lexical_block ] [/]
-!588 = metadata !{i32 17, i32 1, metadata !589, null}
-!589 = metadata !{i32 720907, metadata !590, i32 14, i32 1, metadata !6, i32 112} ; [ DW_TAG_lexical_block ] [/]
-!590 = metadata !{i32 720907, metadata !587, i32 13, i32 1, metadata !6, i32 111} ; [ DW_TAG_lexical_block ] [/]
-!591 = metadata !{i32 18, i32 1, metadata !589, null}
-!592 = metadata !{i32 20, i32 1, metadata !593, null}
-!593 = metadata !{i32 720907, metadata !594, i32 20, i32 1, metadata !6, i32 114} ; [ DW_TAG_lexical_block ] [/]
-!594 = metadata !{i32 720907, metadata !589, i32 18, i32 1, metadata !6, i32 113} ; [ DW_TAG_lexical_block ] [/]
-!595 = metadata !{i32 21, i32 1, metadata !596, null}
-!596 = metadata !{i32 720907, metadata !597, i32 20, i32 1, metadata !6, i32 116} ; [ DW_TAG_lexical_block ] [/]
-!597 = metadata !{i32 720907, metadata !593, i32 20, i32 1, metadata !6, i32 115} ; [ DW_TAG_lexical_block ] [/]
-!598 = metadata !{i32 21, i32 103, metadata !596, null}
-!599 = metadata !{i32 20, i32 18, metadata !597, null}
-!600 = metadata !{i32 23, i32 1, metadata !589, null}
-!601 = metadata !{i32 25, i32 1, metadata !589, null}
-!602 = metadata !{i32 26, i32 1, metadata !589, null}
-!603 = metadata !{i32 28, i32 1, metadata !604, null}
-!604 = metadata !{i32 720907, metadata !605, i32 28, i32 1, metadata !6, i32 118} ; [ DW_TAG_lexical_block ] [/]
-!605 = metadata !{i32 720907, metadata !589, i32 26, i32 1, metadata !6, i32 117} ; [ DW_TAG_lexical_block ] [/]
-!606 = metadata !{i32 29, i32 1, metadata !607, null}
-!607 = metadata !{i32 720907, metadata !608, i32 28, i32 1, metadata !6, i32 120} ; [ DW_TAG_lexical_block ] [/]
-!608 = metadata !{i32 720907, metadata !604, i32 28, i32 1, metadata !6, i32 119} ; [ DW_TAG_lexical_block ] [/]
-!609 = metadata !{i32 29, i32 4, metadata !607, null}
-!610 = metadata !{i32 28, i32 18, metadata !608, null}
-!611 = metadata !{i32 30, i32 2, metadata !587, null}
-!612 = metadata !{i32 137, i32 43, metadata !613, null}
-!613 = metadata !{i32 720907, metadata !614, i32 136, i32 1, metadata !29, i32 410} ; [ DW_TAG_lexical_block ] [/]
-!614 = metadata !{i32 720907, metadata !615, i32 135, i32 1, metadata !29, i32 409} ; [ DW_TAG_lexical_block ] [/]
-!615 = metadata !{i32 720907, metadata !82, i32 135, i32 36, metadata !29, i32 408} ; [ DW_TAG_lexical_block ] [/]
-!616 = metadata !{i32 138, i32 43, metadata !613, null}
-!617 = metadata !{i32 140, i32 43, metadata !613, null}
-!618 = metadata !{i32 141, i32 43, metadata !613, null}
-!619 = metadata !{i32 143, i32 1, metadata !613, null}
-!620 = metadata !{i32 143, i32 8, metadata !613, null}
-!621 = metadata !{i32 137, i32 43, metadata !622, null}
-!622 = metadata !{i32 720907, metadata !623, i32 136, i32 1, metadata !29, i32 407} ; [ DW_TAG_lexical_block ] [/]
-!623 = metadata !{i32 720907, metadata !624, i32 135, i32 1, metadata !29, i32 406} ; [ DW_TAG_lexical_block ] [/]
-!624 = metadata !{i32 720907, metadata !81, i32 135, i32 36, metadata !29, i32 405} ; [ DW_TAG_lexical_block ] [/]
-!625 = metadata !{i32 138, i32 43, metadata !622, null}
-!626 = metadata !{i32 140, i32 43, metadata !622, null}
-!627 = metadata !{i32 141, i32 43, metadata !622, null}
-!628 = metadata !{i32 143, i32 1, metadata !622, null}
-!629 = metadata !{i32 143, i32 8, metadata !622, null}
-!630 = metadata !{i32 13, i32 203, metadata !631, null}
-!631 = metadata !{i32 720907, metadata !19, i32 13, i32 19, metadata !6, i32 121} ; [ DW_TAG_lexical_block ] [/]
-!632 = metadata !{i32 17, i32 1, metadata !633, null}
-!633 = metadata !{i32 720907, metadata !634, i32 14, i32 1, metadata !6, i32 123} ; [ DW_TAG_lexical_block ] [/]
-!634 = metadata !{i32 720907, metadata !631, i32 13, i32 1, metadata !6, i32 122} ; [ DW_TAG_lexical_block ] [/]
-!635 = metadata !{i32 18, i32 1, metadata !633, null}
-!636 = metadata !{i32 20, i32 1, metadata !637, null}
-!637 = metadata !{i32 720907, metadata !638, i32 20, i32 1, metadata !6, i32 125} ; [ DW_TAG_lexical_block ] [/]
-!638 = metadata !{i32 720907, metadata !633, i32 18, i32 1, metadata !6, i32 124} ; [ DW_TAG_lexical_block ] [/]
-!639 = metadata !{i32 21, i32 1, metadata !640, null}
-!640 = metadata !{i32 720907, metadata !641, i32 20, i32 1, metadata !6, i32 127} ; [ DW_TAG_lexical_block ] [/]
-!641 = metadata !{i32 720907, metadata !637, i32 20, i32 1, metadata !6, i32 126} ; [ DW_TAG_lexical_block ] [/]
-!642 = metadata !{i32 21, i32 103, metadata !640, null}
-!643 = metadata !{i32 20, i32 18, metadata !641, null}
-!644 = metadata !{i32 23, i32 1, metadata !633, null}
-!645 = metadata !{i32 25, i32 1, metadata !633, null}
-!646 = metadata !{i32 26, i32 1, metadata !633, null}
-!647 = metadata !{i32 28, i32 1, metadata !648, null}
-!648 = metadata !{i32 720907, metadata !649, i32 28, i32 1, metadata !6, i32 129} ; [ DW_TAG_lexical_block ] [/]
-!649 = metadata !{i32 720907, metadata !633, i32 26, i32 1, metadata !6, i32 128} ; [ DW_TAG_lexical_block ] [/]
-!650 = metadata !{i32 29, i32 1, metadata !651, null}
-!651 = metadata !{i32 720907, metadata !652, i32 28, i32 1, metadata !6, i32 131} ; [ DW_TAG_lexical_block ] [/]
-!652 = metadata !{i32 720907, metadata !648, i32 28, i32 1, metadata !6, i32 130} ; [ DW_TAG_lexical_block ] [/]
-!653 = metadata !{i32 29, i32 4, metadata !651, null}
-!654 = metadata !{i32 28, i32 18, metadata !652, null}
-!655 = metadata !{i32 30, i32 2, metadata !631, null}
-!656 = metadata !{i32 137, i32 43, metadata !657, null}
-!657 = metadata !{i32 720907, metadata !658, i32 136, i32 1, metadata !29, i32 437} ; [ DW_TAG_lexical_block ] [/]
-!658 = metadata !{i32 720907, metadata !659, i32 135, i32 1, metadata !29, i32 436} ; [ DW_TAG_lexical_block ] [/]
-!659 = metadata !{i32 720907, metadata !89, i32 135, i32 36, metadata !29, i32 435} ; [ DW_TAG_lexical_block ] [/]
-!660 = metadata !{i32 138, i32 43, metadata !657, null}
-!661 = metadata !{i32 140, i32 43, metadata !657, null}
-!662 = metadata !{i32 141, i32 43, metadata !657, null}
-!663 = metadata !{i32 143, i32 1, metadata !657, null}
-!664 = metadata !{i32 143, i32 8, metadata !657, null}
-!665 = metadata !{i32 137, i32 43, metadata !666, null}
-!666 = metadata !{i32 720907, metadata !667, i32 136, i32 1, metadata !29, i32 431} ; [ DW_TAG_lexical_block ] [/]
-!667 = metadata !{i32 720907, metadata !668, i32 135, i32 1, metadata !29, i32 430} ; [ DW_TAG_lexical_block ] [/]
-!668 = metadata !{i32 720907, metadata !87, i32 135, i32 36, metadata !29, i32 429} ; [ DW_TAG_lexical_block ] [/]
-!669 = metadata !{i32 138, i32 43, metadata !666, null}
-!670 = metadata !{i32 140, i32 43, metadata !666, null}
-!671 = metadata !{i32 141, i32 43, metadata !666, null}
-!672 = metadata !{i32 143, i32 1, metadata !666, null}
-!673 = metadata !{i32 143, i32 8, metadata !666, null}
-!674 = metadata !{i32 13, i32 203, metadata !675, null}
-!675 = metadata !{i32 720907, metadata !20, i32 13, i32 19, metadata !6, i32 132} ; [ DW_TAG_lexical_block ] [/]
-!676 = metadata !{i32 17, i32 1, metadata !677, null}
-!677 = metadata !{i32 720907, metadata !678, i32 14, i32 1, metadata !6, i32 134} ; [ DW_TAG_lexical_block ] [/]
-!678 = metadata !{i32 720907, metadata !675, i32 13, i32 1, metadata !6, i32 133} ; [ DW_TAG_lexical_block ] [/]
-!679 = metadata !{i32 18, i32 1, metadata !677, null}
-!680 = metadata !{i32 20, i32 1, metadata !681, null}
-!681 = metadata !{i32 720907, metadata !682, i32 20, i32 1, metadata !6, i32 136} ; [ DW_TAG_lexical_block ] [/]
-!682 = metadata !{i32 720907, metadata !677, i32 18, i32 1, metadata !6, i32 135} ; [ DW_TAG_lexical_block ] [/]
-!683 = metadata !{i32 21, i32 1, metadata !684, null}
-!684 = metadata !{i32 720907, metadata !685, i32 20, i32 1, metadata !6, i32 138} ; [ DW_TAG_lexical_block ] [/]
-!685 = metadata !{i32 720907, metadata !681, i32 20, i32 1, metadata !6, i32 137} ; [ DW_TAG_lexical_block ] [/]
-!686 = metadata !{i32 21, i32 103, metadata !684, null}
-!687 = metadata !{i32 20, i32 18, metadata !685, null}
-!688 = metadata !{i32 23, i32 1, metadata !677, null}
-!689 = metadata !{i32 25, i32 1, metadata !677, null}
-!690 = metadata !{i32 26, i32 1, metadata !677, null}
-!691 = metadata !{i32 28, i32 1, metadata !692, null}
-!692 = metadata !{i32 720907, metadata !693, i32 28, i32 1, metadata !6, i32 140} ; [ DW_TAG_lexical_block ] [/]
-!693 = metadata !{i32 720907, metadata !677, i32 26, i32 1, metadata !6, i32 139} ; [ DW_TAG_lexical_block ] [/]
-!694 = metadata !{i32 29, i32 1, metadata !695, null}
-!695 = metadata !{i32 720907, metadata !696, i32 28, i32 1, metadata !6, i32 142} ; [ DW_TAG_lexical_block ] [/]
-!696 = metadata !{i32 720907, metadata !692, i32 28, i32 1, metadata !6, i32 141} ; [ DW_TAG_lexical_block ] [/]
-!697 = metadata !{i32 29, i32 4, metadata !695, null}
-!698 = metadata !{i32 28, i32 18, metadata !696, null}
-!699 = metadata !{i32 30, i32 2, metadata !675, null}
-!700 = metadata !{i32 137, i32 43, metadata !701, null}
-!701 = metadata !{i32 720907, metadata !702, i32 136, i32 1, metadata !29, i32 497} ; [ DW_TAG_lexical_block ] [/]
-!702 = metadata !{i32 720907, metadata !703, i32 135, i32 1, metadata !29, i32 496} ; [ DW_TAG_lexical_block ] [/]
-!703 = metadata !{i32 720907, metadata !101, i32 135, i32 36, metadata !29, i32 495} ; [ DW_TAG_lexical_block ] [/]
-!704 = metadata !{i32 138, i32 43, metadata !701, null}
-!705 = metadata !{i32 140, i32 43, metadata !701, null}
-!706 = metadata !{i32 141, i32 43, metadata !701, null}
-!707 = metadata !{i32 143, i32 1, metadata !701, null}
-!708 = metadata !{i32 143, i32 8, metadata !701, null}
-!709 = metadata !{i32 137, i32 43, metadata !710, null}
-!710 = metadata !{i32 720907, metadata !711, i32 136, i32 1, metadata !29, i32 494} ; [ DW_TAG_lexical_block ] [/]
-!711 = metadata !{i32 720907, metadata !712, i32 135, i32 1, metadata !29, i32 493} ; [ DW_TAG_lexical_block ] [/]
-!712 = metadata !{i32 720907, metadata !100, i32 135, i32 36, metadata !29, i32 492} ; [ DW_TAG_lexical_block ] [/]
-!713 = metadata !{i32 138, i32 43, metadata !710, null}
-!714 = metadata !{i32 140, i32 43, metadata !710, null}
-!715 = metadata !{i32 141, i32 43, metadata !710, null}
-!716 = metadata !{i32 143, i32 1, metadata !710, null}
-!717 = metadata !{i32 143, i32 8, metadata !710, null}
-!718 = metadata !{i32 13, i32 203, metadata !719, null}
-!719 = metadata !{i32 720907, metadata !21, i32 13, i32 19, metadata !6, i32 143} ; [ DW_TAG_lexical_block ] [/]
-!720 = metadata !{i32 17, i32 1, metadata !721, null}
-!721 = metadata !{i32 720907, metadata !722, i32 14, i32 1, metadata !6, i32 145} ; [ DW_TAG_lexical_block ] [/]
-!722 = metadata !{i32 720907, metadata !719, i32 13, i32 1, metadata !6, i32 144} ; [ DW_TAG_lexical_block ] [/]
-!723 = metadata !{i32 18, i32 1, metadata !721, null}
-!724 = metadata !{i32 20, i32 1, metadata !725, null}
-!725 = metadata !{i32 720907, metadata !726, i32 20, i32 1, metadata !6, i32 147} ; [ DW_TAG_lexical_block ] [/]
-!726 = metadata !{i32 720907, metadata !721, i32 18, i32 1, metadata !6, i32 146} ; [ DW_TAG_lexical_block ] [/]
-!727 = metadata !{i32 21, i32 1, metadata !728, null}
-!728 = metadata !{i32 720907, metadata !729, i32 20, i32 1, metadata !6, i32 149} ; [ DW_TAG_lexical_block ] [/]
-!729 = metadata !{i32 720907, metadata !725, i32 20, i32 1, metadata !6, i32 148} ; [ DW_TAG_lexical_block ] [/]
-!730 = metadata !{i32 21, i32 103, metadata !728, null}
-!731 = metadata !{i32 20, i32 18, metadata !729, null}
-!732 = metadata !{i32 23, i32 1, metadata !721, null}
-!733 = metadata !{i32 25, i32 1, metadata !721, null}
-!734 = metadata !{i32 26, i32 1, metadata !721, null}
-!735 = metadata !{i32 28, i32 1, metadata !736, null}
-!736 = metadata !{i32 720907, metadata !737, i32 28, i32 1, metadata !6, i32 151} ; [ DW_TAG_lexical_block ] [/]
-!737 = metadata !{i32 720907, metadata !721, i32 26, i32 1, metadata !6, i32 150} ; [ DW_TAG_lexical_block ] [/]
-!738 = metadata !{i32 29, i32 1, metadata !739, null}
-!739 = metadata !{i32 720907, metadata !740, i32 28, i32 1, metadata !6, i32 153} ; [ DW_TAG_lexical_block ] [/]
-!740 = metadata !{i32 720907, metadata !736, i32 28, i32 1, metadata !6, i32 152} ; [ DW_TAG_lexical_block ] [/]
-!741 = metadata !{i32 29, i32 4, metadata !739, null}
-!742 = metadata !{i32 28, i32 18, metadata !740, null}
-!743 = metadata !{i32 30, i32 2, metadata !719, null}
-!744 = metadata !{i32 137, i32 43, metadata !745, null}
-!745 = metadata !{i32 720907, metadata !746, i32 136, i32 1, metadata !29, i32 506} ; [ DW_TAG_lexical_block ] [/]
-!746 = metadata !{i32 720907, metadata !747, i32 135, i32 1, metadata !29, i32 505} ; [ DW_TAG_lexical_block ] [/]
-!747 = metadata !{i32 720907, metadata !104, i32 135, i32 36, metadata !29, i32 504} ; [ DW_TAG_lexical_block ] [/]
-!748 = metadata !{i32 138, i32 43, metadata !745, null}
-!749 = metadata !{i32 140, i32 43, metadata !745, null}
-!750 = metadata !{i32 141, i32 43, metadata !745, null}
-!751 = metadata !{i32 143, i32 1, metadata !745, null}
-!752 = metadata !{i32 143, i32 8, metadata !745, null}
-!753 = metadata !{i32 137, i32 43, metadata !754, null}
-!754 = metadata !{i32 720907, metadata !755, i32 136, i32 1, metadata !29, i32 503} ; [ DW_TAG_lexical_block ] [/]
-!755 = metadata !{i32 720907, metadata !756, i32 135, i32 1, metadata !29, i32 502} ; [ DW_TAG_lexical_block ] [/]
-!756 = metadata !{i32 720907, metadata !103, i32 135, i32 36, metadata !29, i32 501} ; [ DW_TAG_lexical_block ] [/]
-!757 = metadata !{i32 138, i32 43, metadata !754, null}
-!758 = metadata !{i32 140, i32 43, metadata !754, null}
-!759 = metadata !{i32 141, i32 43, metadata !754, null}
-!760 = metadata !{i32 143, i32 1, metadata !754, null}
-!761 = metadata !{i32 143, i32 8, metadata !754, null}
-!762 = metadata !{i32 13, i32 203, metadata !763, null}
-!763 = metadata !{i32 720907, metadata !22, i32 13, i32 19, metadata !6, i32 154} ; [ DW_TAG_lexical_block ] [/]
-!764 = metadata !{i32 17, i32 1, metadata !765, null}
-!765 = metadata !{i32 720907, metadata !766, i32 14, i32 1, metadata !6, i32 156} ; [ DW_TAG_lexical_block ] [/]
-!766 = metadata !{i32 720907, metadata !763, i32 13, i32 1, metadata !6, i32 155} ; [ DW_TAG_lexical_block ] [/]
-!767 = metadata !{i32 18, i32 1, metadata !765, null}
-!768 = metadata !{i32 20, i32 1, metadata !769, null}
-!769 = metadata !{i32 720907, metadata !770, i32 20, i32 1, metadata !6, i32 158} ; [ DW_TAG_lexical_block ] [/]
-!770 = metadata !{i32 720907, metadata !765, i32 18, i32 1, metadata !6, i32 157} ; [ DW_TAG_lexical_block ] [/]
-!771 = metadata !{i32 21, i32 1, metadata !772, null}
-!772 = metadata !{i32 720907, metadata !773, i32 20, i32 1, metadata !6, i32 160} ; [ DW_TAG_lexical_block ] [/]
-!773 = metadata !{i32 720907, metadata !769, i32 20, i32 1, metadata !6, i32 159} ; [ DW_TAG_lexical_block ] [/]
-!774 = metadata !{i32 21, i32 103, metadata !772, null}
-!775 = metadata !{i32 20, i32 18, metadata !773, null}
-!776 = metadata !{i32 23, i32 1, metadata !765, null}
-!777 = metadata !{i32 25, i32 1, metadata !765, null}
-!778 = metadata !{i32 26, i32 1, metadata !765, null}
-!779 = metadata !{i32 28, i32 1, metadata !780, null}
-!780 = metadata !{i32 720907, metadata !781, i32 28, i32 1, metadata !6, i32 162} ; [ DW_TAG_lexical_block ] [/]
-!781 = metadata !{i32 720907, metadata !765, i32 26, i32 1, metadata !6, i32 161} ; [ DW_TAG_lexical_block ] [/]
-!782 = metadata !{i32 29, i32 1, metadata !783, null}
-!783 = metadata !{i32 720907, metadata !784, i32 28, i32 1, metadata !6, i32 164} ; [ DW_TAG_lexical_block ] [/]
-!784 = metadata !{i32 720907, metadata !780, i32 28, i32 1, metadata !6, i32 163} ; [ DW_TAG_lexical_block ] [/]
-!785 = metadata !{i32 29, i32 4, metadata !783, null}
-!786 = metadata !{i32 28, i32 18, metadata !784, null}
-!787 = metadata !{i32 30, i32 2, metadata !763, null}
-!788 = metadata !{i32 137, i32 43, metadata !789, null}
-!789 = metadata !{i32 720907, metadata !790, i32 136, i32 1, metadata !29, i32 542} ; [ DW_TAG_lexical_block ] [/]
-!790 = metadata !{i32 720907, metadata !791, i32 135, i32 1, metadata !29, i32 541} ; [ DW_TAG_lexical_block ] [/]
-!791 = metadata !{i32 720907, metadata !113, i32 135, i32 36, metadata !29, i32 540} ; [ DW_TAG_lexical_block ] [/]
-!792 = metadata !{i32 138, i32 43, metadata !789, null}
-!793 = metadata !{i32 140, i32 43, metadata !789, null}
-!794 = metadata !{i32 141, i32 43, metadata !789, null}
-!795 = metadata !{i32 143, i32 1, metadata !789, null}
-!796 = metadata !{i32 143, i32 8, metadata !789, null}
-!797 = metadata !{i32 137, i32 43, metadata !798, null}
-!798 = metadata !{i32 720907, metadata !799, i32 136, i32 1, metadata !29, i32 539} ; [ DW_TAG_lexical_block ] [/]
-!799 = metadata !{i32 720907, metadata !800, i32 135, i32 1, metadata !29, i32 538} ; [ DW_TAG_lexical_block ] [/]
-!800 = metadata !{i32 720907, metadata !112, i32 135, i32 36, metadata !29, i32 537} ; [ DW_TAG_lexical_block ] [/]
-!801 = metadata !{i32 138, i32 43, metadata !798, null}
-!802 = metadata !{i32 140, i32 43, metadata !798, null}
-!803 = metadata !{i32 141, i32 43, metadata !798, null}
-!804 = metadata !{i32 143, i32 1, metadata !798, null}
-!805 = metadata !{i32 143, i32 8, metadata !798, null}
-!806 = metadata !{i32 13, i32 203, metadata !807, null}
-!807 = metadata !{i32 720907, metadata !23, i32 13, i32 19, metadata !6, i32 165} ; [ DW_TAG_lexical_block ] [/]
-!808 = metadata !{i32 17, i32 1, metadata !809, null}
-!809 = metadata !{i32 720907, metadata !810, i32 14, i32 1, metadata !6, i32 167} ; [ DW_TAG_lexical_block ] [/]
-!810 = metadata !{i32 720907, metadata !807, i32 13, i32 1, metadata !6, i32 166} ; [ DW_TAG_lexical_block ] [/]
-!811 = metadata !{i32 18, i32 1, metadata !809, null}
-!812 = metadata !{i32 20, i32 1, metadata !813, null}
-!813 = metadata !{i32 720907, metadata !814, i32 20, i32 1, metadata !6, i32 169} ; [ DW_TAG_lexical_block ] [/]
-!814 = metadata !{i32 720907, metadata !809, i32 18, i32 1, metadata !6, i32 168} ; [ DW_TAG_lexical_block ] [/]
-!815 = metadata !{i32 21, i32 1, metadata !816, null}
-!816 = metadata !{i32 720907, metadata !817, i32 20, i32 1, metadata !6, i32 171} ; [ DW_TAG_lexical_block ] [/]
-!817 = metadata !{i32 720907, metadata !813, i32 20, i32 1, metadata !6, i32 170} ; [ DW_TAG_lexical_block ] [/]
-!818 = metadata !{i32 21, i32 103, metadata !816, null}
-!819 = metadata !{i32 20, i32 18, metadata !817, null}
-!820 = metadata !{i32 23, i32 1, metadata !809, null}
-!821 = metadata !{i32 25, i32 1, metadata !809, null}
-!822 = metadata !{i32 26, i32 1, metadata !809, null}
-!823 = metadata !{i32 28, i32 1, metadata !824, null}
-!824 = metadata !{i32 720907, metadata !825, i32 28, i32 1, metadata !6, i32 173} ; [ DW_TAG_lexical_block ] [/]
-!825 = metadata !{i32 720907, metadata !809, i32 26, i32 1, metadata !6, i32 172} ; [ DW_TAG_lexical_block ] [/]
-!826 = metadata !{i32 29, i32 1, metadata !827, null}
-!827 = metadata !{i32 720907, metadata !828, i32 28, i32 1, metadata !6, i32 175} ; [ DW_TAG_lexical_block ] [/]
-!828 = metadata !{i32 720907, metadata !824, i32 28, i32 1, metadata !6, i32 174} ; [ DW_TAG_lexical_block ] [/]
-!829 = metadata !{i32 29, i32 4, metadata !827, null}
-!830 = metadata !{i32 28, i32 18, metadata !828, null}
-!831 = metadata !{i32 30, i32 2, metadata !807, null}
-!832 = metadata !{i32 137, i32 43, metadata !833, null}
-!833 = metadata !{i32 720907, metadata !834, i32 136, i32 1, metadata !29, i32 575} ; [ DW_TAG_lexical_block ] [/]
-!834 = metadata !{i32 720907, metadata !835, i32 135, i32 1, metadata !29, i32 574} ; [ DW_TAG_lexical_block ] [/]
-!835 = metadata !{i32 720907, metadata !121, i32 135, i32 36, metadata !29, i32 573} ; [ DW_TAG_lexical_block ] [/]
-!836 = metadata !{i32 138, i32 43, metadata !833, null}
-!837 = metadata !{i32 140, i32 43, metadata !833, null}
-!838 = metadata !{i32 141, i32 43, metadata !833, null}
-!839 = metadata !{i32 143, i32 1, metadata !833, null}
-!840 = metadata !{i32 143, i32 8, metadata !833, null}
-!841 = metadata !{i32 137, i32 43, metadata !842, null}
-!842 = metadata !{i32 720907, metadata !843, i32 136, i32 1, metadata !29, i32 569} ; [ DW_TAG_lexical_block ] [/]
-!843 = metadata !{i32 720907, metadata !844, i32 135, i32 1, metadata !29, i32 568} ; [ DW_TAG_lexical_block ] [/]
-!844 = metadata !{i32 720907, metadata !119, i32 135, i32 36, metadata !29, i32 567} ; [ DW_TAG_lexical_block ] [/]
-!845 = metadata !{i32 138, i32 43, metadata !842, null}
-!846 = metadata !{i32 140, i32 43, metadata !842, null}
-!847 = metadata !{i32 141, i32 43, metadata !842, null}
-!848 = metadata !{i32 143, i32 1, metadata !842, null}
-!849 = metadata !{i32 143, i32 8, metadata !842, null}
-!850 = metadata !{i32 13, i32 203, metadata !851, null}
-!851 = metadata !{i32 720907, metadata !24, i32 13, i32 19, metadata !6, i32 176} ; [ DW_TAG_lexical_block ] [/]
-!852 = metadata !{i32 17, i32 1, metadata !853, null}
-!853 = metadata !{i32 720907, metadata !854, i32 14, i32 1, metadata !6, i32 178} ; [ DW_TAG_lexical_block ] [/]
-!854 = metadata !{i32 720907, metadata !851, i32 13, i32 1, metadata !6, i32 177} ; [ DW_TAG_lexical_block ] [/]
-!855 = metadata !{i32 18, i32 1, metadata !853, null}
-!856 = metadata !{i32 20, i32 1, metadata !857, null}
-!857 = metadata !{i32 720907, metadata !858, i32 20, i32 1, metadata !6, i32 180} ; [ DW_TAG_lexical_block ] [/]
-!858 = metadata !{i32 720907, metadata !853, i32 18, i32 1, metadata !6, i32 179} ; [ DW_TAG_lexical_block ] [/]
-!859 = metadata !{i32 21, i32 1, metadata !860, null}
-!860 = metadata !{i32 720907, metadata !861, i32 20, i32 1, metadata !6, i32 182} ; [ DW_TAG_lexical_block ] [/]
-!861 = metadata !{i32 720907, metadata !857, i32 20, i32 1, metadata !6, i32 181} ; [ DW_TAG_lexical_block ] [/]
-!862 = metadata !{i32 21, i32 103, metadata !860, null}
-!863 = metadata !{i32 20, i32 18, metadata !861, null}
-!864 = metadata !{i32 23, i32 1, metadata !853, null}
-!865 = metadata !{i32 25, i32 1, metadata !853, null}
-!866 = metadata !{i32 26, i32 1, metadata !853, null}
-!867 = metadata !{i32 28, i32 1, metadata !868, null}
-!868 = metadata !{i32 720907, metadata !869, i32 28, i32 1, metadata !6, i32 184} ; [ DW_TAG_lexical_block ] [/]
-!869 = metadata !{i32 720907, metadata !853, i32 26, i32 1, metadata !6, i32 183} ; [ DW_TAG_lexical_block ] [/]
-!870 = metadata !{i32 29, i32 1, metadata !871, null}
-!871 = metadata !{i32 720907, metadata !872, i32 28, i32 1, metadata !6, i32 186} ; [ DW_TAG_lexical_block ] [/]
-!872 = metadata !{i32 720907, metadata !868, i32 28, i32 1, metadata !6, i32 185} ; [ DW_TAG_lexical_block ] [/]
-!873 = metadata !{i32 29, i32 4, metadata !871, null}
-!874 = metadata !{i32 28, i32 18, metadata !872, null}
-!875 = metadata !{i32 30, i32 2, metadata !851, null}
-!876 = metadata !{i32 137, i32 43, metadata !877, null}
-!877 = metadata !{i32 720907, metadata !878, i32 136, i32 1, metadata !29, i32 659} ; [ DW_TAG_lexical_block ] [/]
-!878 = metadata !{i32 720907, metadata !879, i32 135, i32 1, metadata !29, i32 658} ; [ DW_TAG_lexical_block ] [/]
-!879 = metadata !{i32 720907, metadata !137, i32 135, i32 36, metadata !29, i32 657} ; [ DW_TAG_lexical_block ] [/]
-!880 = metadata !{i32 138, i32 43, metadata !877, null}
-!881 = metadata !{i32 140, i32 43, metadata !877, null}
-!882 = metadata !{i32 141, i32 43, metadata !877, null}
-!883 = metadata !{i32 143, i32 1, metadata !877, null}
-!884 = metadata !{i32 143, i32 8, metadata !877, null}
-!885 = metadata !{i32 137, i32 43, metadata !886, null}
-!886 = metadata !{i32 720907, metadata !887, i32 136, i32 1, metadata !29, i32 656} ; [ DW_TAG_lexical_block ] [/]
-!887 = metadata !{i32 720907, metadata !888, i32 135, i32 1, metadata !29, i32 655} ; [ DW_TAG_lexical_block ] [/]
-!888 = metadata !{i32 720907, metadata !136, i32 135, i32 36, metadata !29, i32 654} ; [ DW_TAG_lexical_block ] [/]
-!889 = metadata !{i32 138, i32 43, metadata !886, null}
-!890 = metadata !{i32 140, i32 43, metadata !886, null}
-!891 = metadata !{i32 141, i32 43, metadata !886, null}
-!892 = metadata !{i32 143, i32 1, metadata !886, null}
-!893 = metadata !{i32 143, i32 8, metadata !886, null}
-!894 = metadata !{i32 13, i32 203, metadata !895, null}
-!895 = metadata !{i32 720907, metadata !25, i32 13, i32 19, metadata !6, i32 187} ; [ DW_TAG_lexical_block ] [/]
-!896 = metadata !{i32 17, i32 1, metadata !897, null}
-!897 = metadata !{i32 720907, metadata !898, i32 14, i32 1, metadata !6, i32 189} ; [ DW_TAG_lexical_block ] [/]
-!898 = metadata !{i32 720907, metadata !895, i32 13, i32 1, metadata !6, i32 188} ; [ DW_TAG_lexical_block ] [/]
-!899 = metadata !{i32 18, i32 1, metadata !897, null}
-!900 = metadata !{i32 20, i32 1, metadata !901, null}
-!901 = metadata !{i32 720907, metadata !902, i32 20, i32 1, metadata !6, i32 191} ; [ DW_TAG_lexical_block ] [/]
-!902 = metadata !{i32 720907, metadata !897, i32 18, i32 1, metadata !6, i32 190} ; [ DW_TAG_lexical_block ] [/]
-!903 = metadata !{i32 21, i32 1, metadata !904, null}
-!904 = metadata !{i32 720907, metadata !905, i32 20, i32 1, metadata !6, i32 193} ; [ DW_TAG_lexical_block ] [/]
-!905 = metadata !{i32 720907, metadata !901, i32 20, i32 1, metadata !6, i32 192} ; [ DW_TAG_lexical_block ] [/]
-!906 = metadata !{i32 21, i32 103, metadata !904, null}
-!907 = metadata !{i32 20, i32 18, metadata !905, null}
-!908 = metadata !{i32 23, i32 1, metadata !897, null}
-!909 = metadata !{i32 25, i32 1, metadata !897, null}
-!910 = metadata !{i32 26, i32 1, metadata !897, null}
-!911 = metadata !{i32 28, i32 1, metadata !912, null}
-!912 = metadata !{i32 720907, metadata !913, i32 28, i32 1, metadata !6, i32 195} ; [ DW_TAG_lexical_block ] [/]
-!913 = metadata !{i32 720907, metadata !897, i32 26, i32 1, metadata !6, i32 194} ; [ DW_TAG_lexical_block ] [/]
-!914 = metadata !{i32 29, i32 1, metadata !915, null}
-!915 = metadata !{i32 720907, metadata !916, i32 28, i32 1, metadata !6, i32 197} ; [ DW_TAG_lexical_block ] [/]
-!916 = metadata !{i32 720907, metadata !912, i32 28, i32 1, metadata !6, i32 196} ; [ DW_TAG_lexical_block ] [/]
-!917 = metadata !{i32 29, i32 4, metadata !915, null}
-!918 = metadata !{i32 28, i32 18, metadata !916, null}
-!919 = metadata !{i32 30, i32 2, metadata !895, null}
-!920 = metadata !{i32 137, i32 43, metadata !921, null}
-!921 = metadata !{i32 720907, metadata !922, i32 136, i32 1, metadata !29, i32 668} ; [ DW_TAG_lexical_block ] [/]
-!922 = metadata !{i32 720907, metadata !923, i32 135, i32 1, metadata !29, i32 667} ; [ DW_TAG_lexical_block ] [/]
-!923 = metadata !{i32 720907, metadata !140, i32 135, i32 36, metadata !29, i32 666} ; [ DW_TAG_lexical_block ] [/]
-!924 = metadata !{i32 138, i32 43, metadata !921, null}
-!925 = metadata !{i32 140, i32 43, metadata !921, null}
-!926 = metadata !{i32 141, i32 43, metadata !921, null}
-!927 = metadata !{i32 143, i32 1, metadata !921, null}
-!928 = metadata !{i32 143, i32 8, metadata !921, null}
-!929 = metadata !{i32 137, i32 43, metadata !930, null}
-!930 = metadata !{i32 720907, metadata !931, i32 136, i32 1, metadata !29, i32 665} ; [ DW_TAG_lexical_block ] [/]
-!931 = metadata !{i32 720907, metadata !932, i32 135, i32 1, metadata !29, i32 664} ; [ DW_TAG_lexical_block ] [/]
-!932 = metadata !{i32 720907, metadata !139, i32 135, i32 36, metadata !29, i32 663} ; [ DW_TAG_lexical_block ] [/]
-!933 = metadata !{i32 138, i32 43, metadata !930, null}
-!934 = metadata !{i32 140, i32 43, metadata !930, null}
-!935 = metadata !{i32 141, i32 43, metadata !930, null}
-!936 = metadata !{i32 143, i32 1, metadata !930, null}
-!937 = metadata !{i32 143, i32 8, metadata !930, null}
-!938 = metadata !{i32 1120, i32 1, metadata !939, null}
-!939 = metadata !{i32 720907, metadata !940, i32 1118, i32 1, metadata !27, i32 200} ; [ DW_TAG_lexical_block ] [/]
-!940 = metadata !{i32 720907, metadata !941, i32 1117, i32 1, metadata !27, i32 199} ; [ DW_TAG_lexical_block ] [/]
-!941 = metadata !{i32 720907, metadata !26, i32 1117, i32 36, metadata !27, i32 198} ; [ DW_TAG_lexical_block ] [/]
-!942 = metadata !{i32 1120, i32 44, metadata !939, null}
-!943 = metadata !{i32 1121, i32 1, metadata !939, null}
-!944 = metadata !{i32 44, i32 1, metadata !945, null}
-!945 = metadata !{i32 720907, metadata !946, i32 43, i32 1, metadata !34, i32 228} ; [ DW_TAG_lexical_block ] [/]
-!946 = metadata !{i32 720907, metadata !947, i32 43, i32 1, metadata !34, i32 227} ; [ DW_TAG_lexical_block ] [/]
-!947 = metadata !{i32 720907, metadata !948, i32 42, i32 1, metadata !34, i32 226} ; [ DW_TAG_lexical_block ] [/]
-!948 = metadata !{i32 720907, metadata !33, i32 42, i32 43, metadata !34, i32 225} ; [ DW_TAG_lexical_block ] [/]
-!949 = metadata !{i32 45, i32 1, metadata !950, null}
-!950 = metadata !{i32 720907, metadata !945, i32 44, i32 1, metadata !34, i32 229} ; [ DW_TAG_lexical_block ] [/]
-!951 = metadata !{i32 45, i32 98, metadata !950, null}
-!952 = metadata !{i32 46, i32 1, metadata !953, null}
-!953 = metadata !{i32 720907, metadata !954, i32 45, i32 1, metadata !34, i32 231} ; [ DW_TAG_lexical_block ] [/]
-!954 = metadata !{i32 720907, metadata !945, i32 45, i32 1, metadata !34, i32 230} ; [ DW_TAG_lexical_block ] [/]
-!955 = metadata !{i32 47, i32 1, metadata !956, null}
-!956 = metadata !{i32 720907, metadata !953, i32 46, i32 1, metadata !34, i32 232} ; [ DW_TAG_lexical_block ] [/]
-!957 = metadata !{i32 48, i32 1, metadata !958, null}
-!958 = metadata !{i32 720907, metadata !953, i32 47, i32 1, metadata !34, i32 233} ; [ DW_TAG_lexical_block ] [/]
-!959 = metadata !{i32 90, i32 1, metadata !960, null}
-!960 = metadata !{i32 720907, metadata !961, i32 89, i32 1, metadata !27, i32 210} ; [ DW_TAG_lexical_block ] [/]
-!961 = metadata !{i32 720907, metadata !962, i32 89, i32 1, metadata !27, i32 209} ; [ DW_TAG_lexical_block ] [/]
-!962 = metadata !{i32 720907, metadata !963, i32 88, i32 1, metadata !27, i32 208} ; [ DW_TAG_lexical_block ] [/]
-!963 = metadata !{i32 720907, metadata !31, i32 88, i32 36, metadata !27, i32 207} ; [ DW_TAG_lexical_block ] [/]
-!964 = metadata !{i32 90, i32 1, metadata !965, null}
-!965 = metadata !{i32 720907, metadata !960, i32 90, i32 1, metadata !27, i32 211} ; [ DW_TAG_lexical_block ] [/]
-!966 = metadata !{i32 91, i32 1, metadata !967, null}
-!967 = metadata !{i32 720907, metadata !968, i32 90, i32 1, metadata !27, i32 213} ; [ DW_TAG_lexical_block ] [/]
-!968 = metadata !{i32 720907, metadata !960, i32 90, i32 1, metadata !27, i32 212} ; [ DW_TAG_lexical_block ] [/]
-!969 = metadata !{i32 91, i32 1, metadata !970, null}
-!970 = metadata !{i32 720907, metadata !967, i32 91, i32 1, metadata !27, i32 214} ; [ DW_TAG_lexical_block ] [/]
-!971 = metadata !{i32 92, i32 1, metadata !972, null}
-!972 = metadata !{i32 720907, metadata !967, i32 91, i32 1, metadata !27, i32 215} ; [ DW_TAG_lexical_block ] [/]
-!973 = metadata !{i32 90, i32 1, metadata !974, null}
-!974 = metadata !{i32 720907, metadata !975, i32 89, i32 1, metadata !27, i32 219} ; [ DW_TAG_lexical_block ] [/]
-!975 = metadata !{i32 720907, metadata !976, i32 89, i32 1, metadata !27, i32 218} ; [ DW_TAG_lexical_block ] [/]
-!976 = metadata !{i32 720907, metadata !977, i32 88, i32 1, metadata !27, i32 217} ; [ DW_TAG_lexical_block ] [/]
-!977 = metadata !{i32 720907, metadata !32, i32 88, i32 36, metadata !27, i32 216} ; [ DW_TAG_lexical_block ] [/]
-!978 = metadata !{i32 90, i32 1, metadata !979, null}
-!979 = metadata !{i32 720907, metadata !974, i32 90, i32 1, metadata !27, i32 220} ; [ DW_TAG_lexical_block ] [/]
-!980 = metadata !{i32 91, i32 1, metadata !981, null}
-!981 = metadata !{i32 720907, metadata !982, i32 90, i32 1, metadata !27, i32 222} ; [ DW_TAG_lexical_block ] [/]
-!982 = metadata !{i32 720907, metadata !974, i32 90, i32 1, metadata !27, i32 221} ; [ DW_TAG_lexical_block ] [/]
-!983 = metadata !{i32 91, i32 1, metadata !984, null}
-!984 = metadata !{i32 720907, metadata !981, i32 91, i32 1, metadata !27, i32 223} ; [ DW_TAG_lexical_block ] [/]
-!985 = metadata !{i32 92, i32 1, metadata !986, null}
-!986 = metadata !{i32 720907, metadata !981, i32 91, i32 1, metadata !27, i32 224} ; [ DW_TAG_lexical_block ] [/]
-!987 = metadata !{i32 575, i32 1, metadata !988, null}
-!988 = metadata !{i32 720907, metadata !989, i32 573, i32 1, metadata !36, i32 236} ; [ DW_TAG_lexical_block ] [/]
-!989 = metadata !{i32 720907, metadata !990, i32 572, i32 1, metadata !36, i32 235} ; [ DW_TAG_lexical_block ] [/]
-!990 = metadata !{i32 720907, metadata !35, i32 572, i32 36, metadata !36, i32 234} ; [ DW_TAG_lexical_block ] [/]
-!991 = metadata !{i32 575, i32 44, metadata !988, null}
-!992 = metadata !{i32 576, i32 1, metadata !988, null}
-!993 = metadata !{i32 582, i32 1, metadata !988, null}
-!994 = metadata !{i32 575, i32 1, metadata !995, null}
-!995 = metadata !{i32 720907, metadata !996, i32 573, i32 1, metadata !36, i32 245} ; [ DW_TAG_lexical_block ] [/]
-!996 = metadata !{i32 720907, metadata !997, i32 572, i32 1, metadata !36, i32 244} ; [ DW_TAG_lexical_block ] [/]
-!997 = metadata !{i32 720907, metadata !39, i32 572, i32 36, metadata !36, i32 243} ; [ DW_TAG_lexical_block ] [/]
-!998 = metadata !{i32 575, i32 44, metadata !995, null}
-!999 = metadata !{i32 576, i32 1, metadata !995, null}
-!1000 = metadata !{i32 582, i32 1, metadata !995, null}
-!1001 = metadata !{i32 575, i32 1, metadata !1002, null}
-!1002 = metadata !{i32 720907, metadata !1003, i32 573, i32 1, metadata !36, i32 251} ; [ DW_TAG_lexical_block ] [/]
-!1003 = metadata !{i32 720907, metadata !1004, i32 572, i32 1, metadata !36, i32 250} ; [ DW_TAG_lexical_block ] [/]
-!1004 = metadata !{i32 720907, metadata !41, i32 572, i32 36, metadata !36, i32 249} ; [ DW_TAG_lexical_block ] [/]
-!1005 = metadata !{i32 575, i32 44, metadata !1002, null}
-!1006 = metadata !{i32 576, i32 1, metadata !1002, null}
-!1007 = metadata !{i32 582, i32 1, metadata !1002, null}
-!1008 = metadata !{i32 575, i32 1, metadata !1009, null}
-!1009 = metadata !{i32 720907, metadata !1010, i32 573, i32 1, metadata !36, i32 263} ; [ DW_TAG_lexical_block ] [/]
-!1010 = metadata !{i32 720907, metadata !1011, i32 572, i32 1, metadata !36, i32 262} ; [ DW_TAG_lexical_block ] [/]
-!1011 = metadata !{i32 720907, metadata !45, i32 572, i32 36, metadata !36, i32 261} ; [ DW_TAG_lexical_block ] [/]
-!1012 = metadata !{i32 575, i32 44, metadata !1009, null}
-!1013 = metadata !{i32 576, i32 1, metadata !1009, null}
-!1014 = metadata !{i32 582, i32 1, metadata !1009, null}
-!1015 = metadata !{i32 442, i32 1, metadata !1016, null}
-!1016 = metadata !{i32 720907, metadata !1017, i32 432, i32 1, metadata !49, i32 272} ; [ DW_TAG_lexical_block ] [/]
-!1017 = metadata !{i32 720907, metadata !1018, i32 431, i32 1, metadata !49, i32 271} ; [ DW_TAG_lexical_block ] [/]
-!1018 = metadata !{i32 720907, metadata !48, i32 431, i32 36, metadata !49, i32 270} ; [ DW_TAG_lexical_block ] [/]
-!1019 = metadata !{i32 442, i32 44, metadata !1016, null}
-!1020 = metadata !{i32 446, i32 1, metadata !1016, null}
-!1021 = metadata !{i32 91, i32 1, metadata !1022, null}
-!1022 = metadata !{i32 720907, metadata !1023, i32 88, i32 1, metadata !34, i32 281} ; [ DW_TAG_lexical_block ] [/]
-!1023 = metadata !{i32 720907, metadata !1024, i32 87, i32 1, metadata !34, i32 280} ; [ DW_TAG_lexical_block ] [/]
-!1024 = metadata !{i32 720907, metadata !52, i32 87, i32 36, metadata !34, i32 279} ; [ DW_TAG_lexical_block ] [/]
-!1025 = metadata !{i32 91, i32 125, metadata !1022, null}
-!1026 = metadata !{i32 91, i32 46, metadata !1022, null}
-!1027 = metadata !{i32 96, i32 1, metadata !1022, null}
-!1028 = metadata !{i32 96, i32 49, metadata !1022, null}
-!1029 = metadata !{i32 96, i32 208, metadata !1022, null}
-!1030 = metadata !{i32 100, i32 1, metadata !1022, null}
-!1031 = metadata !{i32 71, i32 1, metadata !1032, null}
-!1032 = metadata !{i32 720907, metadata !1033, i32 70, i32 1, metadata !34, i32 285} ; [ DW_TAG_lexical_block ] [/]
-!1033 = metadata !{i32 720907, metadata !1034, i32 70, i32 1, metadata !34, i32 284} ; [ DW_TAG_lexical_block ] [/]
-!1034 = metadata !{i32 720907, metadata !1035, i32 69, i32 1, metadata !34, i32 283} ; [ DW_TAG_lexical_block ] [/]
-!1035 = metadata !{i32 720907, metadata !53, i32 69, i32 46, metadata !34, i32 282} ; [ DW_TAG_lexical_block ] [/]
-!1036 = metadata !{i32 71, i32 1, metadata !1037, null}
-!1037 = metadata !{i32 720907, metadata !1032, i32 71, i32 1, metadata !34, i32 286} ; [ DW_TAG_lexical_block ] [/]
-!1038 = metadata !{i32 72, i32 1, metadata !1039, null}
-!1039 = metadata !{i32 720907, metadata !1032, i32 71, i32 1, metadata !34, i32 287} ; [ DW_TAG_lexical_block ] [/]
-!1040 = metadata !{i32 79, i32 1, metadata !1041, null}
-!1041 = metadata !{i32 720907, metadata !1042, i32 78, i32 1, metadata !34, i32 291} ; [ DW_TAG_lexical_block ] [/]
-!1042 = metadata !{i32 720907, metadata !1043, i32 78, i32 1, metadata !34, i32 290} ; [ DW_TAG_lexical_block ] [/]
-!1043 = metadata !{i32 720907, metadata !1044, i32 77, i32 1, metadata !34, i32 289} ; [ DW_TAG_lexical_block ] [/]
-!1044 = metadata !{i32 720907, metadata !54, i32 77, i32 48, metadata !34, i32 288} ; [ DW_TAG_lexical_block ] [/]
-!1045 = metadata !{i32 79, i32 1, metadata !1046, null}
-!1046 = metadata !{i32 720907, metadata !1041, i32 79, i32 1, metadata !34, i32 292} ; [ DW_TAG_lexical_block ] [/]
-!1047 = metadata !{i32 80, i32 1, metadata !1048, null}
-!1048 = metadata !{i32 720907, metadata !1041, i32 79, i32 1, metadata !34, i32 293} ; [ DW_TAG_lexical_block ] [/]
-!1049 = metadata !{i32 442, i32 1, metadata !1050, null}
-!1050 = metadata !{i32 720907, metadata !1051, i32 432, i32 1, metadata !49, i32 296} ; [ DW_TAG_lexical_block ] [/]
-!1051 = metadata !{i32 720907, metadata !1052, i32 431, i32 1, metadata !49, i32 295} ; [ DW_TAG_lexical_block ] [/]
-!1052 = metadata !{i32 720907, metadata !55, i32 431, i32 36, metadata !49, i32 294} ; [ DW_TAG_lexical_block ] [/]
-!1053 = metadata !{i32 442, i32 44, metadata !1050, null}
-!1054 = metadata !{i32 446, i32 1, metadata !1050, null}
-!1055 = metadata !{i32 91, i32 1, metadata !1056, null}
-!1056 = metadata !{i32 720907, metadata !1057, i32 88, i32 1, metadata !34, i32 335} ; [ DW_TAG_lexical_block ] [/]
-!1057 = metadata !{i32 720907, metadata !1058, i32 87, i32 1, metadata !34, i32 334} ; [ DW_TAG_lexical_block ] [/]
-!1058 = metadata !{i32 720907, metadata !64, i32 87, i32 36, metadata !34, i32 333} ; [ DW_TAG_lexical_block ] [/]
-!1059 = metadata !{i32 91, i32 125, metadata !1056, null}
-!1060 = metadata !{i32 91, i32 46, metadata !1056, null}
-!1061 = metadata !{i32 96, i32 1, metadata !1056, null}
-!1062 = metadata !{i32 96, i32 49, metadata !1056, null}
-!1063 = metadata !{i32 96, i32 208, metadata !1056, null}
-!1064 = metadata !{i32 100, i32 1, metadata !1056, null}
-!1065 = metadata !{i32 442, i32 1, metadata !1066, null}
-!1066 = metadata !{i32 720907, metadata !1067, i32 432, i32 1, metadata !49, i32 302} ; [ DW_TAG_lexical_block ] [/]
-!1067 = metadata !{i32 720907, metadata !1068, i32 431, i32 1, metadata !49, i32 301} ; [ DW_TAG_lexical_block ] [/]
-!1068 = metadata !{i32 720907, metadata !57, i32 431, i32 36, metadata !49, i32 300} ; [ DW_TAG_lexical_block ] [/]
-!1069 = metadata !{i32 442, i32 44, metadata !1066, null}
-!1070 = metadata !{i32 446, i32 1, metadata !1066, null}
-!1071 = metadata !{i32 91, i32 1, metadata !1072, null}
-!1072 = metadata !{i32 720907, metadata !1073, i32 88, i32 1, metadata !34, i32 308} ; [ DW_TAG_lexical_block ] [/]
-!1073 = metadata !{i32 720907, metadata !1074, i32 87, i32 1, metadata !34, i32 307} ; [ DW_TAG_lexical_block ] [/]
-!1074 = metadata !{i32 720907, metadata !59, i32 87, i32 36, metadata !34, i32 306} ; [ DW_TAG_lexical_block ] [/]
-!1075 = metadata !{i32 91, i32 125, metadata !1072, null}
-!1076 = metadata !{i32 91, i32 46, metadata !1072, null}
-!1077 = metadata !{i32 96, i32 1, metadata !1072, null}
-!1078 = metadata !{i32 96, i32 49, metadata !1072, null}
-!1079 = metadata !{i32 96, i32 208, metadata !1072, null}
-!1080 = metadata !{i32 100, i32 1, metadata !1072, null}
-!1081 = metadata !{i32 71, i32 1, metadata !1082, null}
-!1082 = metadata !{i32 720907, metadata !1083, i32 70, i32 1, metadata !34, i32 312} ; [ DW_TAG_lexical_block ] [/]
-!1083 = metadata !{i32 720907, metadata !1084, i32 70, i32 1, metadata !34, i32 311} ; [ DW_TAG_lexical_block ] [/]
-!1084 = metadata !{i32 720907, metadata !1085, i32 69, i32 1, metadata !34, i32 310} ; [ DW_TAG_lexical_block ] [/]
-!1085 = metadata !{i32 720907, metadata !60, i32 69, i32 46, metadata !34, i32 309} ; [ DW_TAG_lexical_block ] [/]
-!1086 = metadata !{i32 71, i32 1, metadata !1087, null}
-!1087 = metadata !{i32 720907, metadata !1082, i32 71, i32 1, metadata !34, i32 313} ; [ DW_TAG_lexical_block ] [/]
-!1088 = metadata !{i32 72, i32 1, metadata !1089, null}
-!1089 = metadata !{i32 720907, metadata !1082, i32 71, i32 1, metadata !34, i32 314} ; [ DW_TAG_lexical_block ] [/]
-!1090 = metadata !{i32 71, i32 1, metadata !1091, null}
-!1091 = metadata !{i32 720907, metadata !1092, i32 70, i32 1, metadata !34, i32 318} ; [ DW_TAG_lexical_block ] [/]
-!1092 = metadata !{i32 720907, metadata !1093, i32 70, i32 1, metadata !34, i32 317} ; [ DW_TAG_lexical_block ] [/]
-!1093 = metadata !{i32 720907, metadata !1094, i32 69, i32 1, metadata !34, i32 316} ; [ DW_TAG_lexical_block ] [/]
-!1094 = metadata !{i32 720907, metadata !61, i32 69, i32 46, metadata !34, i32 315} ; [ DW_TAG_lexical_block ] [/]
-!1095 = metadata !{i32 71, i32 1, metadata !1096, null}
-!1096 = metadata !{i32 720907, metadata !1091, i32 71, i32 1, metadata !34, i32 319} ; [ DW_TAG_lexical_block ] [/]
-!1097 = metadata !{i32 72, i32 1, metadata !1098, null}
-!1098 = metadata !{i32 720907, metadata !1091, i32 71, i32 1, metadata !34, i32 320} ; [ DW_TAG_lexical_block ] [/]
-!1099 = metadata !{i32 79, i32 1, metadata !1100, null}
-!1100 = metadata !{i32 720907, metadata !1101, i32 78, i32 1, metadata !34, i32 324} ; [ DW_TAG_lexical_block ] [/]
-!1101 = metadata !{i32 720907, metadata !1102, i32 78, i32 1, metadata !34, i32 323} ; [ DW_TAG_lexical_block ] [/]
-!1102 = metadata !{i32 720907, metadata !1103, i32 77, i32 1, metadata !34, i32 322} ; [ DW_TAG_lexical_block ] [/]
-!1103 = metadata !{i32 720907, metadata !62, i32 77, i32 48, metadata !34, i32 321} ; [ DW_TAG_lexical_block ] [/]
-!1104 = metadata !{i32 79, i32 1, metadata !1105, null}
-!1105 = metadata !{i32 720907, metadata !1100, i32 79, i32 1, metadata !34, i32 325} ; [ DW_TAG_lexical_block ] [/]
-!1106 = metadata !{i32 80, i32 1, metadata !1107, null}
-!1107 = metadata !{i32 720907, metadata !1100, i32 79, i32 1, metadata !34, i32 326} ; [ DW_TAG_lexical_block ] [/]
-!1108 = metadata !{i32 79, i32 1, metadata !1109, null}
-!1109 = metadata !{i32 720907, metadata !1110, i32 78, i32 1, metadata !34, i32 330} ; [ DW_TAG_lexical_block ] [/]
-!1110 = metadata !{i32 720907, metadata !1111, i32 78, i32 1, metadata !34, i32 329} ; [ DW_TAG_lexical_block ] [/]
-!1111 = metadata !{i32 720907, metadata !1112, i32 77, i32 1, metadata !34, i32 328} ; [ DW_TAG_lexical_block ] [/]
-!1112 = metadata !{i32 720907, metadata !63, i32 77, i32 48, metadata !34, i32 327} ; [ DW_TAG_lexical_block ] [/]
-!1113 = metadata !{i32 79, i32 1, metadata !1114, null}
-!1114 = metadata !{i32 720907, metadata !1109, i32 79, i32 1, metadata !34, i32 331} ; [ DW_TAG_lexical_block ] [/]
-!1115 = metadata !{i32 80, i32 1, metadata !1116, null}
-!1116 = metadata !{i32 720907, metadata !1109, i32 79, i32 1, metadata !34, i32 332} ; [ DW_TAG_lexical_block ] [/]
-!1117 = metadata !{i32 71, i32 1, metadata !1118, null}
-!1118 = metadata !{i32 720907, metadata !1119, i32 70, i32 1, metadata !34, i32 339} ; [ DW_TAG_lexical_block ] [/]
-!1119 = metadata !{i32 720907, metadata !1120, i32 70, i32 1, metadata !34, i32 338} ; [ DW_TAG_lexical_block ] [/]
-!1120 = metadata !{i32 720907, metadata !1121, i32 69, i32 1, metadata !34, i32 337} ; [ DW_TAG_lexical_block ] [/]
-!1121 = metadata !{i32 720907, metadata !65, i32 69, i32 46, metadata !34, i32 336} ; [ DW_TAG_lexical_block ] [/]
-!1122 = metadata !{i32 71, i32 1, metadata !1123, null}
-!1123 = metadata !{i32 720907, metadata !1118, i32 71, i32 1, metadata !34, i32 340} ; [ DW_TAG_lexical_block ] [/]
-!1124 = metadata !{i32 72, i32 1, metadata !1125, null}
-!1125 = metadata !{i32 720907, metadata !1118, i32 71, i32 1, metadata !34, i32 341} ; [ DW_TAG_lexical_block ] [/]
-!1126 = metadata !{i32 71, i32 1, metadata !1127, null}
-!1127 = metadata !{i32 720907, metadata !1128, i32 70, i32 1, metadata !34, i32 345} ; [ DW_TAG_lexical_block ] [/]
-!1128 = metadata !{i32 720907, metadata !1129, i32 70, i32 1, metadata !34, i32 344} ; [ DW_TAG_lexical_block ] [/]
-!1129 = metadata !{i32 720907, metadata !1130, i32 69, i32 1, metadata !34, i32 343} ; [ DW_TAG_lexical_block ] [/]
-!1130 = metadata !{i32 720907, metadata !66, i32 69, i32 46, metadata !34, i32 342} ; [ DW_TAG_lexical_block ] [/]
-!1131 = metadata !{i32 71, i32 1, metadata !1132, null}
-!1132 = metadata !{i32 720907, metadata !1127, i32 71, i32 1, metadata !34, i32 346} ; [ DW_TAG_lexical_block ] [/]
-!1133 = metadata !{i32 72, i32 1, metadata !1134, null}
-!1134 = metadata !{i32 720907, metadata !1127, i32 71, i32 1, metadata !34, i32 347} ; [ DW_TAG_lexical_block ] [/]
-!1135 = metadata !{i32 79, i32 1, metadata !1136, null}
-!1136 = metadata !{i32 720907, metadata !1137, i32 78, i32 1, metadata !34, i32 351} ; [ DW_TAG_lexical_block ] [/]
-!1137 = metadata !{i32 720907, metadata !1138, i32 78, i32 1, metadata !34, i32 350} ; [ DW_TAG_lexical_block ] [/]
-!1138 = metadata !{i32 720907, metadata !1139, i32 77, i32 1, metadata !34, i32 349} ; [ DW_TAG_lexical_block ] [/]
-!1139 = metadata !{i32 720907, metadata !67, i32 77, i32 48, metadata !34, i32 348} ; [ DW_TAG_lexical_block ] [/]
-!1140 = metadata !{i32 79, i32 1, metadata !1141, null}
-!1141 = metadata !{i32 720907, metadata !1136, i32 79, i32 1, metadata !34, i32 352} ; [ DW_TAG_lexical_block ] [/]
-!1142 = metadata !{i32 80, i32 1, metadata !1143, null}
-!1143 = metadata !{i32 720907, metadata !1136, i32 79, i32 1, metadata !34, i32 353} ; [ DW_TAG_lexical_block ] [/]
-!1144 = metadata !{i32 79, i32 1, metadata !1145, null}
-!1145 = metadata !{i32 720907, metadata !1146, i32 78, i32 1, metadata !34, i32 357} ; [ DW_TAG_lexical_block ] [/]
-!1146 = metadata !{i32 720907, metadata !1147, i32 78, i32 1, metadata !34, i32 356} ; [ DW_TAG_lexical_block ] [/]
-!1147 = metadata !{i32 720907, metadata !1148, i32 77, i32 1, metadata !34, i32 355} ; [ DW_TAG_lexical_block ] [/]
-!1148 = metadata !{i32 720907, metadata !68, i32 77, i32 48, metadata !34, i32 354} ; [ DW_TAG_lexical_block ] [/]
-!1149 = metadata !{i32 79, i32 1, metadata !1150, null}
-!1150 = metadata !{i32 720907, metadata !1145, i32 79, i32 1, metadata !34, i32 358} ; [ DW_TAG_lexical_block ] [/]
-!1151 = metadata !{i32 80, i32 1, metadata !1152, null}
-!1152 = metadata !{i32 720907, metadata !1145, i32 79, i32 1, metadata !34, i32 359} ; [ DW_TAG_lexical_block ] [/]
-!1153 = metadata !{i32 442, i32 1, metadata !1154, null}
-!1154 = metadata !{i32 720907, metadata !1155, i32 432, i32 1, metadata !49, i32 368} ; [ DW_TAG_lexical_block ] [/]
-!1155 = metadata !{i32 720907, metadata !1156, i32 431, i32 1, metadata !49, i32 367} ; [ DW_TAG_lexical_block ] [/]
-!1156 = metadata !{i32 720907, metadata !71, i32 431, i32 36, metadata !49, i32 366} ; [ DW_TAG_lexical_block ] [/]
-!1157 = metadata !{i32 442, i32 44, metadata !1154, null}
-!1158 = metadata !{i32 446, i32 1, metadata !1154, null}
-!1159 = metadata !{i32 91, i32 1, metadata !1160, null}
-!1160 = metadata !{i32 720907, metadata !1161, i32 88, i32 1, metadata !34, i32 377} ; [ DW_TAG_lexical_block ] [/]
-!1161 = metadata !{i32 720907, metadata !1162, i32 87, i32 1, metadata !34, i32 376} ; [ DW_TAG_lexical_block ] [/]
-!1162 = metadata !{i32 720907, metadata !74, i32 87, i32 36, metadata !34, i32 375} ; [ DW_TAG_lexical_block ] [/]
-!1163 = metadata !{i32 91, i32 125, metadata !1160, null}
-!1164 = metadata !{i32 91, i32 46, metadata !1160, null}
-!1165 = metadata !{i32 96, i32 1, metadata !1160, null}
-!1166 = metadata !{i32 96, i32 49, metadata !1160, null}
-!1167 = metadata !{i32 96, i32 208, metadata !1160, null}
-!1168 = metadata !{i32 100, i32 1, metadata !1160, null}
-!1169 = metadata !{i32 71, i32 1, metadata !1170, null}
-!1170 = metadata !{i32 720907, metadata !1171, i32 70, i32 1, metadata !34, i32 381} ; [ DW_TAG_lexical_block ] [/]
-!1171 = metadata !{i32 720907, metadata !1172, i32 70, i32 1, metadata !34, i32 380} ; [ DW_TAG_lexical_block ] [/]
-!1172 = metadata !{i32 720907, metadata !1173, i32 69, i32 1, metadata !34, i32 379} ; [ DW_TAG_lexical_block ] [/]
-!1173 = metadata !{i32 720907, metadata !75, i32 69, i32 46, metadata !34, i32 378} ; [ DW_TAG_lexical_block ] [/]
-!1174 = metadata !{i32 71, i32 1, metadata !1175, null}
-!1175 = metadata !{i32 720907, metadata !1170, i32 71, i32 1, metadata !34, i32 382} ; [ DW_TAG_lexical_block ] [/]
-!1176 = metadata !{i32 72, i32 1, metadata !1177, null}
-!1177 = metadata !{i32 720907, metadata !1170, i32 71, i32 1, metadata !34, i32 383} ; [ DW_TAG_lexical_block ] [/]
-!1178 = metadata !{i32 71, i32 1, metadata !1179, null}
-!1179 = metadata !{i32 720907, metadata !1180, i32 70, i32 1, metadata !34, i32 387} ; [ DW_TAG_lexical_block ] [/]
-!1180 = metadata !{i32 720907, metadata !1181, i32 70, i32 1, metadata !34, i32 386} ; [ DW_TAG_lexical_block ] [/]
-!1181 = metadata !{i32 720907, metadata !1182, i32 69, i32 1, metadata !34, i32 385} ; [ DW_TAG_lexical_block ] [/]
-!1182 = metadata !{i32 720907, metadata !76, i32 69, i32 46, metadata !34, i32 384} ; [ DW_TAG_lexical_block ] [/]
-!1183 = metadata !{i32 71, i32 1, metadata !1184, null}
-!1184 = metadata !{i32 720907, metadata !1179, i32 71, i32 1, metadata !34, i32 388} ; [ DW_TAG_lexical_block ] [/]
-!1185 = metadata !{i32 72, i32 1, metadata !1186, null}
-!1186 = metadata !{i32 720907, metadata !1179, i32 71, i32 1, metadata !34, i32 389} ; [ DW_TAG_lexical_block ] [/]
-!1187 = metadata !{i32 79, i32 1, metadata !1188, null}
-!1188 = metadata !{i32 720907, metadata !1189, i32 78, i32 1, metadata !34, i32 393} ; [ DW_TAG_lexical_block ] [/]
-!1189 = metadata !{i32 720907, metadata !1190, i32 78, i32 1, metadata !34, i32 392} ; [ DW_TAG_lexical_block ] [/]
-!1190 = metadata !{i32 720907, metadata !1191, i32 77, i32 1, metadata !34, i32 391} ; [ DW_TAG_lexical_block ] [/]
-!1191 = metadata !{i32 720907, metadata !77, i32 77, i32 48, metadata !34, i32 390} ; [ DW_TAG_lexical_block ] [/]
-!1192 = metadata !{i32 79, i32 1, metadata !1193, null}
-!1193 = metadata !{i32 720907, metadata !1188, i32 79, i32 1, metadata !34, i32 394} ; [ DW_TAG_lexical_block ] [/]
-!1194 = metadata !{i32 80, i32 1, metadata !1195, null}
-!1195 = metadata !{i32 720907, metadata !1188, i32 79, i32 1, metadata !34, i32 395} ; [ DW_TAG_lexical_block ] [/]
-!1196 = metadata !{i32 79, i32 1, metadata !1197, null}
-!1197 = metadata !{i32 720907, metadata !1198, i32 78, i32 1, metadata !34, i32 399} ; [ DW_TAG_lexical_block ] [/]
-!1198 = metadata !{i32 720907, metadata !1199, i32 78, i32 1, metadata !34, i32 398} ; [ DW_TAG_lexical_block ] [/]
-!1199 = metadata !{i32 720907, metadata !1200, i32 77, i32 1, metadata !34, i32 397} ; [ DW_TAG_lexical_block ] [/]
-!1200 = metadata !{i32 720907, metadata !78, i32 77, i32 48, metadata !34, i32 396} ; [ DW_TAG_lexical_block ] [/]
-!1201 = metadata !{i32 79, i32 1, metadata !1202, null}
-!1202 = metadata !{i32 720907, metadata !1197, i32 79, i32 1, metadata !34, i32 400} ; [ DW_TAG_lexical_block ] [/]
-!1203 = metadata !{i32 80, i32 1, metadata !1204, null}
-!1204 = metadata !{i32 720907, metadata !1197, i32 79, i32 1, metadata !34, i32 401} ; [ DW_TAG_lexical_block ] [/]
-!1205 = metadata !{i32 513, i32 1, metadata !1206, null}
-!1206 = metadata !{i32 720907, metadata !1207, i32 503, i32 1, metadata !80, i32 404} ; [ DW_TAG_lexical_block ] [/]
-!1207 = metadata !{i32 720907, metadata !1208, i32 502, i32 1, metadata !80, i32 403} ; [ DW_TAG_lexical_block ] [/]
-!1208 = metadata !{i32 720907, metadata !79, i32 502, i32 36, metadata !80, i32 402} ; [ DW_TAG_lexical_block ] [/]
-!1209 = metadata !{i32 513, i32 44, metadata !1206, null}
-!1210 = metadata !{i32 517, i32 1, metadata !1206, null}
-!1211 = metadata !{i32 134, i32 1, metadata !1212, null}
-!1212 = metadata !{i32 720907, metadata !1213, i32 131, i32 1, metadata !34, i32 413} ; [ DW_TAG_lexical_block ] [/]
-!1213 = metadata !{i32 720907, metadata !1214, i32 130, i32 1, metadata !34, i32 412} ; [ DW_TAG_lexical_block ] [/]
-!1214 = metadata !{i32 720907, metadata !83, i32 130, i32 36, metadata !34, i32 411} ; [ DW_TAG_lexical_block ] [/]
-!1215 = metadata !{i32 134, i32 126, metadata !1212, null}
-!1216 = metadata !{i32 134, i32 46, metadata !1212, null}
-!1217 = metadata !{i32 139, i32 1, metadata !1212, null}
-!1218 = metadata !{i32 139, i32 49, metadata !1212, null}
-!1219 = metadata !{i32 139, i32 209, metadata !1212, null}
-!1220 = metadata !{i32 143, i32 1, metadata !1212, null}
-!1221 = metadata !{i32 114, i32 1, metadata !1222, null}
-!1222 = metadata !{i32 720907, metadata !1223, i32 113, i32 1, metadata !34, i32 417} ; [ DW_TAG_lexical_block ] [/]
-!1223 = metadata !{i32 720907, metadata !1224, i32 113, i32 1, metadata !34, i32 416} ; [ DW_TAG_lexical_block ] [/]
-!1224 = metadata !{i32 720907, metadata !1225, i32 112, i32 1, metadata !34, i32 415} ; [ DW_TAG_lexical_block ] [/]
-!1225 = metadata !{i32 720907, metadata !84, i32 112, i32 46, metadata !34, i32 414} ; [ DW_TAG_lexical_block ] [/]
-!1226 = metadata !{i32 114, i32 1, metadata !1227, null}
-!1227 = metadata !{i32 720907, metadata !1222, i32 114, i32 1, metadata !34, i32 418} ; [ DW_TAG_lexical_block ] [/]
-!1228 = metadata !{i32 115, i32 1, metadata !1229, null}
-!1229 = metadata !{i32 720907, metadata !1222, i32 114, i32 1, metadata !34, i32 419} ; [ DW_TAG_lexical_block ] [/]
-!1230 = metadata !{i32 122, i32 1, metadata !1231, null}
-!1231 = metadata !{i32 720907, metadata !1232, i32 121, i32 1, metadata !34, i32 423} ; [ DW_TAG_lexical_block ] [/]
-!1232 = metadata !{i32 720907, metadata !1233, i32 121, i32 1, metadata !34, i32 422} ; [ DW_TAG_lexical_block ] [/]
-!1233 = metadata !{i32 720907, metadata !1234, i32 120, i32 1, metadata !34, i32 421} ; [ DW_TAG_lexical_block ] [/]
-!1234 = metadata !{i32 720907, metadata !85, i32 120, i32 48, metadata !34, i32 420} ; [ DW_TAG_lexical_block ] [/]
-!1235 = metadata !{i32 122, i32 1, metadata !1236, null}
-!1236 = metadata !{i32 720907, metadata !1231, i32 122, i32 1, metadata !34, i32 424} ; [ DW_TAG_lexical_block ] [/]
-!1237 = metadata !{i32 123, i32 1, metadata !1238, null}
-!1238 = metadata !{i32 720907, metadata !1231, i32 122, i32 1, metadata !34, i32 425} ; [ DW_TAG_lexical_block ] [/]
-!1239 = metadata !{i32 513, i32 1, metadata !1240, null}
-!1240 = metadata !{i32 720907, metadata !1241, i32 503, i32 1, metadata !80, i32 428} ; [ DW_TAG_lexical_block ] [/]
-!1241 = metadata !{i32 720907, metadata !1242, i32 502, i32 1, metadata !80, i32 427} ; [ DW_TAG_lexical_block ] [/]
-!1242 = metadata !{i32 720907, metadata !86, i32 502, i32 36, metadata !80, i32 426} ; [ DW_TAG_lexical_block ] [/]
-!1243 = metadata !{i32 513, i32 44, metadata !1240, null}
-!1244 = metadata !{i32 517, i32 1, metadata !1240, null}
-!1245 = metadata !{i32 134, i32 1, metadata !1246, null}
-!1246 = metadata !{i32 720907, metadata !1247, i32 131, i32 1, metadata !34, i32 467} ; [ DW_TAG_lexical_block ] [/]
-!1247 = metadata !{i32 720907, metadata !1248, i32 130, i32 1, metadata !34, i32 466} ; [ DW_TAG_lexical_block ] [/]
-!1248 = metadata !{i32 720907, metadata !95, i32 130, i32 36, metadata !34, i32 465} ; [ DW_TAG_lexical_block ] [/]
-!1249 = metadata !{i32 134, i32 126, metadata !1246, null}
-!1250 = metadata !{i32 134, i32 46, metadata !1246, null}
-!1251 = metadata !{i32 139, i32 1, metadata !1246, null}
-!1252 = metadata !{i32 139, i32 49, metadata !1246, null}
-!1253 = metadata !{i32 139, i32 209, metadata !1246, null}
-!1254 = metadata !{i32 143, i32 1, metadata !1246, null}
-!1255 = metadata !{i32 513, i32 1, metadata !1256, null}
-!1256 = metadata !{i32 720907, metadata !1257, i32 503, i32 1, metadata !80, i32 434} ; [ DW_TAG_lexical_block ] [/]
-!1257 = metadata !{i32 720907, metadata !1258, i32 502, i32 1, metadata !80, i32 433} ; [ DW_TAG_lexical_block ] [/]
-!1258 = metadata !{i32 720907, metadata !88, i32 502, i32 36, metadata !80, i32 432} ; [ DW_TAG_lexical_block ] [/]
-!1259 = metadata !{i32 513, i32 44, metadata !1256, null}
-!1260 = metadata !{i32 517, i32 1, metadata !1256, null}
-!1261 = metadata !{i32 134, i32 1, metadata !1262, null}
-!1262 = metadata !{i32 720907, metadata !1263, i32 131, i32 1, metadata !34, i32 440} ; [ DW_TAG_lexical_block ] [/]
-!1263 = metadata !{i32 720907, metadata !1264, i32 130, i32 1, metadata !34, i32 439} ; [ DW_TAG_lexical_block ] [/]
-!1264 = metadata !{i32 720907, metadata !90, i32 130, i32 36, metadata !34, i32 438} ; [ DW_TAG_lexical_block ] [/]
-!1265 = metadata !{i32 134, i32 126, metadata !1262, null}
-!1266 = metadata !{i32 134, i32 46, metadata !1262, null}
-!1267 = metadata !{i32 139, i32 1, metadata !1262, null}
-!1268 = metadata !{i32 139, i32 49, metadata !1262, null}
-!1269 = metadata !{i32 139, i32 209, metadata !1262, null}
-!1270 = metadata !{i32 143, i32 1, metadata !1262, null}
-!1271 = metadata !{i32 114, i32 1, metadata !1272, null}
-!1272 = metadata !{i32 720907, metadata !1273, i32 113, i32 1, metadata !34, i32 444} ; [ DW_TAG_lexical_block ] [/]
-!1273 = metadata !{i32 720907, metadata !1274, i32 113, i32 1, metadata !34, i32 443} ; [ DW_TAG_lexical_block ] [/]
-!1274 = metadata !{i32 720907, metadata !1275, i32 112, i32 1, metadata !34, i32 442} ; [ DW_TAG_lexical_block ] [/]
-!1275 = metadata !{i32 720907, metadata !91, i32 112, i32 46, metadata !34, i32 441} ; [ DW_TAG_lexical_block ] [/]
-!1276 = metadata !{i32 114, i32 1, metadata !1277, null}
-!1277 = metadata !{i32 720907, metadata !1272, i32 114, i32 1, metadata !34, i32 445} ; [ DW_TAG_lexical_block ] [/]
-!1278 = metadata !{i32 115, i32 1, metadata !1279, null}
-!1279 = metadata !{i32 720907, metadata !1272, i32 114, i32 1, metadata !34, i32 446} ; [ DW_TAG_lexical_block ] [/]
-!1280 = metadata !{i32 114, i32 1, metadata !1281, null}
-!1281 = metadata !{i32 720907, metadata !1282, i32 113, i32 1, metadata !34, i32 450} ; [ DW_TAG_lexical_block ] [/]
-!1282 = metadata !{i32 720907, metadata !1283, i32 113, i32 1, metadata !34, i32 449} ; [ DW_TAG_lexical_block ] [/]
-!1283 = metadata !{i32 720907, metadata !1284, i32 112, i32 1, metadata !34, i32 448} ; [ DW_TAG_lexical_block ] [/]
-!1284 = metadata !{i32 720907, metadata !92, i32 112, i32 46, metadata !34, i32 447} ; [ DW_TAG_lexical_block ] [/]
-!1285 = metadata !{i32 114, i32 1, metadata !1286, null}
-!1286 = metadata !{i32 720907, metadata !1281, i32 114, i32 1, metadata !34, i32 451} ; [ DW_TAG_lexical_block ] [/]
-!1287 = metadata !{i32 115, i32 1, metadata !1288, null}
-!1288 = metadata !{i32 720907, metadata !1281, i32 114, i32 1, metadata !34, i32 452} ; [ DW_TAG_lexical_block ] [/]
-!1289 = metadata !{i32 122, i32 1, metadata !1290, null}
-!1290 = metadata !{i32 720907, metadata !1291, i32 121, i32 1, metadata !34, i32 456} ; [ DW_TAG_lexical_block ] [/]
-!1291 = metadata !{i32 720907, metadata !1292, i32 121, i32 1, metadata !34, i32 455} ; [ DW_TAG_lexical_block ] [/]
-!1292 = metadata !{i32 720907, metadata !1293, i32 120, i32 1, metadata !34, i32 454} ; [ DW_TAG_lexical_block ] [/]
-!1293 = metadata !{i32 720907, metadata !93, i32 120, i32 48, metadata !34, i32 453} ; [ DW_TAG_lexical_block ] [/]
-!1294 = metadata !{i32 122, i32 1, metadata !1295, null}
-!1295 = metadata !{i32 720907, metadata !1290, i32 122, i32 1, metadata !34, i32 457} ; [ DW_TAG_lexical_block ] [/]
-!1296 = metadata !{i32 123, i32 1, metadata !1297, null}
-!1297 = metadata !{i32 720907, metadata !1290, i32 122, i32 1, metadata !34, i32 458} ; [ DW_TAG_lexical_block ] [/]
-!1298 = metadata !{i32 122, i32 1, metadata !1299, null}
-!1299 = metadata !{i32 720907, metadata !1300, i32 121, i32 1, metadata !34, i32 462} ; [ DW_TAG_lexical_block ] [/]
-!1300 = metadata !{i32 720907, metadata !1301, i32 121, i32 1, metadata !34, i32 461} ; [ DW_TAG_lexical_block ] [/]
-!1301 = metadata !{i32 720907, metadata !1302, i32 120, i32 1, metadata !34, i32 460} ; [ DW_TAG_lexical_block ] [/]
-!1302 = metadata !{i32 720907, metadata !94, i32 120, i32 48, metadata !34, i32 459} ; [ DW_TAG_lexical_block ] [/]
-!1303 = metadata !{i32 122, i32 1, metadata !1304, null}
-!1304 = metadata !{i32 720907, metadata !1299, i32 122, i32 1, metadata !34, i32 463} ; [ DW_TAG_lexical_block ] [/]
-!1305 = metadata !{i32 123, i32 1, metadata !1306, null}
-!1306 = metadata !{i32 720907, metadata !1299, i32 122, i32 1, metadata !34, i32 464} ; [ DW_TAG_lexical_block ] [/]
-!1307 = metadata !{i32 114, i32 1, metadata !1308, null}
-!1308 = metadata !{i32 720907, metadata !1309, i32 113, i32 1, metadata !34, i32 471} ; [ DW_TAG_lexical_block ] [/]
-!1309 = metadata !{i32 720907, metadata !1310, i32 113, i32 1, metadata !34, i32 470} ; [ DW_TAG_lexical_block ] [/]
-!1310 = metadata !{i32 720907, metadata !1311, i32 112, i32 1, metadata !34, i32 469} ; [ DW_TAG_lexical_block ] [/]
-!1311 = metadata !{i32 720907, metadata !96, i32 112, i32 46, metadata !34, i32 468} ; [ DW_TAG_lexical_block ] [/]
-!1312 = metadata !{i32 114, i32 1, metadata !1313, null}
-!1313 = metadata !{i32 720907, metadata !1308, i32 114, i32 1, metadata !34, i32 472} ; [ DW_TAG_lexical_block ] [/]
-!1314 = metadata !{i32 115, i32 1, metadata !1315, null}
-!1315 = metadata !{i32 720907, metadata !1308, i32 114, i32 1, metadata !34, i32 473} ; [ DW_TAG_lexical_block ] [/]
-!1316 = metadata !{i32 114, i32 1, metadata !1317, null}
-!1317 = metadata !{i32 720907, metadata !1318, i32 113, i32 1, metadata !34, i32 477} ; [ DW_TAG_lexical_block ] [/]
-!1318 = metadata !{i32 720907, metadata !1319, i32 113, i32 1, metadata !34, i32 476} ; [ DW_TAG_lexical_block ] [/]
-!1319 = metadata !{i32 720907, metadata !1320, i32 112, i32 1, metadata !34, i32 475} ; [ DW_TAG_lexical_block ] [/]
-!1320 = metadata !{i32 720907, metadata !97, i32 112, i32 46, metadata !34, i32 474} ; [ DW_TAG_lexical_block ] [/]
-!1321 = metadata !{i32 114, i32 1, metadata !1322, null}
-!1322 = metadata !{i32 720907, metadata !1317, i32 114, i32 1, metadata !34, i32 478} ; [ DW_TAG_lexical_block ] [/]
-!1323 = metadata !{i32 115, i32 1, metadata !1324, null}
-!1324 = metadata !{i32 720907, metadata !1317, i32 114, i32 1, metadata !34, i32 479} ; [ DW_TAG_lexical_block ] [/]
-!1325 = metadata !{i32 122, i32 1, metadata !1326, null}
-!1326 = metadata !{i32 720907, metadata !1327, i32 121, i32 1, metadata !34, i32 483} ; [ DW_TAG_lexical_block ] [/]
-!1327 = metadata !{i32 720907, metadata !1328, i32 121, i32 1, metadata !34, i32 482} ; [ DW_TAG_lexical_block ] [/]
-!1328 = metadata !{i32 720907, metadata !1329, i32 120, i32 1, metadata !34, i32 481} ; [ DW_TAG_lexical_block ] [/]
-!1329 = metadata !{i32 720907, metadata !98, i32 120, i32 48, metadata !34, i32 480} ; [ DW_TAG_lexical_block ] [/]
-!1330 = metadata !{i32 122, i32 1, metadata !1331, null}
-!1331 = metadata !{i32 720907, metadata !1326, i32 122, i32 1, metadata !34, i32 484} ; [ DW_TAG_lexical_block ] [/]
-!1332 = metadata !{i32 123, i32 1, metadata !1333, null}
-!1333 = metadata !{i32 720907, metadata !1326, i32 122, i32 1, metadata !34, i32 485} ; [ DW_TAG_lexical_block ] [/]
-!1334 = metadata !{i32 122, i32 1, metadata !1335, null}
-!1335 = metadata !{i32 720907, metadata !1336, i32 121, i32 1, metadata !34, i32 489} ; [ DW_TAG_lexical_block ] [/]
-!1336 = metadata !{i32 720907, metadata !1337, i32 121, i32 1, metadata !34, i32 488} ; [ DW_TAG_lexical_block ] [/]
-!1337 = metadata !{i32 720907, metadata !1338, i32 120, i32 1, metadata !34, i32 487} ; [ DW_TAG_lexical_block ] [/]
-!1338 = metadata !{i32 720907, metadata !99, i32 120, i32 48, metadata !34, i32 486} ; [ DW_TAG_lexical_block ] [/]
-!1339 = metadata !{i32 122, i32 1, metadata !1340, null}
-!1340 = metadata !{i32 720907, metadata !1335, i32 122, i32 1, metadata !34, i32 490} ; [ DW_TAG_lexical_block ] [/]
-!1341 = metadata !{i32 123, i32 1, metadata !1342, null}
-!1342 = metadata !{i32 720907, metadata !1335, i32 122, i32 1, metadata !34, i32 491} ; [ DW_TAG_lexical_block ] [/]
-!1343 = metadata !{i32 513, i32 1, metadata !1344, null}
-!1344 = metadata !{i32 720907, metadata !1345, i32 503, i32 1, metadata !80, i32 500} ; [ DW_TAG_lexical_block ] [/]
-!1345 = metadata !{i32 720907, metadata !1346, i32 502, i32 1, metadata !80, i32 499} ; [ DW_TAG_lexical_block ] [/]
-!1346 = metadata !{i32 720907, metadata !102, i32 502, i32 36, metadata !80, i32 498} ; [ DW_TAG_lexical_block ] [/]
-!1347 = metadata !{i32 513, i32 44, metadata !1344, null}
-!1348 = metadata !{i32 517, i32 1, metadata !1344, null}
-!1349 = metadata !{i32 134, i32 1, metadata !1350, null}
-!1350 = metadata !{i32 720907, metadata !1351, i32 131, i32 1, metadata !34, i32 509} ; [ DW_TAG_lexical_block ] [/]
-!1351 = metadata !{i32 720907, metadata !1352, i32 130, i32 1, metadata !34, i32 508} ; [ DW_TAG_lexical_block ] [/]
-!1352 = metadata !{i32 720907, metadata !105, i32 130, i32 36, metadata !34, i32 507} ; [ DW_TAG_lexical_block ] [/]
-!1353 = metadata !{i32 134, i32 126, metadata !1350, null}
-!1354 = metadata !{i32 134, i32 46, metadata !1350, null}
-!1355 = metadata !{i32 139, i32 1, metadata !1350, null}
-!1356 = metadata !{i32 139, i32 49, metadata !1350, null}
-!1357 = metadata !{i32 139, i32 209, metadata !1350, null}
-!1358 = metadata !{i32 143, i32 1, metadata !1350, null}
-!1359 = metadata !{i32 114, i32 1, metadata !1360, null}
-!1360 = metadata !{i32 720907, metadata !1361, i32 113, i32 1, metadata !34, i32 513} ; [ DW_TAG_lexical_block ] [/]
-!1361 = metadata !{i32 720907, metadata !1362, i32 113, i32 1, metadata !34, i32 512} ; [ DW_TAG_lexical_block ] [/]
-!1362 = metadata !{i32 720907, metadata !1363, i32 112, i32 1, metadata !34, i32 511} ; [ DW_TAG_lexical_block ] [/]
-!1363 = metadata !{i32 720907, metadata !106, i32 112, i32 46, metadata !34, i32 510} ; [ DW_TAG_lexical_block ] [/]
-!1364 = metadata !{i32 114, i32 1, metadata !1365, null}
-!1365 = metadata !{i32 720907, metadata !1360, i32 114, i32 1, metadata !34, i32 514} ; [ DW_TAG_lexical_block ] [/]
-!1366 = metadata !{i32 115, i32 1, metadata !1367, null}
-!1367 = metadata !{i32 720907, metadata !1360, i32 114, i32 1, metadata !34, i32 515} ; [ DW_TAG_lexical_block ] [/]
-!1368 = metadata !{i32 114, i32 1, metadata !1369, null}
-!1369 = metadata !{i32 720907, metadata !1370, i32 113, i32 1, metadata !34, i32 519} ; [ DW_TAG_lexical_block ] [/]
-!1370 = metadata !{i32 720907, metadata !1371, i32 113, i32 1, metadata !34, i32 518} ; [ DW_TAG_lexical_block ] [/]
-!1371 = metadata !{i32 720907, metadata !1372, i32 112, i32 1, metadata !34, i32 517} ; [ DW_TAG_lexical_block ] [/]
-!1372 = metadata !{i32 720907, metadata !107, i32 112, i32 46, metadata !34, i32 516} ; [ DW_TAG_lexical_block ] [/]
-!1373 = metadata !{i32 114, i32 1, metadata !1374, null}
-!1374 = metadata !{i32 720907, metadata !1369, i32 114, i32 1, metadata !34, i32 520} ; [ DW_TAG_lexical_block ] [/]
-!1375 = metadata !{i32 115, i32 1, metadata !1376, null}
-!1376 = metadata !{i32 720907, metadata !1369, i32 114, i32 1, metadata !34, i32 521} ; [ DW_TAG_lexical_block ] [/]
-!1377 = metadata !{i32 122, i32 1, metadata !1378, null}
-!1378 = metadata !{i32 720907, metadata !1379, i32 121, i32 1, metadata !34, i32 525} ; [ DW_TAG_lexical_block ] [/]
-!1379 = metadata !{i32 720907, metadata !1380, i32 121, i32 1, metadata !34, i32 524} ; [ DW_TAG_lexical_block ] [/]
-!1380 = metadata !{i32 720907, metadata !1381, i32 120, i32 1, metadata !34, i32 523} ; [ DW_TAG_lexical_block ] [/]
-!1381 = metadata !{i32 720907, metadata !108, i32 120, i32 48, metadata !34, i32 522} ; [ DW_TAG_lexical_block ] [/]
-!1382 = metadata !{i32 122, i32 1, metadata !1383, null}
-!1383 = metadata !{i32 720907, metadata !1378, i32 122, i32 1, metadata !34, i32 526} ; [ DW_TAG_lexical_block ] [/]
-!1384 = metadata !{i32 123, i32 1, metadata !1385, null}
-!1385 = metadata !{i32 720907, metadata !1378, i32 122, i32 1, metadata !34, i32 527} ; [ DW_TAG_lexical_block ] [/]
-!1386 = metadata !{i32 122, i32 1, metadata !1387, null}
-!1387 = metadata !{i32 720907, metadata !1388, i32 121, i32 1, metadata !34, i32 531} ; [ DW_TAG_lexical_block ] [/]
-!1388 = metadata !{i32 720907, metadata !1389, i32 121, i32 1, metadata !34, i32 530} ; [ DW_TAG_lexical_block ] [/]
-!1389 = metadata !{i32 720907, metadata !1390, i32 120, i32 1, metadata !34, i32 529} ; [ DW_TAG_lexical_block ] [/]
-!1390 = metadata !{i32 720907, metadata !109, i32 120, i32 48, metadata !34, i32 528} ; [ DW_TAG_lexical_block ] [/]
-!1391 = metadata !{i32 122, i32 1, metadata !1392, null}
-!1392 = metadata !{i32 720907, metadata !1387, i32 122, i32 1, metadata !34, i32 532} ; [ DW_TAG_lexical_block ] [/]
-!1393 = metadata !{i32 123, i32 1, metadata !1394, null}
-!1394 = metadata !{i32 720907, metadata !1387, i32 122, i32 1, metadata !34, i32 533} ; [ DW_TAG_lexical_block ] [/]
-!1395 = metadata !{i32 587, i32 1, metadata !1396, null}
-!1396 = metadata !{i32 720907, metadata !1397, i32 577, i32 1, metadata !111, i32 536} ; [ DW_TAG_lexical_block ] [/]
-!1397 = metadata !{i32 720907, metadata !1398, i32 576, i32 1, metadata !111, i32 535} ; [ DW_TAG_lexical_block ] [/]
-!1398 = metadata !{i32 720907, metadata !110, i32 576, i32 36, metadata !111, i32 534} ; [ DW_TAG_lexical_block ] [/]
-!1399 = metadata !{i32 587, i32 44, metadata !1396, null}
-!1400 = metadata !{i32 593, i32 1, metadata !1396, null}
-!1401 = metadata !{i32 188, i32 1, metadata !1402, null}
-!1402 = metadata !{i32 720907, metadata !1403, i32 185, i32 1, metadata !34, i32 545} ; [ DW_TAG_lexical_block ] [/]
-!1403 = metadata !{i32 720907, metadata !1404, i32 184, i32 1, metadata !34, i32 544} ; [ DW_TAG_lexical_block ] [/]
-!1404 = metadata !{i32 720907, metadata !114, i32 184, i32 36, metadata !34, i32 543} ; [ DW_TAG_lexical_block ] [/]
-!1405 = metadata !{i32 188, i32 126, metadata !1402, null}
-!1406 = metadata !{i32 188, i32 46, metadata !1402, null}
-!1407 = metadata !{i32 195, i32 1, metadata !1402, null}
-!1408 = metadata !{i32 195, i32 126, metadata !1402, null}
-!1409 = metadata !{i32 195, i32 46, metadata !1402, null}
-!1410 = metadata !{i32 200, i32 1, metadata !1402, null}
-!1411 = metadata !{i32 200, i32 49, metadata !1402, null}
-!1412 = metadata !{i32 200, i32 246, metadata !1402, null}
-!1413 = metadata !{i32 204, i32 1, metadata !1402, null}
-!1414 = metadata !{i32 157, i32 1, metadata !1415, null}
-!1415 = metadata !{i32 720907, metadata !1416, i32 156, i32 1, metadata !34, i32 549} ; [ DW_TAG_lexical_block ] [/]
-!1416 = metadata !{i32 720907, metadata !1417, i32 156, i32 1, metadata !34, i32 548} ; [ DW_TAG_lexical_block ] [/]
-!1417 = metadata !{i32 720907, metadata !1418, i32 155, i32 1, metadata !34, i32 547} ; [ DW_TAG_lexical_block ] [/]
-!1418 = metadata !{i32 720907, metadata !115, i32 155, i32 46, metadata !34, i32 546} ; [ DW_TAG_lexical_block ] [/]
-!1419 = metadata !{i32 157, i32 1, metadata !1420, null}
-!1420 = metadata !{i32 720907, metadata !1415, i32 157, i32 1, metadata !34, i32 550} ; [ DW_TAG_lexical_block ] [/]
-!1421 = metadata !{i32 158, i32 1, metadata !1422, null}
-!1422 = metadata !{i32 720907, metadata !1415, i32 157, i32 1, metadata !34, i32 551} ; [ DW_TAG_lexical_block ] [/]
-!1423 = metadata !{i32 173, i32 1, metadata !1424, null}
-!1424 = metadata !{i32 720907, metadata !1425, i32 172, i32 1, metadata !34, i32 555} ; [ DW_TAG_lexical_block ] [/]
-!1425 = metadata !{i32 720907, metadata !1426, i32 172, i32 1, metadata !34, i32 554} ; [ DW_TAG_lexical_block ] [/]
-!1426 = metadata !{i32 720907, metadata !1427, i32 171, i32 1, metadata !34, i32 553} ; [ DW_TAG_lexical_block ] [/]
-!1427 = metadata !{i32 720907, metadata !116, i32 171, i32 43, metadata !34, i32 552} ; [ DW_TAG_lexical_block ] [/]
-!1428 = metadata !{i32 173, i32 1, metadata !1429, null}
-!1429 = metadata !{i32 720907, metadata !1424, i32 173, i32 1, metadata !34, i32 556} ; [ DW_TAG_lexical_block ] [/]
-!1430 = metadata !{i32 174, i32 1, metadata !1431, null}
-!1431 = metadata !{i32 720907, metadata !1424, i32 173, i32 1, metadata !34, i32 557} ; [ DW_TAG_lexical_block ] [/]
-!1432 = metadata !{i32 165, i32 1, metadata !1433, null}
-!1433 = metadata !{i32 720907, metadata !1434, i32 164, i32 1, metadata !34, i32 561} ; [ DW_TAG_lexical_block ] [/]
-!1434 = metadata !{i32 720907, metadata !1435, i32 164, i32 1, metadata !34, i32 560} ; [ DW_TAG_lexical_block ] [/]
-!1435 = metadata !{i32 720907, metadata !1436, i32 163, i32 1, metadata !34, i32 559} ; [ DW_TAG_lexical_block ] [/]
-!1436 = metadata !{i32 720907, metadata !117, i32 163, i32 48, metadata !34, i32 558} ; [ DW_TAG_lexical_block ] [/]
-!1437 = metadata !{i32 165, i32 1, metadata !1438, null}
-!1438 = metadata !{i32 720907, metadata !1433, i32 165, i32 1, metadata !34, i32 562} ; [ DW_TAG_lexical_block ] [/]
-!1439 = metadata !{i32 166, i32 1, metadata !1440, null}
-!1440 = metadata !{i32 720907, metadata !1433, i32 165, i32 1, metadata !34, i32 563} ; [ DW_TAG_lexical_block ] [/]
-!1441 = metadata !{i32 587, i32 1, metadata !1442, null}
-!1442 = metadata !{i32 720907, metadata !1443, i32 577, i32 1, metadata !111, i32 566} ; [ DW_TAG_lexical_block ] [/]
-!1443 = metadata !{i32 720907, metadata !1444, i32 576, i32 1, metadata !111, i32 565} ; [ DW_TAG_lexical_block ] [/]
-!1444 = metadata !{i32 720907, metadata !118, i32 576, i32 36, metadata !111, i32 564} ; [ DW_TAG_lexical_block ] [/]
-!1445 = metadata !{i32 587, i32 44, metadata !1442, null}
-!1446 = metadata !{i32 593, i32 1, metadata !1442, null}
-!1447 = metadata !{i32 188, i32 1, metadata !1448, null}
-!1448 = metadata !{i32 720907, metadata !1449, i32 185, i32 1, metadata !34, i32 617} ; [ DW_TAG_lexical_block ] [/]
-!1449 = metadata !{i32 720907, metadata !1450, i32 184, i32 1, metadata !34, i32 616} ; [ DW_TAG_lexical_block ] [/]
-!1450 = metadata !{i32 720907, metadata !129, i32 184, i32 36, metadata !34, i32 615} ; [ DW_TAG_lexical_block ] [/]
-!1451 = metadata !{i32 188, i32 126, metadata !1448, null}
-!1452 = metadata !{i32 188, i32 46, metadata !1448, null}
-!1453 = metadata !{i32 195, i32 1, metadata !1448, null}
-!1454 = metadata !{i32 195, i32 126, metadata !1448, null}
-!1455 = metadata !{i32 195, i32 46, metadata !1448, null}
-!1456 = metadata !{i32 200, i32 1, metadata !1448, null}
-!1457 = metadata !{i32 200, i32 49, metadata !1448, null}
-!1458 = metadata !{i32 200, i32 246, metadata !1448, null}
-!1459 = metadata !{i32 204, i32 1, metadata !1448, null}
-!1460 = metadata !{i32 587, i32 1, metadata !1461, null}
-!1461 = metadata !{i32 720907, metadata !1462, i32 577, i32 1, metadata !111, i32 572} ; [ DW_TAG_lexical_block ] [/]
-!1462 = metadata !{i32 720907, metadata !1463, i32 576, i32 1, metadata !111, i32 571} ; [ DW_TAG_lexical_block ] [/]
-!1463 = metadata !{i32 720907, metadata !120, i32 576, i32 36, metadata !111, i32 570} ; [ DW_TAG_lexical_block ] [/]
-!1464 = metadata !{i32 587, i32 44, metadata !1461, null}
-!1465 = metadata !{i32 593, i32 1, metadata !1461, null}
-!1466 = metadata !{i32 188, i32 1, metadata !1467, null}
-!1467 = metadata !{i32 720907, metadata !1468, i32 185, i32 1, metadata !34, i32 578} ; [ DW_TAG_lexical_block ] [/]
-!1468 = metadata !{i32 720907, metadata !1469, i32 184, i32 1, metadata !34, i32 577} ; [ DW_TAG_lexical_block ] [/]
-!1469 = metadata !{i32 720907, metadata !122, i32 184, i32 36, metadata !34, i32 576} ; [ DW_TAG_lexical_block ] [/]
-!1470 = metadata !{i32 188, i32 126, metadata !1467, null}
-!1471 = metadata !{i32 188, i32 46, metadata !1467, null}
-!1472 = metadata !{i32 195, i32 1, metadata !1467, null}
-!1473 = metadata !{i32 195, i32 126, metadata !1467, null}
-!1474 = metadata !{i32 195, i32 46, metadata !1467, null}
-!1475 = metadata !{i32 200, i32 1, metadata !1467, null}
-!1476 = metadata !{i32 200, i32 49, metadata !1467, null}
-!1477 = metadata !{i32 200, i32 246, metadata !1467, null}
-!1478 = metadata !{i32 204, i32 1, metadata !1467, null}
-!1479 = metadata !{i32 157, i32 1, metadata !1480, null}
-!1480 = metadata !{i32 720907, metadata !1481, i32 156, i32 1, metadata !34, i32 582} ; [ DW_TAG_lexical_block ] [/]
-!1481 = metadata !{i32 720907, metadata !1482, i32 156, i32 1, metadata !34, i32 581} ; [ DW_TAG_lexical_block ] [/]
-!1482 = metadata !{i32 720907, metadata !1483, i32 155, i32 1, metadata !34, i32 580} ; [ DW_TAG_lexical_block ] [/]
-!1483 = metadata !{i32 720907, metadata !123, i32 155, i32 46, metadata !34, i32 579} ; [ DW_TAG_lexical_block ] [/]
-!1484 = metadata !{i32 157, i32 1, metadata !1485, null}
-!1485 = metadata !{i32 720907, metadata !1480, i32 157, i32 1, metadata !34, i32 583} ; [ DW_TAG_lexical_block ] [/]
-!1486 = metadata !{i32 158, i32 1, metadata !1487, null}
-!1487 = metadata !{i32 720907, metadata !1480, i32 157, i32 1, metadata !34, i32 584} ; [ DW_TAG_lexical_block ] [/]
-!1488 = metadata !{i32 157, i32 1, metadata !1489, null}
-!1489 = metadata !{i32 720907, metadata !1490, i32 156, i32 1, metadata !34, i32 588} ; [ DW_TAG_lexical_block ] [/]
-!1490 = metadata !{i32 720907, metadata !1491, i32 156, i32 1, metadata !34, i32 587} ; [ DW_TAG_lexical_block ] [/]
-!1491 = metadata !{i32 720907, metadata !1492, i32 155, i32 1, metadata !34, i32 586} ; [ DW_TAG_lexical_block ] [/]
-!1492 = metadata !{i32 720907, metadata !124, i32 155, i32 46, metadata !34, i32 585} ; [ DW_TAG_lexical_block ] [/]
-!1493 = metadata !{i32 157, i32 1, metadata !1494, null}
-!1494 = metadata !{i32 720907, metadata !1489, i32 157, i32 1, metadata !34, i32 589} ; [ DW_TAG_lexical_block ] [/]
-!1495 = metadata !{i32 158, i32 1, metadata !1496, null}
-!1496 = metadata !{i32 720907, metadata !1489, i32 157, i32 1, metadata !34, i32 590} ; [ DW_TAG_lexical_block ] [/]
-!1497 = metadata !{i32 173, i32 1, metadata !1498, null}
-!1498 = metadata !{i32 720907, metadata !1499, i32 172, i32 1, metadata !34, i32 594} ; [ DW_TAG_lexical_block ] [/]
-!1499 = metadata !{i32 720907, metadata !1500, i32 172, i32 1, metadata !34, i32 593} ; [ DW_TAG_lexical_block ] [/]
-!1500 = metadata !{i32 720907, metadata !1501, i32 171, i32 1, metadata !34, i32 592} ; [ DW_TAG_lexical_block ] [/]
-!1501 = metadata !{i32 720907, metadata !125, i32 171, i32 43, metadata !34, i32 591} ; [ DW_TAG_lexical_block ] [/]
-!1502 = metadata !{i32 173, i32 1, metadata !1503, null}
-!1503 = metadata !{i32 720907, metadata !1498, i32 173, i32 1, metadata !34, i32 595} ; [ DW_TAG_lexical_block ] [/]
-!1504 = metadata !{i32 174, i32 1, metadata !1505, null}
-!1505 = metadata !{i32 720907, metadata !1498, i32 173, i32 1, metadata !34, i32 596} ; [ DW_TAG_lexical_block ] [/]
-!1506 = metadata !{i32 173, i32 1, metadata !1507, null}
-!1507 = metadata !{i32 720907, metadata !1508, i32 172, i32 1, metadata !34, i32 600} ; [ DW_TAG_lexical_block ] [/]
-!1508 = metadata !{i32 720907, metadata !1509, i32 172, i32 1, metadata !34, i32 599} ; [ DW_TAG_lexical_block ] [/]
-!1509 = metadata !{i32 720907, metadata !1510, i32 171, i32 1, metadata !34, i32 598} ; [ DW_TAG_lexical_block ] [/]
-!1510 = metadata !{i32 720907, metadata !126, i32 171, i32 43, metadata !34, i32 597} ; [ DW_TAG_lexical_block ] [/]
-!1511 = metadata !{i32 173, i32 1, metadata !1512, null}
-!1512 = metadata !{i32 720907, metadata !1507, i32 173, i32 1, metadata !34, i32 601} ; [ DW_TAG_lexical_block ] [/]
-!1513 = metadata !{i32 174, i32 1, metadata !1514, null}
-!1514 = metadata !{i32 720907, metadata !1507, i32 173, i32 1, metadata !34, i32 602} ; [ DW_TAG_lexical_block ] [/]
-!1515 = metadata !{i32 165, i32 1, metadata !1516, null}
-!1516 = metadata !{i32 720907, metadata !1517, i32 164, i32 1, metadata !34, i32 606} ; [ DW_TAG_lexical_block ] [/]
-!1517 = metadata !{i32 720907, metadata !1518, i32 164, i32 1, metadata !34, i32 605} ; [ DW_TAG_lexical_block ] [/]
-!1518 = metadata !{i32 720907, metadata !1519, i32 163, i32 1, metadata !34, i32 604} ; [ DW_TAG_lexical_block ] [/]
-!1519 = metadata !{i32 720907, metadata !127, i32 163, i32 48, metadata !34, i32 603} ; [ DW_TAG_lexical_block ] [/]
-!1520 = metadata !{i32 165, i32 1, metadata !1521, null}
-!1521 = metadata !{i32 720907, metadata !1516, i32 165, i32 1, metadata !34, i32 607} ; [ DW_TAG_lexical_block ] [/]
-!1522 = metadata !{i32 166, i32 1, metadata !1523, null}
-!1523 = metadata !{i32 720907, metadata !1516, i32 165, i32 1, metadata !34, i32 608} ; [ DW_TAG_lexical_block ] [/]
-!1524 = metadata !{i32 165, i32 1, metadata !1525, null}
-!1525 = metadata !{i32 720907, metadata !1526, i32 164, i32 1, metadata !34, i32 612} ; [ DW_TAG_lexical_block ] [/]
-!1526 = metadata !{i32 720907, metadata !1527, i32 164, i32 1, metadata !34, i32 611} ; [ DW_TAG_lexical_block ] [/]
-!1527 = metadata !{i32 720907, metadata !1528, i32 163, i32 1, metadata !34, i32 610} ; [ DW_TAG_lexical_block ] [/]
-!1528 = metadata !{i32 720907, metadata !128, i32 163, i32 48, metadata !34, i32 609} ; [ DW_TAG_lexical_block ] [/]
-!1529 = metadata !{i32 165, i32 1, metadata !1530, null}
-!1530 = metadata !{i32 720907, metadata !1525, i32 165, i32 1, metadata !34, i32 613} ; [ DW_TAG_lexical_block ] [/]
-!1531 = metadata !{i32 166, i32 1, metadata !1532, null}
-!1532 = metadata !{i32 720907, metadata !1525, i32 165, i32 1, metadata !34, i32 614} ; [ DW_TAG_lexical_block ] [/]
-!1533 = metadata !{i32 157, i32 1, metadata !1534, null}
-!1534 = metadata !{i32 720907, metadata !1535, i32 156, i32 1, metadata !34, i32 621} ; [ DW_TAG_lexical_block ] [/]
-!1535 = metadata !{i32 720907, metadata !1536, i32 156, i32 1, metadata !34, i32 620} ; [ DW_TAG_lexical_block ] [/]
-!1536 = metadata !{i32 720907, metadata !1537, i32 155, i32 1, metadata !34, i32 619} ; [ DW_TAG_lexical_block ] [/]
-!1537 = metadata !{i32 720907, metadata !130, i32 155, i32 46, metadata !34, i32 618} ; [ DW_TAG_lexical_block ] [/]
-!1538 = metadata !{i32 157, i32 1, metadata !1539, null}
-!1539 = metadata !{i32 720907, metadata !1534, i32 157, i32 1, metadata !34, i32 622} ; [ DW_TAG_lexical_block ] [/]
-!1540 = metadata !{i32 158, i32 1, metadata !1541, null}
-!1541 = metadata !{i32 720907, metadata !1534, i32 157, i32 1, metadata !34, i32 623} ; [ DW_TAG_lexical_block ] [/]
-!1542 = metadata !{i32 157, i32 1, metadata !1543, null}
-!1543 = metadata !{i32 720907, metadata !1544, i32 156, i32 1, metadata !34, i32 627} ; [ DW_TAG_lexical_block ] [/]
-!1544 = metadata !{i32 720907, metadata !1545, i32 156, i32 1, metadata !34, i32 626} ; [ DW_TAG_lexical_block ] [/]
-!1545 = metadata !{i32 720907, metadata !1546, i32 155, i32 1, metadata !34, i32 625} ; [ DW_TAG_lexical_block ] [/]
-!1546 = metadata !{i32 720907, metadata !131, i32 155, i32 46, metadata !34, i32 624} ; [ DW_TAG_lexical_block ] [/]
-!1547 = metadata !{i32 157, i32 1, metadata !1548, null}
-!1548 = metadata !{i32 720907, metadata !1543, i32 157, i32 1, metadata !34, i32 628} ; [ DW_TAG_lexical_block ] [/]
-!1549 = metadata !{i32 158, i32 1, metadata !1550, null}
-!1550 = metadata !{i32 720907, metadata !1543, i32 157, i32 1, metadata !34, i32 629} ; [ DW_TAG_lexical_block ] [/]
-!1551 = metadata !{i32 173, i32 1, metadata !1552, null}
-!1552 = metadata !{i32 720907, metadata !1553, i32 172, i32 1, metadata !34, i32 633} ; [ DW_TAG_lexical_block ] [/]
-!1553 = metadata !{i32 720907, metadata !1554, i32 172, i32 1, metadata !34, i32 632} ; [ DW_TAG_lexical_block ] [/]
-!1554 = metadata !{i32 720907, metadata !1555, i32 171, i32 1, metadata !34, i32 631} ; [ DW_TAG_lexical_block ] [/]
-!1555 = metadata !{i32 720907, metadata !132, i32 171, i32 43, metadata !34, i32 630} ; [ DW_TAG_lexical_block ] [/]
-!1556 = metadata !{i32 173, i32 1, metadata !1557, null}
-!1557 = metadata !{i32 720907, metadata !1552, i32 173, i32 1, metadata !34, i32 634} ; [ DW_TAG_lexical_block ] [/]
-!1558 = metadata !{i32 174, i32 1, metadata !1559, null}
-!1559 = metadata !{i32 720907, metadata !1552, i32 173, i32 1, metadata !34, i32 635} ; [ DW_TAG_lexical_block ] [/]
-!1560 = metadata !{i32 173, i32 1, metadata !1561, null}
-!1561 = metadata !{i32 720907, metadata !1562, i32 172, i32 1, metadata !34, i32 639} ; [ DW_TAG_lexical_block ] [/]
-!1562 = metadata !{i32 720907, metadata !1563, i32 172, i32 1, metadata !34, i32 638} ; [ DW_TAG_lexical_block ] [/]
-!1563 = metadata !{i32 720907, metadata !1564, i32 171, i32 1, metadata !34, i32 637} ; [ DW_TAG_lexical_block ] [/]
-!1564 = metadata !{i32 720907, metadata !133, i32 171, i32 43, metadata !34, i32 636} ; [ DW_TAG_lexical_block ] [/]
-!1565 = metadata !{i32 173, i32 1, metadata !1566, null}
-!1566 = metadata !{i32 720907, metadata !1561, i32 173, i32 1, metadata !34, i32 640} ; [ DW_TAG_lexical_block ] [/]
-!1567 = metadata !{i32 174, i32 1, metadata !1568, null}
-!1568 = metadata !{i32 720907, metadata !1561, i32 173, i32 1, metadata !34, i32 641} ; [ DW_TAG_lexical_block ] [/]
-!1569 = metadata !{i32 165, i32 1, metadata !1570, null}
-!1570 = metadata !{i32 720907, metadata !1571, i32 164, i32 1, metadata !34, i32 645} ; [ DW_TAG_lexical_block ] [/]
-!1571 = metadata !{i32 720907, metadata !1572, i32 164, i32 1, metadata !34, i32 644} ; [ DW_TAG_lexical_block ] [/]
-!1572 = metadata !{i32 720907, metadata !1573, i32 163, i32 1, metadata !34, i32 643} ; [ DW_TAG_lexical_block ] [/]
-!1573 = metadata !{i32 720907, metadata !134, i32 163, i32 48, metadata !34, i32 642} ; [ DW_TAG_lexical_block ] [/]
-!1574 = metadata !{i32 165, i32 1, metadata !1575, null}
-!1575 = metadata !{i32 720907, metadata !1570, i32 165, i32 1, metadata !34, i32 646} ; [ DW_TAG_lexical_block ] [/]
-!1576 = metadata !{i32 166, i32 1, metadata !1577, null}
-!1577 = metadata !{i32 720907, metadata !1570, i32 165, i32 1, metadata !34, i32 647} ; [ DW_TAG_lexical_block ] [/]
-!1578 = metadata !{i32 165, i32 1, metadata !1579, null}
-!1579 = metadata !{i32 720907, metadata !1580, i32 164, i32 1, metadata !34, i32 651} ; [ DW_TAG_lexical_block ] [/]
-!1580 = metadata !{i32 720907, metadata !1581, i32 164, i32 1, metadata !34, i32 650} ; [ DW_TAG_lexical_block ] [/]
-!1581 = metadata !{i32 720907, metadata !1582, i32 163, i32 1, metadata !34, i32 649} ; [ DW_TAG_lexical_block ] [/]
-!1582 = metadata !{i32 720907, metadata !135, i32 163, i32 48, metadata !34, i32 648} ; [ DW_TAG_lexical_block ] [/]
-!1583 = metadata !{i32 165, i32 1, metadata !1584, null}
-!1584 = metadata !{i32 720907, metadata !1579, i32 165, i32 1, metadata !34, i32 652} ; [ DW_TAG_lexical_block ] [/]
-!1585 = metadata !{i32 166, i32 1, metadata !1586, null}
-!1586 = metadata !{i32 720907, metadata !1579, i32 165, i32 1, metadata !34, i32 653} ; [ DW_TAG_lexical_block ] [/]
-!1587 = metadata !{i32 587, i32 1, metadata !1588, null}
-!1588 = metadata !{i32 720907, metadata !1589, i32 577, i32 1, metadata !111, i32 662} ; [ DW_TAG_lexical_block ] [/]
-!1589 = metadata !{i32 720907, metadata !1590, i32 576, i32 1, metadata !111, i32 661} ; [ DW_TAG_lexical_block ] [/]
-!1590 = metadata !{i32 720907, metadata !138, i32 576, i32 36, metadata !111, i32 660} ; [ DW_TAG_lexical_block ] [/]
-!1591 = metadata !{i32 587, i32 44, metadata !1588, null}
-!1592 = metadata !{i32 593, i32 1, metadata !1588, null}
-!1593 = metadata !{i32 188, i32 1, metadata !1594, null}
-!1594 = metadata !{i32 720907, metadata !1595, i32 185, i32 1, metadata !34, i32 671} ; [ DW_TAG_lexical_block ] [/]
-!1595 = metadata !{i32 720907, metadata !1596, i32 184, i32 1, metadata !34, i32 670} ; [ DW_TAG_lexical_block ] [/]
-!1596 = metadata !{i32 720907, metadata !141, i32 184, i32 36, metadata !34, i32 669} ; [ DW_TAG_lexical_block ] [/]
-!1597 = metadata !{i32 188, i32 126, metadata !1594, null}
-!1598 = metadata !{i32 188, i32 46, metadata !1594, null}
-!1599 = metadata !{i32 195, i32 1, metadata !1594, null}
-!1600 = metadata !{i32 195, i32 126, metadata !1594, null}
-!1601 = metadata !{i32 195, i32 46, metadata !1594, null}
-!1602 = metadata !{i32 200, i32 1, metadata !1594, null}
-!1603 = metadata !{i32 200, i32 49, metadata !1594, null}
-!1604 = metadata !{i32 200, i32 246, metadata !1594, null}
-!1605 = metadata !{i32 204, i32 1, metadata !1594, null}
-!1606 = metadata !{i32 157, i32 1, metadata !1607, null}
-!1607 = metadata !{i32 720907, metadata !1608, i32 156, i32 1, metadata !34, i32 675} ; [ DW_TAG_lexical_block ] [/]
-!1608 = metadata !{i32 720907, metadata !1609, i32 156, i32 1, metadata !34, i32 674} ; [ DW_TAG_lexical_block ] [/]
-!1609 = metadata !{i32 720907, metadata !1610, i32 155, i32 1, metadata !34, i32 673} ; [ DW_TAG_lexical_block ] [/]
-!1610 = metadata !{i32 720907, metadata !142, i32 155, i32 46, metadata !34, i32 672} ; [ DW_TAG_lexical_block ] [/]
-!1611 = metadata !{i32 157, i32 1, metadata !1612, null}
-!1612 = metadata !{i32 720907, metadata !1607, i32 157, i32 1, metadata !34, i32 676} ; [ DW_TAG_lexical_block ] [/]
-!1613 = metadata !{i32 158, i32 1, metadata !1614, null}
-!1614 = metadata !{i32 720907, metadata !1607, i32 157, i32 1, metadata !34, i32 677} ; [ DW_TAG_lexical_block ] [/]
-!1615 = metadata !{i32 157, i32 1, metadata !1616, null}
-!1616 = metadata !{i32 720907, metadata !1617, i32 156, i32 1, metadata !34, i32 681} ; [ DW_TAG_lexical_block ] [/]
-!1617 = metadata !{i32 720907, metadata !1618, i32 156, i32 1, metadata !34, i32 680} ; [ DW_TAG_lexical_block ] [/]
-!1618 = metadata !{i32 720907, metadata !1619, i32 155, i32 1, metadata !34, i32 679} ; [ DW_TAG_lexical_block ] [/]
-!1619 = metadata !{i32 720907, metadata !143, i32 155, i32 46, metadata !34, i32 678} ; [ DW_TAG_lexical_block ] [/]
-!1620 = metadata !{i32 157, i32 1, metadata !1621, null}
-!1621 = metadata !{i32 720907, metadata !1616, i32 157, i32 1, metadata !34, i32 682} ; [ DW_TAG_lexical_block ] [/]
-!1622 = metadata !{i32 158, i32 1, metadata !1623, null}
-!1623 = metadata !{i32 720907, metadata !1616, i32 157, i32 1, metadata !34, i32 683} ; [ DW_TAG_lexical_block ] [/]
-!1624 = metadata !{i32 173, i32 1, metadata !1625, null}
-!1625 = metadata !{i32 720907, metadata !1626, i32 172, i32 1, metadata !34, i32 687} ; [ DW_TAG_lexical_block ] [/]
-!1626 = metadata !{i32 720907, metadata !1627, i32 172, i32 1, metadata !34, i32 686} ; [ DW_TAG_lexical_block ] [/]
-!1627 = metadata !{i32 720907, metadata !1628, i32 171, i32 1, metadata !34, i32 685} ; [ DW_TAG_lexical_block ] [/]
-!1628 = metadata !{i32 720907, metadata !144, i32 171, i32 43, metadata !34, i32 684} ; [ DW_TAG_lexical_block ] [/]
-!1629 = metadata !{i32 173, i32 1, metadata !1630, null}
-!1630 = metadata !{i32 720907, metadata !1625, i32 173, i32 1, metadata !34, i32 688} ; [ DW_TAG_lexical_block ] [/]
-!1631 = metadata !{i32 174, i32 1, metadata !1632, null}
-!1632 = metadata !{i32 720907, metadata !1625, i32 173, i32 1, metadata !34, i32 689} ; [ DW_TAG_lexical_block ] [/]
-!1633 = metadata !{i32 173, i32 1, metadata !1634, null}
-!1634 = metadata !{i32 720907, metadata !1635, i32 172, i32 1, metadata !34, i32 693} ; [ DW_TAG_lexical_block ] [/]
-!1635 = metadata !{i32 720907, metadata !1636, i32 172, i32 1, metadata !34, i32 692} ; [ DW_TAG_lexical_block ] [/]
-!1636 = metadata !{i32 720907, metadata !1637, i32 171, i32 1, metadata !34, i32 691} ; [ DW_TAG_lexical_block ] [/]
-!1637 = metadata !{i32 720907, metadata !145, i32 171, i32 43, metadata !34, i32 690} ; [ DW_TAG_lexical_block ] [/]
-!1638 = metadata !{i32 173, i32 1, metadata !1639, null}
-!1639 = metadata !{i32 720907, metadata !1634, i32 173, i32 1, metadata !34, i32 694} ; [ DW_TAG_lexical_block ] [/]
-!1640 = metadata !{i32 174, i32 1, metadata !1641, null}
-!1641 = metadata !{i32 720907, metadata !1634, i32 173, i32 1, metadata !34, i32 695} ; [ DW_TAG_lexical_block ] [/]
-!1642 = metadata !{i32 165, i32 1, metadata !1643, null}
-!1643 = metadata !{i32 720907, metadata !1644, i32 164, i32 1, metadata !34, i32 699} ; [ DW_TAG_lexical_block ] [/]
-!1644 = metadata !{i32 720907, metadata !1645, i32 164, i32 1, metadata !34, i32 698} ; [ DW_TAG_lexical_block ] [/]
-!1645 = metadata !{i32 720907, metadata !1646, i32 163, i32 1, metadata !34, i32 697} ; [ DW_TAG_lexical_block ] [/]
-!1646 = metadata !{i32 720907, metadata !146, i32 163, i32 48, metadata !34, i32 696} ; [ DW_TAG_lexical_block ] [/]
-!1647 = metadata !{i32 165, i32 1, metadata !1648, null}
-!1648 = metadata !{i32 720907, metadata !1643, i32 165, i32 1, metadata !34, i32 700} ; [ DW_TAG_lexical_block ] [/]
-!1649 = metadata !{i32 166, i32 1, metadata !1650, null}
-!1650 = metadata !{i32 720907, metadata !1643, i32 165, i32 1, metadata !34, i32 701} ; [ DW_TAG_lexical_block ] [/]
-!1651 = metadata !{i32 165, i32 1, metadata !1652, null}
-!1652 = metadata !{i32 720907, metadata !1653, i32 164, i32 1, metadata !34, i32 705} ; [ DW_TAG_lexical_block ] [/]
-!1653 = metadata !{i32 720907, metadata !1654, i32 164, i32 1, metadata !34, i32 704} ; [ DW_TAG_lexical_block ] [/]
-!1654 = metadata !{i32 720907, metadata !1655, i32 163, i32 1, metadata !34, i32 703} ; [ DW_TAG_lexical_block ] [/]
-!1655 = metadata !{i32 720907, metadata !147, i32 163, i32 48, metadata !34, i32 702} ; [ DW_TAG_lexical_block ] [/]
-!1656 = metadata !{i32 165, i32 1, metadata !1657, null}
-!1657 = metadata !{i32 720907, metadata !1652, i32 165, i32 1, metadata !34, i32 706} ; [ DW_TAG_lexical_block ] [/]
-!1658 = metadata !{i32 166, i32 1, metadata !1659, null}
-!1659 = metadata !{i32 720907, metadata !1652, i32 165, i32 1, metadata !34, i32 707} ; [ DW_TAG_lexical_block ] [/]
+!0 = metadata !{void (float*, float*)* @_Z16transpose_kernelPfPKf, metadata !"kernel", i32 1, metadata !"reqntidx", i32 32, metadata !"reqntidy", i32 32}
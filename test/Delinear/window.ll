@@ -0,0 +1,35 @@
+; A 3-point stencil as left by the accessor lowering: the block reads the
+; window [x0 - 1, x0 + blockDim.x + 1) of in, which is staged in a shared
+; tile of 1024 + 2 elements.
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v16:16:16-v32:32:32-v64:64:64-v128:128:128-n16:32:64"
+target triple = "nvptx-nvidia-cl.1.0"
+
+define void @_Z13window_kernelPfPKf(float* noalias %out, float* noalias %in) {
+entry:
+  %tid = tail call i32 @llvm.nvvm.read.ptx.sreg.tid.x()
+  %ctaid = tail call i32 @llvm.nvvm.read.ptx.sreg.ctaid.x()
+  %ntid = tail call i32 @llvm.nvvm.read.ptx.sreg.ntid.x()
+  %tid64 = zext i32 %tid to i64
+  %ctaid64 = zext i32 %ctaid to i64
+  %ntid64 = zext i32 %ntid to i64
+  %x0 = mul i64 %ctaid64, %ntid64
+  %block = getelementptr inbounds float* %in, i64 %x0
+  %center = getelementptr inbounds float* %block, i64 %tid64
+  %left = getelementptr inbounds float* %center, i64 -1
+  %right = getelementptr inbounds float* %center, i64 1
+  %l = load float* %left, align 4
+  %c = load float* %center, align 4
+  %r = load float* %right, align 4
+  %lc = fadd float %l, %c
+  %sum = fadd float %lc, %r
+  %outblock = getelementptr inbounds float* %out, i64 %x0
+  %dst = getelementptr inbounds float* %outblock, i64 %tid64
+  store float %sum, float* %dst, align 4
+  ret void
+}
+
+declare i32 @llvm.nvvm.read.ptx.sreg.tid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ctaid.x() #0
+declare i32 @llvm.nvvm.read.ptx.sreg.ntid.x() #0
+
+attributes #0 = { nounwind readnone }
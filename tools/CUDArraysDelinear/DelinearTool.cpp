@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------
+//
+// DelinearTool.cpp: runs the Delinear analysis over several IR files in a
+// single process and writes one combined registration output, instead of
+// spawning opt (and writing one output) per translation unit.
+//
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "llvm/Analysis/Passes.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/LegacyPassManager.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/InitializePasses.h"
+#include "llvm/PassRegistry.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Signals.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "../../lib/Delinear/CUDArraysDriver.h"
+#include "../../lib/Delinear/CUDArraysRTDriver.h"
+#include "../../lib/Delinear/Delinear.h"
+#include "../../lib/Delinear/ParallelFor.h"
+
+using namespace llvm;
+using namespace platonic;
+
+static cl::list<std::string>
+InputFiles(cl::Positional, cl::OneOrMore,
+           cl::desc("<input bitcode or IR files>"));
+
+static cl::opt<unsigned>
+Jobs("j", cl::desc("Number of threads used to parse the inputs (0: one per core)"),
+     cl::init(0));
+
+// Every input gets its own context, so that the modules can be parsed
+// concurrently. The kernel declarations the drivers register are typed in
+// these contexts, so they must outlive the drivers.
+struct Input {
+  std::unique_ptr<LLVMContext> context;
+  std::unique_ptr<Module> module;
+  SMDiagnostic err;
+};
+
+int main(int argc, char **argv) {
+  sys::PrintStackTraceOnErrorSignal();
+  PrettyStackTraceProgram X(argc, argv);
+  llvm_shutdown_obj Y;
+
+  PassRegistry &registry = *PassRegistry::getPassRegistry();
+  initializeCore(registry);
+  initializeAnalysis(registry);
+  initializeIPA(registry);
+
+  cl::ParseCommandLineOptions(argc, argv, "cudarrays delinearization driver\n");
+
+  std::vector<Input> inputs(InputFiles.size());
+  parallelFor(inputs.size(), Jobs, [&](size_t i) {
+    inputs[i].context.reset(new LLVMContext());
+    inputs[i].module = parseIRFile(InputFiles[i], inputs[i].err,
+                                   *inputs[i].context);
+  });
+
+  int result = 0;
+  {
+    // Both drivers write the combined output when destroyed
+    CUDArraysDriver driver;
+    CUDArraysRTDriver driverRT;
+
+    // The drivers are shared, so the modules are analysed one at a time
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      Input &input = inputs[i];
+      if (!input.module) {
+        input.err.print(argv[0], errs());
+        result = 1;
+        continue;
+      }
+
+      legacy::PassManager PM;
+      PM.add(new DataLayoutPass());
+      PM.add(createDelinearPass(driver, driverRT));
+      PM.run(*input.module);
+    }
+  }
+
+  return result;
+}
+
+// vim: set ts=2 sw=2: